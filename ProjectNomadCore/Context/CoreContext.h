@@ -2,6 +2,7 @@
 
 #include "Context/SimFrame.h"
 #include "EnTT/entt.hpp"
+#include "Physics/NarrowphaseMemo.h"
 #include "Utilities/LoggerSingleton.h"
 #include "Utilities/Singleton.h"
 
@@ -15,6 +16,9 @@ namespace ProjectNomad {
         SimFrame simFrame = {};
         entt::registry registry = {};
 
+        // Not part of snapshots, as intended to carry over rollback re-simulation. Disabled unless explicitly enabled
+        NarrowphaseMemo narrowphaseMemo = {};
+
         // Store singleton references so not necessary to directly ::get() everywhere
         LoggerSingleton& logger = Singleton<LoggerSingleton>::get();
     };
@@ -4,7 +4,9 @@
 
 #include "Math/FQuatFP.h"
 #include "Math/FVectorFP.h"
+#include "Physics/Model/CollisionLayers.h"
 #include "Physics/Model/FCollider.h"
+#include "Physics/Model/GjkData.h"
 #include "Utilities/FrameType.h"
 
 namespace ProjectNomad {
@@ -31,6 +33,8 @@ namespace ProjectNomad {
     struct PhysicsComponent {
         FFixedPoint mass = FFixedPoint(100);
         FVectorFP velocity = FVectorFP::Zero();
+        // Consecutive frames spent (nearly) still. Used to decide when entity can be put to sleep
+        uint16_t framesAtRest = 0;
 
         bool HasAnyVelocity() const {
             return velocity.GetLengthSquared() != fp{0};
@@ -43,22 +47,53 @@ namespace ProjectNomad {
         void CalculateCRC32(uint32_t& resultThusFar) const {
             mass.CalculateCRC32(resultThusFar);
             velocity.CalculateCRC32(resultThusFar);
+            resultThusFar = CRC::Calculate(&framesAtRest, sizeof(framesAtRest), CRC::CRC_32(), resultThusFar);
         }
     };
 
     struct DynamicColliderComponent {
         FCollider collider = {};
+        CollisionLayerFilter layerFilter = {};
 
         void CalculateCRC32(uint32_t& resultThusFar) const {
             collider.CalculateCRC32(resultThusFar);
+            layerFilter.CalculateCRC32(resultThusFar);
         }
     };
 
     struct StaticColliderComponent {
         FCollider collider = {};
+        CollisionLayerFilter layerFilter = {};
         
         void CalculateCRC32(uint32_t& resultThusFar) const {
             collider.CalculateCRC32(resultThusFar);
+            layerFilter.CalculateCRC32(resultThusFar);
+        }
+    };
+
+    /**
+    * Non-blocking collider which only reports overlaps with dynamic colliders (via TriggerSystem) and never takes part
+    *   in collision resolution nor scene queries. Eg, "player entered boss arena" volumes for level scripting
+    **/
+    struct TriggerColliderComponent {
+        FCollider collider = {};
+        CollisionLayerFilter layerFilter = {};
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            collider.CalculateCRC32(resultThusFar);
+            layerFilter.CalculateCRC32(resultThusFar);
+        }
+    };
+
+    /**
+    * Narrowphase results from prior frames against other entities (eg, GJK warm start data).
+    * Added on demand by collision handling systems, and purely an optimization aside from needing to be snapshotted
+    **/
+    struct NarrowphaseCacheComponent {
+        NarrowphaseCache cache = {};
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            cache.CalculateCRC32(resultThusFar);
         }
     };
 
@@ -72,6 +107,20 @@ namespace ProjectNomad {
         }
     };
 
+    /**
+    * Marks a dynamic entity as asleep, ie all physics systems skip it entirely until woken up.
+    * Added by UpdateSleepStateSystem once entity's whole contact island has been at rest for long enough.
+    * Removed via PhysicsUpdateHelpers::WakeUp (eg, by contact with an awake entity or gaining velocity)
+    * NOTE: Game-side systems which constantly add velocity (eg, gravity) should also skip entities with this flag
+    **/
+    struct SleepingFlagComponent {
+        bool throwaway = false;
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&throwaway, sizeof(throwaway), CRC::CRC_32(), resultThusFar);
+        }
+    };
+
     /**
     * Simply marks if entity is "invulnerable" (ie, that generally cannot be interacted with)
     * TODO: Actually use this for all combat situations (like hit checks and grapple checks)
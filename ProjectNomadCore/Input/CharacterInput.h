@@ -4,9 +4,11 @@
 
 #include "CommandSetList.h"
 #include "GameplayInteractiveUIChoice.h"
+#include "Math/CompactFixedPoint.h"
+#include "Math/CompactQuatFP.h"
 #include "Math/FixedPoint.h"
-#include "Math/FVectorFP.h"
 #include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
 
 namespace ProjectNomad {
     /**
@@ -16,18 +18,27 @@ namespace ProjectNomad {
     *       related network messages.
     **/
     struct CharacterInput {
-        // fp values represent axis inputs which are in range [-1, 1].
-        // FUTURE: Compress all values to take up less space.
+        /**
+        * Bump whenever stored fields or their precision change, so replay files and network peers can reject data
+        *   recorded with a different layout (resimulating it would silently diverge).
+        * 1: Full precision FQuatFP camRotation and fp axes.
+        * 2: camRotation stored as CompactQuatFP (lossless), axes quantized to fpUnit16 (1/16384, half away from zero).
+        *    Replays recorded with version 1 will not resimulate identically.
+        **/
+        static constexpr uint32_t kFormatVersion = 2;
+
+        // Axis inputs are in range [-1, 1]. Rotation and axes use compact storage as inputs are kept in rollback rings
+        //      and sent every frame. Use the getters below (or implicit conversion) for any math.
 
         // TODO: Get rid of cam pos entirely!
         //      Copy other melee-games-with-shooting such as Wo Long, where aiming goes into over-the-shoulder aim mode,
         //      where aim pos is derived from rotation. Can even make grapple-aim-startup anim frames which mask the discontinuity.
         //      Aside from smaller packet size, this helps with "prediction"! (Rollback frame count and replay compression)
         FVectorFP camPosition = {};
-        FQuatFP camRotation = {}; // TODO: Compress down into  8bits per fp
+        CompactQuatFP camRotation = {};
         
-        fp moveForward = fp{0}; // TODO: Compress down into  8bits per fp
-        fp moveRight = fp{0}; // TODO: Compress down into  8bits per fp
+        fpUnit16 moveForward = {}; // FUTURE: Could go down to 8 bits, as analog sticks rarely have more resolution
+        fpUnit16 moveRight = {};
 
         GameplayInteractiveUIChoice uiChoice =  GameplayInteractiveUIChoice::None;
         
@@ -35,6 +46,18 @@ namespace ProjectNomad {
         // Nice to abstract away independent buttons vs actual action commands
         CommandSetList commandInputs = {};
 
+        FQuatFP GetCamRotation() const {
+            return camRotation.ToQuat();
+        }
+
+        fp GetMoveForward() const {
+            return moveForward.ToFP();
+        }
+
+        fp GetMoveRight() const {
+            return moveRight.ToFP();
+        }
+
         void CalculateCRC32(uint32_t& resultThusFar) const {
             camPosition.CalculateCRC32(resultThusFar);
             camRotation.CalculateCRC32(resultThusFar);
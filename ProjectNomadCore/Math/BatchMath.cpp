@@ -0,0 +1,678 @@
+#include "BatchMath.h"
+
+#include <atomic>
+
+#include "Math/FPMath.h"
+#include "Utilities/Assertion.h"
+
+// SIMD kernels are only available on x64. Each kernel function is individually marked with its target instruction set
+//      (rather than compiling this file with different flags), so that the file builds as-is in any build system and
+//      the CPU only ever executes AVX2/SSE4.2 instructions after runtime detection picked that backend.
+#if defined(_M_X64) || defined(__x86_64__)
+#define NOMAD_BATCH_MATH_SIMD 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#define NOMAD_TARGET_SSE42
+#define NOMAD_TARGET_AVX2
+#else
+#define NOMAD_TARGET_SSE42 __attribute__((target("sse4.2")))
+#define NOMAD_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#else
+#define NOMAD_BATCH_MATH_SIMD 0
+#endif
+
+namespace ProjectNomad {
+    namespace {
+#pragma region Scalar
+
+        // Scalar versions process [begin, count), so SIMD versions can use them for any remaining tail elements
+
+        FVectorFP LoadVector(const VectorBatchView& source, uint32_t index) {
+            return {
+                fp::from_raw_value(source.x[index]),
+                fp::from_raw_value(source.y[index]),
+                fp::from_raw_value(source.z[index])
+            };
+        }
+
+        void StoreVector(const MutableVectorBatchView& destination, uint32_t index, const FVectorFP& value) {
+            destination.x[index] = value.x.raw_value();
+            destination.y[index] = value.y.raw_value();
+            destination.z[index] = value.z.raw_value();
+        }
+
+        void AddScalar(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out,
+                       uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                StoreVector(out, i, LoadVector(a, i) + LoadVector(b, i));
+            }
+        }
+
+        void SubtractScalar(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out,
+                            uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                StoreVector(out, i, LoadVector(a, i) - LoadVector(b, i));
+            }
+        }
+
+        void ScaleScalar(const VectorBatchView& a, fp scalar, const MutableVectorBatchView& out, uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                StoreVector(out, i, LoadVector(a, i) * scalar);
+            }
+        }
+
+        void DotScalar(const VectorBatchView& a, const VectorBatchView& b, fpBaseType* out, uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                out[i] = LoadVector(a, i).Dot(LoadVector(b, i)).raw_value();
+            }
+        }
+
+        void CrossScalar(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out,
+                         uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                StoreVector(out, i, LoadVector(a, i).Cross(LoadVector(b, i)));
+            }
+        }
+
+        void LengthSquaredScalar(const VectorBatchView& a, fpBaseType* out, uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                out[i] = LoadVector(a, i).GetLengthSquared().raw_value();
+            }
+        }
+
+        // Same as FVectorFP::Normalized, but with length squared already calculated
+        FVectorFP NormalizeWithLengthSquared(const FVectorFP& vector, fpBaseType lengthSquared) {
+            fp length = FPMath::sqrt(fp::from_raw_value(lengthSquared));
+            if (length == fp{0}) {
+                return FVectorFP::Zero();
+            }
+            return vector / length;
+        }
+
+        void NormalizeScalar(const VectorBatchView& a, const MutableVectorBatchView& out, uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                StoreVector(out, i, LoadVector(a, i).Normalized());
+            }
+        }
+
+        void RotateScalar(const QuatBatchView& rotations, const VectorBatchView& a, const MutableVectorBatchView& out,
+                          uint32_t begin) {
+            for (uint32_t i = begin; i < a.count; i++) {
+                FQuatFP rotation(
+                    fp::from_raw_value(rotations.w[i]),
+                    FVectorFP(
+                        fp::from_raw_value(rotations.x[i]),
+                        fp::from_raw_value(rotations.y[i]),
+                        fp::from_raw_value(rotations.z[i])
+                    )
+                );
+                StoreVector(out, i, rotation * LoadVector(a, i));
+            }
+        }
+
+#pragma endregion
+#if NOMAD_BATCH_MATH_SIMD
+#pragma region SSE4.2
+
+        NOMAD_TARGET_SSE42 inline __m128i LoadSse42(const fpBaseType* source) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+        }
+
+        NOMAD_TARGET_SSE42 inline void StoreSse42(fpBaseType* destination, __m128i value) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value);
+        }
+
+        /**
+        * Fixed point multiply matching FFixedPoint::operator*= bit for bit. There's no 64 bit multiply before AVX-512,
+        *   so magnitudes are multiplied from 32 bit halves and only bits [16, 80) of the 128 bit product are kept.
+        *   Rounding bias is added to lowest partial product, which can't overflow as that's at most (2^32 - 1)^2.
+        *   Rounding half away from zero on magnitudes then negating gives the same result as FFixedPoint's bias+shift.
+        **/
+        NOMAD_TARGET_SSE42 inline __m128i MultiplySse42(__m128i a, __m128i b) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i lowMask = _mm_set1_epi64x(0xFFFFFFFF);
+            const __m128i roundingBias = _mm_set1_epi64x(fpBaseType{1} << 15);
+
+            __m128i aSign = _mm_cmpgt_epi64(zero, a);
+            __m128i bSign = _mm_cmpgt_epi64(zero, b);
+            __m128i aMagnitude = _mm_sub_epi64(_mm_xor_si128(a, aSign), aSign);
+            __m128i bMagnitude = _mm_sub_epi64(_mm_xor_si128(b, bSign), bSign);
+            __m128i aHigh = _mm_srli_epi64(aMagnitude, 32);
+            __m128i bHigh = _mm_srli_epi64(bMagnitude, 32);
+
+            __m128i lowLow = _mm_add_epi64(_mm_mul_epu32(aMagnitude, bMagnitude), roundingBias);
+            __m128i lowHigh = _mm_mul_epu32(aMagnitude, bHigh);
+            __m128i highLow = _mm_mul_epu32(aHigh, bMagnitude);
+            __m128i highHigh = _mm_mul_epu32(aHigh, bHigh);
+
+            __m128i middle = _mm_add_epi64(
+                _mm_srli_epi64(lowLow, 32),
+                _mm_add_epi64(_mm_and_si128(lowHigh, lowMask), _mm_and_si128(highLow, lowMask))
+            );
+            __m128i high = _mm_add_epi64(
+                _mm_add_epi64(highHigh, _mm_srli_epi64(middle, 32)),
+                _mm_add_epi64(_mm_srli_epi64(lowHigh, 32), _mm_srli_epi64(highLow, 32))
+            );
+
+            __m128i magnitude = _mm_or_si128(
+                _mm_or_si128(_mm_slli_epi64(_mm_and_si128(middle, lowMask), 16),
+                             _mm_srli_epi64(_mm_and_si128(lowLow, lowMask), 16)),
+                _mm_slli_epi64(high, 48)
+            );
+
+            __m128i resultSign = _mm_xor_si128(aSign, bSign);
+            return _mm_sub_epi64(_mm_xor_si128(magnitude, resultSign), resultSign);
+        }
+
+        // Same order of operations as FVectorFP::Cross, including rounding of each product
+        NOMAD_TARGET_SSE42 inline void CrossSse42(__m128i ax, __m128i ay, __m128i az,
+                                                  __m128i bx, __m128i by, __m128i bz,
+                                                  __m128i& outX, __m128i& outY, __m128i& outZ) {
+            outX = _mm_sub_epi64(MultiplySse42(ay, bz), MultiplySse42(az, by));
+            outY = _mm_sub_epi64(MultiplySse42(az, bx), MultiplySse42(ax, bz));
+            outZ = _mm_sub_epi64(MultiplySse42(ax, by), MultiplySse42(ay, bx));
+        }
+
+        NOMAD_TARGET_SSE42 inline __m128i DotSse42(__m128i ax, __m128i ay, __m128i az,
+                                                   __m128i bx, __m128i by, __m128i bz) {
+            return _mm_add_epi64(_mm_add_epi64(MultiplySse42(ax, bx), MultiplySse42(ay, by)), MultiplySse42(az, bz));
+        }
+
+        NOMAD_TARGET_SSE42 void AddSse42(const VectorBatchView& a, const VectorBatchView& b,
+                                         const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                StoreSse42(out.x + i, _mm_add_epi64(LoadSse42(a.x + i), LoadSse42(b.x + i)));
+                StoreSse42(out.y + i, _mm_add_epi64(LoadSse42(a.y + i), LoadSse42(b.y + i)));
+                StoreSse42(out.z + i, _mm_add_epi64(LoadSse42(a.z + i), LoadSse42(b.z + i)));
+            }
+            AddScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void SubtractSse42(const VectorBatchView& a, const VectorBatchView& b,
+                                              const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                StoreSse42(out.x + i, _mm_sub_epi64(LoadSse42(a.x + i), LoadSse42(b.x + i)));
+                StoreSse42(out.y + i, _mm_sub_epi64(LoadSse42(a.y + i), LoadSse42(b.y + i)));
+                StoreSse42(out.z + i, _mm_sub_epi64(LoadSse42(a.z + i), LoadSse42(b.z + i)));
+            }
+            SubtractScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void ScaleSse42(const VectorBatchView& a, fp scalar, const MutableVectorBatchView& out) {
+            __m128i scalarLanes = _mm_set1_epi64x(scalar.raw_value());
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                StoreSse42(out.x + i, MultiplySse42(LoadSse42(a.x + i), scalarLanes));
+                StoreSse42(out.y + i, MultiplySse42(LoadSse42(a.y + i), scalarLanes));
+                StoreSse42(out.z + i, MultiplySse42(LoadSse42(a.z + i), scalarLanes));
+            }
+            ScaleScalar(a, scalar, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void DotSse42(const VectorBatchView& a, const VectorBatchView& b, fpBaseType* out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                StoreSse42(out + i, DotSse42(
+                    LoadSse42(a.x + i), LoadSse42(a.y + i), LoadSse42(a.z + i),
+                    LoadSse42(b.x + i), LoadSse42(b.y + i), LoadSse42(b.z + i)
+                ));
+            }
+            DotScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void CrossSse42(const VectorBatchView& a, const VectorBatchView& b,
+                                           const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                __m128i x, y, z;
+                CrossSse42(
+                    LoadSse42(a.x + i), LoadSse42(a.y + i), LoadSse42(a.z + i),
+                    LoadSse42(b.x + i), LoadSse42(b.y + i), LoadSse42(b.z + i),
+                    x, y, z
+                );
+                StoreSse42(out.x + i, x);
+                StoreSse42(out.y + i, y);
+                StoreSse42(out.z + i, z);
+            }
+            CrossScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void LengthSquaredSse42(const VectorBatchView& a, fpBaseType* out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                __m128i x = LoadSse42(a.x + i);
+                __m128i y = LoadSse42(a.y + i);
+                __m128i z = LoadSse42(a.z + i);
+                StoreSse42(out + i, DotSse42(x, y, z, x, y, z));
+            }
+            LengthSquaredScalar(a, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void NormalizeSse42(const VectorBatchView& a, const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                __m128i x = LoadSse42(a.x + i);
+                __m128i y = LoadSse42(a.y + i);
+                __m128i z = LoadSse42(a.z + i);
+
+                fpBaseType lengthsSquared[2];
+                StoreSse42(lengthsSquared, DotSse42(x, y, z, x, y, z));
+                for (uint32_t lane = 0; lane < 2; lane++) {
+                    StoreVector(out, i + lane, NormalizeWithLengthSquared(LoadVector(a, i + lane), lengthsSquared[lane]));
+                }
+            }
+            NormalizeScalar(a, out, i);
+        }
+
+        NOMAD_TARGET_SSE42 void RotateSse42(const QuatBatchView& rotations, const VectorBatchView& a,
+                                            const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 2 <= a.count; i += 2) {
+                __m128i qx = LoadSse42(rotations.x + i);
+                __m128i qy = LoadSse42(rotations.y + i);
+                __m128i qz = LoadSse42(rotations.z + i);
+                __m128i twoW = _mm_slli_epi64(LoadSse42(rotations.w + i), 1); // Integer multiply, same as 2 * w
+                __m128i x = LoadSse42(a.x + i);
+                __m128i y = LoadSse42(a.y + i);
+                __m128i z = LoadSse42(a.z + i);
+
+                // input + vCrossInput * (2 * w) + v.Cross(vCrossInput) * 2, same as FQuatFP::operator*
+                __m128i crossX, crossY, crossZ;
+                CrossSse42(qx, qy, qz, x, y, z, crossX, crossY, crossZ);
+                __m128i doubleCrossX, doubleCrossY, doubleCrossZ;
+                CrossSse42(qx, qy, qz, crossX, crossY, crossZ, doubleCrossX, doubleCrossY, doubleCrossZ);
+
+                // Fixed point multiply by exactly 2 never rounds, so it's a plain shift
+                StoreSse42(out.x + i, _mm_add_epi64(_mm_add_epi64(x, MultiplySse42(crossX, twoW)),
+                                                    _mm_slli_epi64(doubleCrossX, 1)));
+                StoreSse42(out.y + i, _mm_add_epi64(_mm_add_epi64(y, MultiplySse42(crossY, twoW)),
+                                                    _mm_slli_epi64(doubleCrossY, 1)));
+                StoreSse42(out.z + i, _mm_add_epi64(_mm_add_epi64(z, MultiplySse42(crossZ, twoW)),
+                                                    _mm_slli_epi64(doubleCrossZ, 1)));
+            }
+            RotateScalar(rotations, a, out, i);
+        }
+
+#pragma endregion
+#pragma region AVX2
+
+        // Identical to SSE4.2 versions above, just with 4 lanes instead of 2
+
+        NOMAD_TARGET_AVX2 inline __m256i LoadAvx2(const fpBaseType* source) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source));
+        }
+
+        NOMAD_TARGET_AVX2 inline void StoreAvx2(fpBaseType* destination, __m256i value) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value);
+        }
+
+        NOMAD_TARGET_AVX2 inline __m256i MultiplyAvx2(__m256i a, __m256i b) {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFF);
+            const __m256i roundingBias = _mm256_set1_epi64x(fpBaseType{1} << 15);
+
+            __m256i aSign = _mm256_cmpgt_epi64(zero, a);
+            __m256i bSign = _mm256_cmpgt_epi64(zero, b);
+            __m256i aMagnitude = _mm256_sub_epi64(_mm256_xor_si256(a, aSign), aSign);
+            __m256i bMagnitude = _mm256_sub_epi64(_mm256_xor_si256(b, bSign), bSign);
+            __m256i aHigh = _mm256_srli_epi64(aMagnitude, 32);
+            __m256i bHigh = _mm256_srli_epi64(bMagnitude, 32);
+
+            __m256i lowLow = _mm256_add_epi64(_mm256_mul_epu32(aMagnitude, bMagnitude), roundingBias);
+            __m256i lowHigh = _mm256_mul_epu32(aMagnitude, bHigh);
+            __m256i highLow = _mm256_mul_epu32(aHigh, bMagnitude);
+            __m256i highHigh = _mm256_mul_epu32(aHigh, bHigh);
+
+            __m256i middle = _mm256_add_epi64(
+                _mm256_srli_epi64(lowLow, 32),
+                _mm256_add_epi64(_mm256_and_si256(lowHigh, lowMask), _mm256_and_si256(highLow, lowMask))
+            );
+            __m256i high = _mm256_add_epi64(
+                _mm256_add_epi64(highHigh, _mm256_srli_epi64(middle, 32)),
+                _mm256_add_epi64(_mm256_srli_epi64(lowHigh, 32), _mm256_srli_epi64(highLow, 32))
+            );
+
+            __m256i magnitude = _mm256_or_si256(
+                _mm256_or_si256(_mm256_slli_epi64(_mm256_and_si256(middle, lowMask), 16),
+                                _mm256_srli_epi64(_mm256_and_si256(lowLow, lowMask), 16)),
+                _mm256_slli_epi64(high, 48)
+            );
+
+            __m256i resultSign = _mm256_xor_si256(aSign, bSign);
+            return _mm256_sub_epi64(_mm256_xor_si256(magnitude, resultSign), resultSign);
+        }
+
+        NOMAD_TARGET_AVX2 inline void CrossAvx2(__m256i ax, __m256i ay, __m256i az,
+                                                __m256i bx, __m256i by, __m256i bz,
+                                                __m256i& outX, __m256i& outY, __m256i& outZ) {
+            outX = _mm256_sub_epi64(MultiplyAvx2(ay, bz), MultiplyAvx2(az, by));
+            outY = _mm256_sub_epi64(MultiplyAvx2(az, bx), MultiplyAvx2(ax, bz));
+            outZ = _mm256_sub_epi64(MultiplyAvx2(ax, by), MultiplyAvx2(ay, bx));
+        }
+
+        NOMAD_TARGET_AVX2 inline __m256i DotAvx2(__m256i ax, __m256i ay, __m256i az,
+                                                 __m256i bx, __m256i by, __m256i bz) {
+            return _mm256_add_epi64(_mm256_add_epi64(MultiplyAvx2(ax, bx), MultiplyAvx2(ay, by)), MultiplyAvx2(az, bz));
+        }
+
+        NOMAD_TARGET_AVX2 void AddAvx2(const VectorBatchView& a, const VectorBatchView& b,
+                                       const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                StoreAvx2(out.x + i, _mm256_add_epi64(LoadAvx2(a.x + i), LoadAvx2(b.x + i)));
+                StoreAvx2(out.y + i, _mm256_add_epi64(LoadAvx2(a.y + i), LoadAvx2(b.y + i)));
+                StoreAvx2(out.z + i, _mm256_add_epi64(LoadAvx2(a.z + i), LoadAvx2(b.z + i)));
+            }
+            AddScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void SubtractAvx2(const VectorBatchView& a, const VectorBatchView& b,
+                                            const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                StoreAvx2(out.x + i, _mm256_sub_epi64(LoadAvx2(a.x + i), LoadAvx2(b.x + i)));
+                StoreAvx2(out.y + i, _mm256_sub_epi64(LoadAvx2(a.y + i), LoadAvx2(b.y + i)));
+                StoreAvx2(out.z + i, _mm256_sub_epi64(LoadAvx2(a.z + i), LoadAvx2(b.z + i)));
+            }
+            SubtractScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void ScaleAvx2(const VectorBatchView& a, fp scalar, const MutableVectorBatchView& out) {
+            __m256i scalarLanes = _mm256_set1_epi64x(scalar.raw_value());
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                StoreAvx2(out.x + i, MultiplyAvx2(LoadAvx2(a.x + i), scalarLanes));
+                StoreAvx2(out.y + i, MultiplyAvx2(LoadAvx2(a.y + i), scalarLanes));
+                StoreAvx2(out.z + i, MultiplyAvx2(LoadAvx2(a.z + i), scalarLanes));
+            }
+            ScaleScalar(a, scalar, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void DotAvx2(const VectorBatchView& a, const VectorBatchView& b, fpBaseType* out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                StoreAvx2(out + i, DotAvx2(
+                    LoadAvx2(a.x + i), LoadAvx2(a.y + i), LoadAvx2(a.z + i),
+                    LoadAvx2(b.x + i), LoadAvx2(b.y + i), LoadAvx2(b.z + i)
+                ));
+            }
+            DotScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void CrossAvx2(const VectorBatchView& a, const VectorBatchView& b,
+                                         const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                __m256i x, y, z;
+                CrossAvx2(
+                    LoadAvx2(a.x + i), LoadAvx2(a.y + i), LoadAvx2(a.z + i),
+                    LoadAvx2(b.x + i), LoadAvx2(b.y + i), LoadAvx2(b.z + i),
+                    x, y, z
+                );
+                StoreAvx2(out.x + i, x);
+                StoreAvx2(out.y + i, y);
+                StoreAvx2(out.z + i, z);
+            }
+            CrossScalar(a, b, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void LengthSquaredAvx2(const VectorBatchView& a, fpBaseType* out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                __m256i x = LoadAvx2(a.x + i);
+                __m256i y = LoadAvx2(a.y + i);
+                __m256i z = LoadAvx2(a.z + i);
+                StoreAvx2(out + i, DotAvx2(x, y, z, x, y, z));
+            }
+            LengthSquaredScalar(a, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void NormalizeAvx2(const VectorBatchView& a, const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                __m256i x = LoadAvx2(a.x + i);
+                __m256i y = LoadAvx2(a.y + i);
+                __m256i z = LoadAvx2(a.z + i);
+
+                fpBaseType lengthsSquared[4];
+                StoreAvx2(lengthsSquared, DotAvx2(x, y, z, x, y, z));
+                for (uint32_t lane = 0; lane < 4; lane++) {
+                    StoreVector(out, i + lane, NormalizeWithLengthSquared(LoadVector(a, i + lane), lengthsSquared[lane]));
+                }
+            }
+            NormalizeScalar(a, out, i);
+        }
+
+        NOMAD_TARGET_AVX2 void RotateAvx2(const QuatBatchView& rotations, const VectorBatchView& a,
+                                          const MutableVectorBatchView& out) {
+            uint32_t i = 0;
+            for (; i + 4 <= a.count; i += 4) {
+                __m256i qx = LoadAvx2(rotations.x + i);
+                __m256i qy = LoadAvx2(rotations.y + i);
+                __m256i qz = LoadAvx2(rotations.z + i);
+                __m256i twoW = _mm256_slli_epi64(LoadAvx2(rotations.w + i), 1);
+                __m256i x = LoadAvx2(a.x + i);
+                __m256i y = LoadAvx2(a.y + i);
+                __m256i z = LoadAvx2(a.z + i);
+
+                __m256i crossX, crossY, crossZ;
+                CrossAvx2(qx, qy, qz, x, y, z, crossX, crossY, crossZ);
+                __m256i doubleCrossX, doubleCrossY, doubleCrossZ;
+                CrossAvx2(qx, qy, qz, crossX, crossY, crossZ, doubleCrossX, doubleCrossY, doubleCrossZ);
+
+                StoreAvx2(out.x + i, _mm256_add_epi64(_mm256_add_epi64(x, MultiplyAvx2(crossX, twoW)),
+                                                      _mm256_slli_epi64(doubleCrossX, 1)));
+                StoreAvx2(out.y + i, _mm256_add_epi64(_mm256_add_epi64(y, MultiplyAvx2(crossY, twoW)),
+                                                      _mm256_slli_epi64(doubleCrossY, 1)));
+                StoreAvx2(out.z + i, _mm256_add_epi64(_mm256_add_epi64(z, MultiplyAvx2(crossZ, twoW)),
+                                                      _mm256_slli_epi64(doubleCrossZ, 1)));
+            }
+            RotateScalar(rotations, a, out, i);
+        }
+
+#pragma endregion
+#endif
+#pragma region Backend Selection
+
+        bool IsCpuSupported(BatchMathBackend backend) {
+#if NOMAD_BATCH_MATH_SIMD
+#if defined(_MSC_VER)
+            int cpuInfo[4] = {};
+            __cpuid(cpuInfo, 1);
+            bool hasSse42 = (cpuInfo[2] & (1 << 20)) != 0;
+            // AVX2 also needs OS support for saving the wider registers (OSXSAVE, then XCR0 bits for XMM and YMM)
+            bool isAvxStateEnabled = (cpuInfo[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(cpuInfo, 7, 0);
+            bool hasAvx2 = isAvxStateEnabled && (cpuInfo[1] & (1 << 5)) != 0;
+#else
+            bool hasSse42 = __builtin_cpu_supports("sse4.2");
+            bool hasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+            switch (backend) {
+                case BatchMathBackend::Scalar:
+                    return true;
+                case BatchMathBackend::Sse42:
+                    return hasSse42;
+                case BatchMathBackend::Avx2:
+                    return hasAvx2;
+                default:
+                    return false;
+            }
+#else
+            return backend == BatchMathBackend::Scalar;
+#endif
+        }
+
+        std::atomic<BatchMathBackend>& GetActiveBackend() {
+            static std::atomic<BatchMathBackend> activeBackend = [] {
+                // SSE4.2 only has 2 lanes for emulating 64 bit multiplies, which measured slower than scalar 128 bit
+                //      multiplies on x64. Thus it's never picked by default, but remains available via SetBackend
+                if (IsCpuSupported(BatchMathBackend::Avx2)) {
+                    return BatchMathBackend::Avx2;
+                }
+                return BatchMathBackend::Scalar;
+            }();
+            return activeBackend;
+        }
+
+        void AssertSameCount(const VectorBatchView& a, uint32_t otherCount) {
+            assertm(a.count == otherCount, "All batch views should have the same count");
+        }
+
+#pragma endregion
+    }
+
+    bool BatchMath::IsBackendSupported(BatchMathBackend backend) {
+        return IsCpuSupported(backend);
+    }
+
+    BatchMathBackend BatchMath::GetBackend() {
+        return GetActiveBackend().load(std::memory_order_relaxed);
+    }
+
+    bool BatchMath::SetBackend(BatchMathBackend backend) {
+        if (!IsCpuSupported(backend)) {
+            return false;
+        }
+
+        GetActiveBackend().store(backend, std::memory_order_relaxed);
+        return true;
+    }
+
+    void BatchMath::Add(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out) {
+        AssertSameCount(a, b.count);
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                AddAvx2(a, b, out);
+                return;
+            case BatchMathBackend::Sse42:
+                AddSse42(a, b, out);
+                return;
+#endif
+            default:
+                AddScalar(a, b, out, 0);
+        }
+    }
+
+    void BatchMath::Subtract(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out) {
+        AssertSameCount(a, b.count);
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                SubtractAvx2(a, b, out);
+                return;
+            case BatchMathBackend::Sse42:
+                SubtractSse42(a, b, out);
+                return;
+#endif
+            default:
+                SubtractScalar(a, b, out, 0);
+        }
+    }
+
+    void BatchMath::Scale(const VectorBatchView& a, fp scalar, const MutableVectorBatchView& out) {
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                ScaleAvx2(a, scalar, out);
+                return;
+            case BatchMathBackend::Sse42:
+                ScaleSse42(a, scalar, out);
+                return;
+#endif
+            default:
+                ScaleScalar(a, scalar, out, 0);
+        }
+    }
+
+    void BatchMath::Dot(const VectorBatchView& a, const VectorBatchView& b, fpBaseType* out) {
+        AssertSameCount(a, b.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                DotAvx2(a, b, out);
+                return;
+            case BatchMathBackend::Sse42:
+                DotSse42(a, b, out);
+                return;
+#endif
+            default:
+                DotScalar(a, b, out, 0);
+        }
+    }
+
+    void BatchMath::Cross(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out) {
+        AssertSameCount(a, b.count);
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                CrossAvx2(a, b, out);
+                return;
+            case BatchMathBackend::Sse42:
+                CrossSse42(a, b, out);
+                return;
+#endif
+            default:
+                CrossScalar(a, b, out, 0);
+        }
+    }
+
+    void BatchMath::LengthSquared(const VectorBatchView& a, fpBaseType* out) {
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                LengthSquaredAvx2(a, out);
+                return;
+            case BatchMathBackend::Sse42:
+                LengthSquaredSse42(a, out);
+                return;
+#endif
+            default:
+                LengthSquaredScalar(a, out, 0);
+        }
+    }
+
+    void BatchMath::Normalize(const VectorBatchView& a, const MutableVectorBatchView& out) {
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                NormalizeAvx2(a, out);
+                return;
+            case BatchMathBackend::Sse42:
+                NormalizeSse42(a, out);
+                return;
+#endif
+            default:
+                NormalizeScalar(a, out, 0);
+        }
+    }
+
+    void BatchMath::Rotate(const QuatBatchView& rotations, const VectorBatchView& a, const MutableVectorBatchView& out) {
+        AssertSameCount(a, rotations.count);
+        AssertSameCount(a, out.count);
+        switch (GetBackend()) {
+#if NOMAD_BATCH_MATH_SIMD
+            case BatchMathBackend::Avx2:
+                RotateAvx2(rotations, a, out);
+                return;
+            case BatchMathBackend::Sse42:
+                RotateSse42(rotations, a, out);
+                return;
+#endif
+            default:
+                RotateScalar(rotations, a, out, 0);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Math/FixedPoint.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+
+namespace ProjectNomad {
+    enum class BatchMathBackend : uint8_t {
+        Scalar,
+        Sse42, // 2 lanes per instruction
+        Avx2 // 4 lanes per instruction
+    };
+
+    // Read only SoA view over raw fixed point values (see FFixedPoint::raw_value). All arrays hold count entries
+    struct VectorBatchView {
+        const fpBaseType* x = nullptr;
+        const fpBaseType* y = nullptr;
+        const fpBaseType* z = nullptr;
+        uint32_t count = 0;
+    };
+
+    struct MutableVectorBatchView {
+        fpBaseType* x = nullptr;
+        fpBaseType* y = nullptr;
+        fpBaseType* z = nullptr;
+        uint32_t count = 0;
+
+        operator VectorBatchView() const {
+            return {x, y, z, count};
+        }
+    };
+
+    // One rotation per vector. Quaternions are expected to be unit length, same as FQuatFP's rotation operator
+    struct QuatBatchView {
+        const fpBaseType* w = nullptr;
+        const fpBaseType* x = nullptr;
+        const fpBaseType* y = nullptr;
+        const fpBaseType* z = nullptr;
+        uint32_t count = 0;
+    };
+
+    /// <summary>
+    /// Owning SoA storage for batches of vectors, so callers can gather once (eg, from components) and then run
+    ///     several batch operations. Storage is only reallocated when growing, so reusing a batch avoids allocations.
+    /// </summary>
+    class VectorBatch {
+      public:
+        void Resize(uint32_t count) {
+            mX.resize(count);
+            mY.resize(count);
+            mZ.resize(count);
+        }
+
+        uint32_t GetSize() const {
+            return static_cast<uint32_t>(mX.size());
+        }
+
+        void Set(uint32_t index, const FVectorFP& vector) {
+            mX[index] = vector.x.raw_value();
+            mY[index] = vector.y.raw_value();
+            mZ[index] = vector.z.raw_value();
+        }
+
+        FVectorFP Get(uint32_t index) const {
+            return {fp::from_raw_value(mX[index]), fp::from_raw_value(mY[index]), fp::from_raw_value(mZ[index])};
+        }
+
+        VectorBatchView View() const {
+            return {mX.data(), mY.data(), mZ.data(), GetSize()};
+        }
+
+        MutableVectorBatchView MutableView() {
+            return {mX.data(), mY.data(), mZ.data(), GetSize()};
+        }
+
+      private:
+        std::vector<fpBaseType> mX;
+        std::vector<fpBaseType> mY;
+        std::vector<fpBaseType> mZ;
+    };
+
+    /// <summary>
+    /// Batch versions of FVectorFP/FQuatFP operations over SoA arrays, for processing hundreds of entities at once.
+    /// Every backend gives bit-identical results to the scalar operators (including fixed point rounding), so backend
+    ///     choice never affects determinism. AVX2 is picked at startup when the CPU supports it, otherwise scalar.
+    ///
+    /// Outputs may alias inputs (ie, in place operations are fine), but all views must have the same count.
+    /// </summary>
+    class BatchMath {
+      public:
+        BatchMath() = delete;
+
+        static bool IsBackendSupported(BatchMathBackend backend);
+        static BatchMathBackend GetBackend();
+        /**
+        * Overrides the active backend, such as for comparing backends in tests and benchmarks.
+        * @returns false (and leaves active backend as-is) if backend isn't supported on this CPU
+        **/
+        static bool SetBackend(BatchMathBackend backend);
+
+        static void Add(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out);
+        static void Subtract(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out);
+        static void Scale(const VectorBatchView& a, fp scalar, const MutableVectorBatchView& out);
+        // Results are raw fixed point values, one per vector
+        static void Dot(const VectorBatchView& a, const VectorBatchView& b, fpBaseType* out);
+        static void Cross(const VectorBatchView& a, const VectorBatchView& b, const MutableVectorBatchView& out);
+        static void LengthSquared(const VectorBatchView& a, fpBaseType* out);
+        // Only length squared is vectorized, as square root and division remain per lane
+        static void Normalize(const VectorBatchView& a, const MutableVectorBatchView& out);
+        static void Rotate(const QuatBatchView& rotations, const VectorBatchView& a, const MutableVectorBatchView& out);
+    };
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <CRCpp/CRC.h>
+
+#include "Math/FixedPoint.h"
+#include "Utilities/Assertion.h"
+
+namespace ProjectNomad {
+    /**
+    * Fixed point storage type with a smaller underlying integer than fp, for data which is stored or sent far more
+    *   than it's used for math (eg, snapshots, input rings and network packets).
+    * Not meant for arithmetic: Convert to fp (implicit, as it's cheap and exact for any value stored from fp), do math
+    *   and then assign back.
+    *
+    * Converting from fp is lossless whenever FractionBits >= 16 and value is within range. Fewer fraction bits round
+    *   half away from zero, same as fp multiplication. Out of range values assert and then saturate, so behavior
+    *   stays deterministic even in release builds.
+    * @tparam StorageType - Signed integral type holding the raw value
+    * @tparam FractionBits - Number of fraction bits within StorageType
+    **/
+    template <typename StorageType, int FractionBits>
+    class CompactFixedPoint {
+        static_assert(std::is_integral_v<StorageType> && std::is_signed_v<StorageType>, "StorageType must be a signed integral type");
+        static_assert(sizeof(StorageType) < sizeof(fpBaseType), "Use fp directly if not saving any space");
+        static_assert(FractionBits > 0 && FractionBits < static_cast<int>(sizeof(StorageType) * 8),
+                      "StorageType must fit entire fraction plus sign bit");
+
+        static constexpr int kFpFractionBits = 16;
+        static_assert(fp{1}.raw_value() == fpBaseType{1} << kFpFractionBits, "Conversions assume fp has 16 fraction bits");
+
+      public:
+        constexpr CompactFixedPoint() = default;
+        constexpr explicit CompactFixedPoint(fp value) : mValue(FromFpRaw(value.raw_value())) {}
+
+        constexpr CompactFixedPoint& operator=(fp value) {
+            mValue = FromFpRaw(value.raw_value());
+            return *this;
+        }
+
+        constexpr fp ToFP() const {
+            if constexpr (FractionBits >= kFpFractionBits) {
+                return ToFpWithRounding(mValue, FractionBits - kFpFractionBits);
+            }
+            else {
+                return fp::from_raw_value(static_cast<fpBaseType>(mValue) << (kFpFractionBits - FractionBits));
+            }
+        }
+
+        constexpr operator fp() const {
+            return ToFP();
+        }
+
+        static constexpr CompactFixedPoint from_raw_value(StorageType value) {
+            CompactFixedPoint result;
+            result.mValue = value;
+            return result;
+        }
+
+        constexpr StorageType raw_value() const {
+            return mValue;
+        }
+
+        // Smallest and largest fp values which can be stored without saturating
+        static constexpr fp MinValue() {
+            return from_raw_value(std::numeric_limits<StorageType>::min()).ToFP();
+        }
+        static constexpr fp MaxValue() {
+            return from_raw_value(std::numeric_limits<StorageType>::max()).ToFP();
+        }
+
+        auto operator<=>(const CompactFixedPoint&) const = default;
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&mValue, sizeof(StorageType), CRC::CRC_32(), resultThusFar);
+        }
+
+        StorageType Serialize() const {
+            return mValue;
+        }
+        void Deserialize(StorageType serializedValue) {
+            mValue = serializedValue;
+        }
+
+        std::string ToString() const {
+            return ToFP().ToString();
+        }
+
+      private:
+        StorageType mValue = 0;
+
+        // Rounds half away from zero when dropping bits, same as fp multiplication
+        static constexpr fp ToFpWithRounding(StorageType value, int dropBits) {
+            if (dropBits == 0) {
+                return fp::from_raw_value(value);
+            }
+
+            fpBaseType half = fpBaseType{1} << (dropBits - 1);
+            fpBaseType magnitude = value < 0 ? -static_cast<fpBaseType>(value) : static_cast<fpBaseType>(value);
+            fpBaseType result = (magnitude + half) >> dropBits;
+            return fp::from_raw_value(value < 0 ? -result : result);
+        }
+
+        static constexpr StorageType FromFpRaw(fpBaseType fpRaw) {
+            constexpr fpBaseType kMin = std::numeric_limits<StorageType>::min();
+            constexpr fpBaseType kMax = std::numeric_limits<StorageType>::max();
+
+            fpBaseType raw = 0;
+            if constexpr (FractionBits >= kFpFractionBits) {
+                // Check range before shifting up, so that large values can't overflow
+                constexpr int kShift = FractionBits - kFpFractionBits;
+                assertm(fpRaw >= (kMin >> kShift) && fpRaw <= (kMax >> kShift), "Value is outside compact fixed point range");
+                raw = fpRaw < (kMin >> kShift) ? kMin : fpRaw > (kMax >> kShift) ? kMax : fpRaw * (fpBaseType{1} << kShift);
+            }
+            else {
+                constexpr int kDropBits = kFpFractionBits - FractionBits;
+                fpBaseType magnitude = ((fpRaw < 0 ? -fpRaw : fpRaw) + (fpBaseType{1} << (kDropBits - 1))) >> kDropBits;
+                raw = fpRaw < 0 ? -magnitude : magnitude;
+
+                assertm(raw >= kMin && raw <= kMax, "Value is outside compact fixed point range");
+                raw = raw < kMin ? kMin : raw > kMax ? kMax : raw;
+            }
+            return static_cast<StorageType>(raw);
+        }
+    };
+
+    // Same precision as fp for values within [-32768, 32768), such as quaternion components, timers or speeds.
+    //      Always lossless in range. Note that more fraction bits (eg, Q1.30) wouldn't be any more precise, as values
+    //      come from fp which only has 16 fraction bits
+    using fpCompact32 = CompactFixedPoint<int32_t, 16>;
+    // Low precision unit range values such as analog axis inputs: [-2, 2) with 14 fraction bits (rounds to ~0.00006)
+    using fpUnit16 = CompactFixedPoint<int16_t, 14>;
+}
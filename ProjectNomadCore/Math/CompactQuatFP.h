@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+
+#include "Math/CompactFixedPoint.h"
+#include "Math/FQuatFP.h"
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Storage form of FQuatFP at half the size (16 bytes rather than 32), for inputs, snapshots and packets.
+    /// Lossless, as quaternion components are always well within fpCompact32's range.
+    /// Convert to FQuatFP (implicit) for any math.
+    /// </summary>
+    struct CompactQuatFP {
+        fpCompact32 w;
+        fpCompact32 x;
+        fpCompact32 y;
+        fpCompact32 z;
+
+        constexpr CompactQuatFP() = default;
+        constexpr explicit CompactQuatFP(const FQuatFP& quat) : w(quat.w), x(quat.v.x), y(quat.v.y), z(quat.v.z) {}
+
+        constexpr CompactQuatFP& operator=(const FQuatFP& quat) {
+            *this = CompactQuatFP(quat);
+            return *this;
+        }
+
+        constexpr FQuatFP ToQuat() const {
+            return FQuatFP(w, FVectorFP(x, y, z));
+        }
+
+        constexpr operator FQuatFP() const {
+            return ToQuat();
+        }
+
+        // Forward FQuatFP's member operations, as implicit conversion doesn't apply to the left side of those.
+        //      Keeps code written against FQuatFP fields compiling, eg input.camRotation * dir
+        constexpr FQuatFP inverted() const {
+            return ToQuat().inverted();
+        }
+
+        constexpr FQuatFP operator*(const FQuatFP& q) const {
+            return ToQuat() * q;
+        }
+
+        constexpr FVectorFP operator*(const FVectorFP& input) const {
+            return ToQuat() * input;
+        }
+
+        auto operator<=>(const CompactQuatFP&) const = default;
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            w.CalculateCRC32(resultThusFar);
+            x.CalculateCRC32(resultThusFar);
+            y.CalculateCRC32(resultThusFar);
+            z.CalculateCRC32(resultThusFar);
+        }
+
+        std::string ToString() const {
+            return ToQuat().ToString();
+        }
+    };
+}
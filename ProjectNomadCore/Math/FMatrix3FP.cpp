@@ -0,0 +1,61 @@
+#include "FMatrix3FP.h"
+
+#include "Utilities/Assertion.h"
+
+namespace {
+    constexpr int kFractionBits = 16;
+    static_assert(FFixedPoint{1}.raw_value() == int64_t{1} << kFractionBits, "Assumes fp has 16 fraction bits");
+
+    // Rounds a value with 32 fraction bits to fp, half away from zero (same as fp multiplication)
+    FFixedPoint RoundFromProduct(int64_t value) {
+        constexpr int64_t kHalf = int64_t{1} << (kFractionBits - 1);
+        int64_t magnitude = value < 0 ? -value : value;
+        int64_t result = (magnitude + kHalf) >> kFractionBits;
+        return FFixedPoint::from_raw_value(value < 0 ? -result : result);
+    }
+}
+
+// https://en.wikipedia.org/wiki/Quaternions_and_spatial_rotation#Quaternion-derived_rotation_matrix
+// Products are kept unrounded (32 fraction bits) and each entry is rounded only once, so every entry is within 0.5 LSB
+//      of the exact matrix for the given quaternion
+FMatrix3FP FMatrix3FP::FromQuat(const FQuatFP& rotation) {
+    int64_t w = rotation.w.raw_value();
+    int64_t x = rotation.v.x.raw_value();
+    int64_t y = rotation.v.y.raw_value();
+    int64_t z = rotation.v.z.raw_value();
+
+    constexpr int64_t kOne = int64_t{1} << (2 * kFractionBits);
+    int64_t xx = x * x, yy = y * y, zz = z * z;
+    int64_t xy = x * y, xz = x * z, yz = y * z;
+    int64_t wx = w * x, wy = w * y, wz = w * z;
+
+    return {
+        {RoundFromProduct(kOne - 2 * (yy + zz)), RoundFromProduct(2 * (xy - wz)), RoundFromProduct(2 * (xz + wy))},
+        {RoundFromProduct(2 * (xy + wz)), RoundFromProduct(kOne - 2 * (xx + zz)), RoundFromProduct(2 * (yz - wx))},
+        {RoundFromProduct(2 * (xz - wy)), RoundFromProduct(2 * (yz + wx)), RoundFromProduct(kOne - 2 * (xx + yy))}
+    };
+}
+
+FMatrix3FP FMatrix3FP::operator*(const FMatrix3FP& other) const {
+    FMatrix3FP otherTransposed = other.Transposed();
+
+    FMatrix3FP result;
+    for (uint8_t row = 0; row < 3; row++) {
+        result.rows[row] = otherTransposed * rows[row];
+    }
+    return result;
+}
+
+void FMatrix3FP::TransformPoints(std::span<const FVectorFP> points, std::span<FVectorFP> results,
+                                 const FVectorFP& translation) const {
+    assertm(results.size() >= points.size(), "Results span should be at least as long as input points");
+    size_t count = points.size() < results.size() ? points.size() : results.size();
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = *this * points[i] + translation;
+    }
+}
+
+std::string FMatrix3FP::ToString() const {
+    return "[" + rows[0].ToString() + "], [" + rows[1].ToString() + "], [" + rows[2].ToString() + "]";
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <span>
+
+#include "FQuatFP.h"
+#include "FVectorFP.h"
+
+/// <summary>
+/// Row-major 3x3 rotation matrix, for transforming many points by the same rotation.
+///
+/// FQuatFP * FVectorFP costs two cross products plus scaling per point. Converting the quaternion once and then
+///     transforming costs 9 multiplies per point, so this wins whenever the same rotation is applied more than once
+///     (eg, all 8 corners of a box). Inverse of a rotation matrix is just its transpose.
+/// Entries are rounded to fp, so results can differ from quaternion rotation by about 1 LSB per unit of input length.
+///
+/// Derived data only, never part of snapshots. Keep the source quaternion as the authoritative rotation.
+/// </summary>
+struct THENOMADGAME_API FMatrix3FP {
+    FVectorFP rows[3] = {FVectorFP::Forward(), FVectorFP::Right(), FVectorFP::Up()};
+
+    constexpr FMatrix3FP() = default;
+    constexpr FMatrix3FP(const FVectorFP& row0, const FVectorFP& row1, const FVectorFP& row2)
+        : rows{row0, row1, row2} {}
+
+    static constexpr FMatrix3FP Identity() {
+        return {};
+    }
+    // Rotation must be a unit quaternion, same as FQuatFP's rotation operator
+    static FMatrix3FP FromQuat(const FQuatFP& rotation);
+
+    constexpr FVectorFP GetRow(uint8_t index) const {
+        return rows[index];
+    }
+    // Columns of a rotation matrix are the rotated x/y/z axes
+    constexpr FVectorFP GetColumn(uint8_t index) const {
+        return {rows[0][index], rows[1][index], rows[2][index]};
+    }
+
+    // Same as inverse for rotation matrices
+    constexpr FMatrix3FP Transposed() const {
+        return {GetColumn(0), GetColumn(1), GetColumn(2)};
+    }
+
+    constexpr FVectorFP operator*(const FVectorFP& value) const {
+        return {rows[0].Dot(value), rows[1].Dot(value), rows[2].Dot(value)};
+    }
+    // Combines rotations, such that (a * b) * v == a * (b * v) (up to rounding)
+    FMatrix3FP operator*(const FMatrix3FP& other) const;
+
+    auto operator<=>(const FMatrix3FP&) const = default;
+
+    /**
+    * Batch transform: results[i] = this * points[i] + translation. Results may alias points.
+    * @param points Input points (or directions, if translation is zero)
+    * @param results Output span, which must be at least as long as points
+    * @param translation Offset added after rotating, such as a collider's center
+    **/
+    void TransformPoints(std::span<const FVectorFP> points, std::span<FVectorFP> results,
+                         const FVectorFP& translation = FVectorFP::Zero()) const;
+
+    std::string ToString() const;
+};
@@ -20,14 +20,14 @@ namespace ProjectNomad {
         fp pitch;
         fp yaw;
 
-        EulerAngles() : roll(0), pitch(0), yaw(0) {}
-        EulerAngles(fp roll, fp pitch, fp yaw) : roll(roll), pitch(pitch), yaw(yaw) {}
+        constexpr EulerAngles() : roll(0), pitch(0), yaw(0) {}
+        constexpr EulerAngles(fp roll, fp pitch, fp yaw) : roll(roll), pitch(pitch), yaw(yaw) {}
 
-        static EulerAngles zero() {
+        static constexpr EulerAngles zero() {
             return EulerAngles(fp{0}, fp{0}, fp{0});
         }
 
-        EulerAngles operator-() const {
+        constexpr EulerAngles operator-() const {
             EulerAngles result;
             result.roll = -roll;
             result.pitch = -pitch;
@@ -53,11 +53,11 @@ namespace ProjectNomad {
         }
     };
 
-    inline bool operator==(const EulerAngles& lhs, const EulerAngles& rhs) {
+    constexpr bool operator==(const EulerAngles& lhs, const EulerAngles& rhs) {
         return lhs.roll == rhs.roll && lhs.pitch == rhs.pitch && lhs.yaw == rhs.yaw;
     }
 
-    inline bool operator!=(const EulerAngles& lhs, const EulerAngles& rhs) {
+    constexpr bool operator!=(const EulerAngles& lhs, const EulerAngles& rhs) {
         return !(lhs == rhs);
     }
 
@@ -1,31 +1,53 @@
 #pragma once
 
 #include "FixedPoint.h"
+#include "FPRsqrt.h"
+#include "FPTrigLookup.h"
 #include <fpm/math.hpp>
 
+// Set to 1 to use FPTrigLookup's interpolated tables for sin/cos/asin/acos/atan2 rather than fpm's approximations.
+// Lookups are both faster and more accurate, but give different results than fpm so can't be mixed within a match
+#ifndef NOMAD_USE_TRIG_LOOKUP
+#define NOMAD_USE_TRIG_LOOKUP 0
+#endif
+
 // Following constants based on UnrealMathUtility constants
 // TODO: Replace with the fpm e constant
 #define FP_VERY_SMALL_NUMBER (fp{1.e-4f})
 
 namespace ProjectNomad {
 
+    // Everything here is constexpr, so constants and tables can be calculated at compile time. Results are
+    //      bit-identical to calling the same functions at runtime
     class FPMath {
     public:
-        static fp getPI() {
+        static constexpr fp getPI() {
             // return 3.14159265f;
             return fp::pi();
         }
 
-        static fp abs(const fp& value) {
+        static constexpr fp abs(const fp& value) {
             return value < fp{0} ? value * fp{-1} : value;
         }
 
-        static fp sqrt(const fp& value) {
+        static constexpr fp sqrt(const fp& value) {
             auto result = fpm::sqrt(value.ToLibraryType());
             return fp::FromLibraryType(result);
         }
 
-        static fp square(const fp& value) {
+        // 1 / sqrt(value) without any division, via FPRsqrt. Value must be positive
+        static constexpr fp rsqrt(const fp& value) {
+            assertm(value > fp{0}, "Reciprocal square root is only defined for positive values");
+            if (value <= fp{0}) {
+                return fp{0};
+            }
+
+            // 1 / sqrt(raw / 2^16) is 2^8 / sqrt(raw), then 16 more bits to convert result to fp
+            FPRsqrt::Result inverse = FPRsqrt::Calculate(static_cast<uint64_t>(value.raw_value()));
+            return fp::from_raw_value(FPRsqrt::MultiplyRaw(1, inverse, 24));
+        }
+
+        static constexpr fp square(const fp& value) {
             return value * value;
         }
 
@@ -44,14 +66,14 @@ namespace ProjectNomad {
         // Returns the remainder of numerator / denominator
         // Inspired by UE's GenericPlatformMath::Fmod
         // FUTURE: Look at usages. May not even be worth implementing full fmod and instead hardcoding usage in clampAxis
-        static fp fmod(fp numerator, fp denominator) {
+        static constexpr fp fmod(fp numerator, fp denominator) {
             // *looks at UE's implementation*
             // Yeah no, we got a library for a reason
             auto result = fpm::fmod(numerator.ToLibraryType(), denominator.ToLibraryType());
             return fp::FromLibraryType(result);
         }
 
-        static fp clampAxis(fp angle) {
+        static constexpr fp clampAxis(fp angle) {
             // Based on UE's Rotator::ClampAxis (and Rotator is similar to our EulerAngles class)
 
             // returns Angle in the range (-360,360)
@@ -66,7 +88,7 @@ namespace ProjectNomad {
         }
 
 
-        static fp normalizeAxis(fp angle) {
+        static constexpr fp normalizeAxis(fp angle) {
             // Based on UE's Rotator::NormalizeAxis
 
             // returns Angle in the range [0,360)
@@ -80,7 +102,7 @@ namespace ProjectNomad {
             return angle;
         }
 
-        static fp clampAngle(fp angleDegrees, fp minAngleDegrees, fp maxAngleDegrees) {
+        static constexpr fp clampAngle(fp angleDegrees, fp minAngleDegrees, fp maxAngleDegrees) {
             // Based on UE's UnrealMath::ClampAngle
 
             const fp maxDelta = clampAxis(maxAngleDegrees - minAngleDegrees) * fp{0.5f}; // 0..180
@@ -107,73 +129,93 @@ namespace ProjectNomad {
             return (a < b) ? b : a;
         }
 
-        static fp degreesToRadians(const fp& value) {
+        static constexpr fp degreesToRadians(const fp& value) {
             return value / 360 * getPI() * 2;
         }
 
-        static fp radiansToDegrees(const fp& value) {
+        static constexpr fp radiansToDegrees(const fp& value) {
             return value * 180 / getPI();
         }
 
-        static fp cosR(const fp& value) {
+        static constexpr fp cosR(const fp& value) {
+#if NOMAD_USE_TRIG_LOOKUP
+            return FPTrigLookup::cos(value);
+#else
             auto result = fpm::cos(value.ToLibraryType());
             return fp::FromLibraryType(result);
+#endif
         }
 
-        static fp cosD(const fp& value) {
+        static constexpr fp cosD(const fp& value) {
             // TODO: For additional accuracy, do value clamping from following:
             // https://stackoverflow.com/a/31525208/3735890
 
             return cosR(degreesToRadians(value));
         }
 
-        static fp sinR(const fp& value) {
+        static constexpr fp sinR(const fp& value) {
+#if NOMAD_USE_TRIG_LOOKUP
+            return FPTrigLookup::sin(value);
+#else
             auto result = fpm::sin(value.ToLibraryType());
             return fp::FromLibraryType(result);
+#endif
         }
 
-        static fp sinD(const fp& value) {
+        static constexpr fp sinD(const fp& value) {
             // TODO: For additional accuracy, do value clamping from following:
             // https://stackoverflow.com/a/31525208/3735890
 
             return sinR(degreesToRadians(value));
         }
 
-        static fp acosR(const fp& value) {
+        static constexpr fp acosR(const fp& value) {
+#if NOMAD_USE_TRIG_LOOKUP
+            return FPTrigLookup::acos(value);
+#else
             auto result = fpm::acos(value.ToLibraryType());
             return fp::FromLibraryType(result);
+#endif
         }
 
-        static fp acosD(const fp& value) {
+        static constexpr fp acosD(const fp& value) {
             return radiansToDegrees(acosR(value));
         }
 
-        static fp asinR(const fp& value) {
+        static constexpr fp asinR(const fp& value) {
+#if NOMAD_USE_TRIG_LOOKUP
+            return FPTrigLookup::asin(value);
+#else
             auto result = fpm::asin(value.ToLibraryType());
             return fp::FromLibraryType(result);
+#endif
         }
 
-        static fp asinD(const fp& value) {
+        static constexpr fp asinD(const fp& value) {
             return radiansToDegrees(asinR(value));
         }
 
         // Returns angle in radians
-        static fp atanR(const fp& y, const fp& x) {
+        static constexpr fp atanR(const fp& y, const fp& x) {
+#if NOMAD_USE_TRIG_LOOKUP
+            return FPTrigLookup::atan2(y, x);
+#else
             auto result = fpm::atan2(y.ToLibraryType(), x.ToLibraryType());
             return fp::FromLibraryType(result);
+#endif
         }
 
-        static fp atanD(const fp& y, const fp& x) {
+        static constexpr fp atanD(const fp& y, const fp& x) {
             return radiansToDegrees(atanR(y, x));
         }
 
-        static void swap(fp& a, fp& b) {
+        static constexpr void swap(fp& a, fp& b) {
             fp tmp = a;
             a = b;
             b = tmp;
         }
 
-        static bool isNear(const fp& val, const fp& expectedVal, const fp& positiveErrorRange) {
+        static constexpr bool isNear(const fp& val, const fp& expectedVal, const fp& positiveErrorRange) {
             return val >= expectedVal - positiveErrorRange && val <= expectedVal + positiveErrorRange; 
         }
 
@@ -185,7 +227,7 @@ namespace ProjectNomad {
             return fp::from_raw_value(std::numeric_limits<fpBaseType>::min());
         }
 
-        static uint32_t safeUnsignedDecrement(uint32_t startingValue, uint32_t decrementAmount) {
+        static constexpr uint32_t safeUnsignedDecrement(uint32_t startingValue, uint32_t decrementAmount) {
             if (startingValue < decrementAmount) { // Underflow (less than 0) prevention
                 return 0;
             }
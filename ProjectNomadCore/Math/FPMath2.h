@@ -17,20 +17,20 @@ namespace ProjectNomad {
     class FPMath2 {
     public:
         // No promises for behavior if zeroToOne is outside range
-        static fp lerp(const fp& a, const fp& b, const fp& alpha) {
+        static constexpr fp lerp(const fp& a, const fp& b, const fp& alpha) {
             return a + (b - a) * alpha;
         }
 
-        static fp bezierInterp(const fp& a, const fp& b, const fp& alpha) {
+        static constexpr fp bezierInterp(const fp& a, const fp& b, const fp& alpha) {
             return lerp(a, b, bezierBlend(alpha));
         }
 
         // No promises for behavior if zeroToOne is outside range
-        static FVectorFP lerp(const FVectorFP& a, const FVectorFP& b, const fp& alpha) {
+        static constexpr FVectorFP lerp(const FVectorFP& a, const FVectorFP& b, const fp& alpha) {
             return a + (b - a) * alpha;
         }
 
-        static FVectorFP interpTo(const FVectorFP& current, const FVectorFP& target, fp interpSpeed) {
+        static constexpr FVectorFP interpTo(const FVectorFP& current, const FVectorFP& target, fp interpSpeed) {
             // Based on UnrealMath::VInterpTo
 
             // If no interp speed, jump to target value
@@ -55,16 +55,16 @@ namespace ProjectNomad {
             return current + deltaMove;
         }
 
-        static EulerAngles QuatToEuler(const FQuatFP& quat) {
+        static constexpr EulerAngles QuatToEuler(const FQuatFP& quat) {
             // "Proper" way to do so: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles#Quaternion_to_Euler_angles_conversion
             // However, we already implemented quat to dir vector and dir vector to euler. Thus, just reuse that.
             // NOTE: It'd likely be far more efficient to work in dir vector space than to work in euler space, esp if
-            //       converting back to quat
+            //       converting back to quat. See QuatUtilities for direct quat operations (including signed yaw/pitch)
             
             return DirVectorToEuler(QuatToDirVector(quat));
         }
 
-        static FQuatFP eulerToQuat(const EulerAngles& euler) {
+        static constexpr FQuatFP eulerToQuat(const EulerAngles& euler) {
             // Solid reference: https://en.wikipedia.org/wiki/Conversion_between_quaternions_and_Euler_angles#Euler_angles_to_quaternion_conversion
             // Another good algorithm reference: https://www.euclideanspace.com/maths/geometry/rotations/conversions/eulerToQuaternion/index.htm
 
@@ -84,7 +84,7 @@ namespace ProjectNomad {
             return result;
         }
 
-        static FVectorFP eulerToDirVector(const EulerAngles& euler) {
+        static constexpr FVectorFP eulerToDirVector(const EulerAngles& euler) {
             // Based on the following: https://stackoverflow.com/a/1568687/3735890
             // Note that this doesn't take into account roll as it doesn't affect result here (following yaw -> pitch -> roll rotation order)
 
@@ -97,7 +97,7 @@ namespace ProjectNomad {
         }
 
         // NOTE: Method is untested (and currently unused). Needs unit tests!
-        static EulerAngles DirVectorToEuler(const FVectorFP& input) {
+        static constexpr EulerAngles DirVectorToEuler(const FVectorFP& input) {
             // High level approach: Doing the reverse of eulerToDirVector method
             EulerAngles result;
 
@@ -133,7 +133,7 @@ namespace ProjectNomad {
         * @param input - rotation to represent as a direction vector
         * @returns direction vector with provided input rotation
         **/
-        static FVectorFP QuatToDirVector(const FQuatFP& input) {
+        static constexpr FVectorFP QuatToDirVector(const FQuatFP& input) {
             return input * FVectorFP::Forward();
         }
 
@@ -141,15 +141,17 @@ namespace ProjectNomad {
         /// Returns a quaternion which represents rotation necessary to rotate FPVector::Forward in order to match
         /// the provided rotation vector.
         /// </returns>
-        static FQuatFP dirVectorToQuat(const FVectorFP& targetVec) {
+        static constexpr FQuatFP dirVectorToQuat(const FVectorFP& targetVec) {
             return dirVectorToQuat(targetVec, FVectorFP::Forward());
         }
 
         /// <returns>
         /// Returns a quaternion which represents rotation necessary to rotate referenceVec to match the provided
         /// rotation vector.
+        /// QuatUtilities::FromTo is a faster trig-free alternative, but results differ in the last few bits. Thus
+        /// callers need to switch explicitly (and only where doing so can't desync existing replays).
         /// </returns>
-        static FQuatFP dirVectorToQuat(const FVectorFP& targetVec, const FVectorFP& referenceVec) {
+        static constexpr FQuatFP dirVectorToQuat(const FVectorFP& targetVec, const FVectorFP& referenceVec) {
             // Goal here is to create an axis-angle representation that would rotate referenceVec to become rotationVec
             // References: Sorry, don't really have any references here. This is more so based on what a quaternion is
             //              and choosing to calculate the quat like this due to intended usage (eg, Transform rotation)
@@ -198,15 +200,16 @@ namespace ProjectNomad {
         * @param desiredHorizontalDir - Desired direction that FPQuat should rotate a FPVector::forward() direction is.
         *                               Should have no vertical (z) component and expected to be normalized.
         * @returns "Yaw"-only quaternion representing the input direction
+        * See QuatUtilities::FromYawDirection for a faster trig-free alternative (with slightly different results)
         **/
-        static FQuatFP HorizontalDirVectorToYawOnlyQuat(const FVectorFP& desiredHorizontalDir) {
+        static constexpr FQuatFP HorizontalDirVectorToYawOnlyQuat(const FVectorFP& desiredHorizontalDir) {
             // Approach: Basically take dirVectorToQuat() but use constant rotation axis and reference axis
             
             /// Define some constants for clarity. Theoretically could replace these for other use cases in future.
             // Result rotation axis: This is the "yaw-only" part
-            static const FVectorFP kRotationAxis = FVectorFP::Up();
+            constexpr FVectorFP kRotationAxis = FVectorFP::Up();
             // Reference axis: Want to be explicit that the output is as if applied to this vector (which is the game's standard)
-            static const FVectorFP kReferenceAxis = FVectorFP::Forward();
+            constexpr FVectorFP kReferenceAxis = FVectorFP::Forward();
 
             // Rotation amount around axis: Get angle between the vectors.
             //   Note: Due to both being in horizontal plane (and perpendicular to vertical axis), this represents yaw
@@ -228,7 +231,7 @@ namespace ProjectNomad {
         /// </summary>
         /// <param name="alpha">Control value. Should be 0 to 1 (but outside values are still valid)</param>
         /// <returns>Returns a value 0 to 1 based on alpha</returns>
-        static fp bezierBlend(const fp& alpha) {
+        static constexpr fp bezierBlend(const fp& alpha) {
             fp val3 = fp{3};
             fp val2 = fp{2};
             return alpha * alpha * (val3 - val2 * alpha);
@@ -240,7 +243,7 @@ namespace ProjectNomad {
         /// </summary>
         /// <param name="alpha">Control value. Should be 0 to 1 (but outside values are still valid)</param>
         /// <returns>Returns a value 0 to 1 based on alpha</returns>
-        static fp parametricBlend(const fp& alpha) {
+        static constexpr fp parametricBlend(const fp& alpha) {
             fp val1 = fp{1};
             fp val2 = fp{2};
             fp sqAlpha = alpha * alpha;
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+#include "Math/FixedPoint.h"
+#include "Utilities/Assertion.h"
+
+namespace ProjectNomad {
+    // Newton's method seeds, generated at compile time with integer math so they're identical on every platform
+    namespace FPRsqrtTables {
+        // Digit by digit integer square root (floor). Exact but far too slow for runtime use
+        constexpr uint64_t SqrtIntegerExact(uint64_t value) {
+            uint64_t result = 0;
+            uint64_t bit = uint64_t{1} << 62;
+            while (bit > value) {
+                bit >>= 2;
+            }
+
+            while (bit != 0) {
+                if (value >= result + bit) {
+                    value -= result + bit;
+                    result = (result >> 1) + bit;
+                }
+                else {
+                    result >>= 1;
+                }
+                bit >>= 2;
+            }
+            return result;
+        }
+
+        // Inputs are normalized to [2^62, 2^64), so top 8 bits (64 to 255) pick the seed
+        constexpr int kSeedShift = 56;
+        constexpr uint64_t kMinSeedIndex = 64;
+        using SeedTable = std::array<uint32_t, 256 - kMinSeedIndex>;
+
+        // 1 / sqrt(x) with 30 fraction bits at the middle of each seed's range, where x = (index + 0.5) / 256
+        //      ie, sqrt(2^60 * 512 / (2 * index + 1)), calculated as sqrt(2^63 / (2 * index + 1)) * 8
+        constexpr SeedTable GenerateSeedTable() {
+            SeedTable table{};
+            for (uint64_t i = kMinSeedIndex; i < 256; i++) {
+                table[i - kMinSeedIndex] = static_cast<uint32_t>(SqrtIntegerExact((uint64_t{1} << 63) / (2 * i + 1)) * 8);
+            }
+            return table;
+        }
+
+        inline constexpr SeedTable kSeedTable = GenerateSeedTable();
+    }
+
+    /// <summary>
+    /// Deterministic integer reciprocal square root, via a table seed and two Newton steps (no division at all).
+    /// Result is kept as mantissa and shift rather than as fp, as 1 / sqrt(x) for large x has few significant bits
+    ///     in fixed point. Multiplying by the mantissa and shifting afterwards keeps full precision, which is what
+    ///     makes FVectorFP::NormalizedFast both faster and more accurate than dividing by length.
+    /// Relative error of the mantissa is below 2^-28, which is far below fp precision.
+    /// </summary>
+    class FPRsqrt {
+      public:
+        FPRsqrt() = delete;
+
+        // 1 / sqrt(value) == mantissa / 2^shift, with mantissa in roughly (2^30, 2^31]
+        struct Result {
+            uint64_t mantissa = 0;
+            int shift = 0;
+        };
+
+        static constexpr Result Calculate(uint64_t value) {
+            using namespace FPRsqrtTables;
+            assertm(value > 0, "Reciprocal square root is undefined for 0");
+            if (value == 0) {
+                return {};
+            }
+
+            // Normalize by an even shift so that sqrt can be undone by shifting half as much
+            int normalizeShift = std::countl_zero(value) & ~1;
+            uint64_t normalized = value << normalizeShift;
+            uint64_t scaledValue = normalized >> 32; // Normalized value as a fraction in [0.25, 1) with 32 fraction bits
+
+            // y' = y * (3 - x * y^2) / 2, with y having 30 fraction bits. Seed is within 0.4% and each step squares
+            //      relative error, so two steps are plenty
+            uint64_t y = kSeedTable[(normalized >> kSeedShift) - kMinSeedIndex];
+            for (int i = 0; i < 2; i++) {
+                uint64_t ySquared = (y * y) >> 30;
+                uint64_t xYSquared = (scaledValue * ySquared) >> 32;
+                y = (y * ((uint64_t{3} << 30) - xYSquared)) >> 31;
+            }
+
+            // 1 / sqrt(value) = y / 2^30 / sqrt(normalized / 2^64) / 2^32 * 2^(normalizeShift / 2)
+            return {y, 62 - normalizeShift / 2};
+        }
+
+        // Rounded sqrt(value), given the already calculated reciprocal square root of the same value
+        static constexpr uint64_t CalculateRoot(uint64_t value, const Result& inverse) {
+            if (value == 0) {
+                return 0;
+            }
+
+            // sqrt(value) = value / sqrt(value). Value is first normalized to 32 bits to keep product within 64 bits
+            int normalizeShift = 62 - inverse.shift;
+            uint64_t scaledValue = (value << (2 * normalizeShift)) >> 32;
+            int resultShift = 30 + normalizeShift;
+            return (scaledValue * inverse.mantissa + (uint64_t{1} << (resultShift - 1))) >> resultShift;
+        }
+
+        static constexpr uint64_t Sqrt(uint64_t value) {
+            return value == 0 ? 0 : CalculateRoot(value, Calculate(value));
+        }
+
+        /**
+        * Rounded value * (1 / sqrt(x)) * 2^extraFractionBits, where inverse is the result of Calculate(x).
+        * Rounds half away from zero, same as fp multiplication.
+        **/
+        static constexpr int64_t MultiplyRaw(int64_t value, const Result& inverse, int extraFractionBits) {
+            uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+
+            // Drop low bits of large values so product fits in 64 bits. Relative error stays below 2^-31
+            int shift = inverse.shift - extraFractionBits;
+            int dropBits = std::bit_width(magnitude) > 32 ? std::bit_width(magnitude) - 32 : 0;
+            magnitude >>= dropBits;
+            shift -= dropBits;
+            assertm(shift > 0, "Result of reciprocal square root multiply is too large for fixed point");
+            if (shift <= 0) {
+                return 0;
+            }
+
+            uint64_t result = (magnitude * inverse.mantissa + (uint64_t{1} << (shift - 1))) >> shift;
+            return value < 0 ? -static_cast<int64_t>(result) : static_cast<int64_t>(result);
+        }
+
+        /**
+        * Scales raw fp components (eg, of a vector or quat) to unit length, without any division.
+        * Shared by FVectorFP::NormalizedFast, FQuatFP::Normalized and similar.
+        * @param components - raw fp values, which are replaced with the raw fp values of the normalized result
+        * @param outLength - optional raw fp length of the original components
+        * @returns false (and leaves components as is) if all components are zero
+        **/
+        template <size_t N>
+        static constexpr bool NormalizeRaw(int64_t (&components)[N], int64_t* outLength = nullptr) {
+            uint64_t magnitudes[N];
+            int dropBits = 0;
+            uint64_t sumOfSquares = CalculateSumOfSquaresRaw(components, magnitudes, dropBits);
+            if (sumOfSquares == 0) {
+                return false;
+            }
+
+            // Sum of squares has 32 fraction bits, so 1 / length needs 16 more bits to be fp
+            Result inverseLength = Calculate(sumOfSquares);
+            for (size_t i = 0; i < N; i++) {
+                int64_t magnitude = MultiplyRaw(static_cast<int64_t>(magnitudes[i]), inverseLength, 16);
+                components[i] = components[i] < 0 ? -magnitude : magnitude;
+            }
+
+            if (outLength) {
+                *outLength = static_cast<int64_t>(CalculateRoot(sumOfSquares, inverseLength) << dropBits);
+            }
+            return true;
+        }
+
+        // Rounded length of raw fp components, ie sqrt of the sum of their squares (as raw fp)
+        template <size_t N>
+        static constexpr int64_t LengthRaw(const int64_t (&components)[N]) {
+            uint64_t magnitudes[N];
+            int dropBits = 0;
+            uint64_t sumOfSquares = CalculateSumOfSquaresRaw(components, magnitudes, dropBits);
+
+            // Sum of squares has 32 fraction bits, so its root has 16 (ie, is already fp)
+            return static_cast<int64_t>(Sqrt(sumOfSquares) << dropBits);
+        }
+
+      private:
+        /**
+        * Squares are summed as exact integers, as fixed point multiplies would round away most of a short vector's
+        *   length squared. Magnitudes are first scaled down to 30 bits if needed, so that sum of up to 4 squares fits.
+        * @param outMagnitudes - absolute value of each component, after scaling down by outDropBits
+        **/
+        template <size_t N>
+        static constexpr uint64_t CalculateSumOfSquaresRaw(const int64_t (&components)[N],
+                                                           uint64_t (&outMagnitudes)[N],
+                                                           int& outDropBits) {
+            static_assert(N <= 4, "Sum of squares of more than 4 components may not fit in 64 bits");
+
+            uint64_t maxMagnitude = 0;
+            for (size_t i = 0; i < N; i++) {
+                outMagnitudes[i] = components[i] < 0 ? 0 - static_cast<uint64_t>(components[i])
+                                                     : static_cast<uint64_t>(components[i]);
+                maxMagnitude = outMagnitudes[i] > maxMagnitude ? outMagnitudes[i] : maxMagnitude;
+            }
+
+            outDropBits = std::bit_width(maxMagnitude) > 30 ? std::bit_width(maxMagnitude) - 30 : 0;
+            uint64_t sumOfSquares = 0;
+            for (size_t i = 0; i < N; i++) {
+                outMagnitudes[i] >>= outDropBits;
+                sumOfSquares += outMagnitudes[i] * outMagnitudes[i];
+            }
+            return sumOfSquares;
+        }
+    };
+}
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "Math/FixedPoint.h"
+#include "Math/FPRsqrt.h"
+#include "Utilities/Assertion.h"
+
+namespace ProjectNomad {
+    // Lookup table generation, done entirely at compile time with integer math so that tables are identical across
+    //      every compiler and platform. Values use 30 fraction bits ("Q30") so interpolation error stays well below
+    //      the 16 fraction bits of fp.
+    namespace FPTrigLookupTables {
+        constexpr int kTableFractionBits = 30;
+        constexpr int64_t kOneQ30 = int64_t{1} << kTableFractionBits;
+        constexpr int64_t kPiQ30 = 3373259426; // round(pi * 2^30)
+        constexpr int64_t kHalfPiQ30 = 1686629713; // round(pi / 2 * 2^30)
+
+        // Every table covers its domain with this many linearly interpolated segments
+        constexpr int kSegmentBits = 9;
+        constexpr int32_t kSegmentCount = 1 << kSegmentBits;
+        using Table = std::array<int32_t, kSegmentCount + 1>;
+
+        // Only used for non-negative values whose product fits in 63 bits
+        constexpr int64_t MultiplyQ30(int64_t a, int64_t b) {
+            return (a * b + (kOneQ30 >> 1)) >> kTableFractionBits;
+        }
+
+        // Taylor series, for x in [0, pi/2]
+        constexpr int64_t SinSeries(int64_t x) {
+            int64_t xSquared = MultiplyQ30(x, x);
+            int64_t term = x;
+            int64_t sum = x;
+            for (int64_t k = 1; term != 0; k++) {
+                term = MultiplyQ30(term, xSquared) / ((2 * k) * (2 * k + 1));
+                sum += k % 2 == 1 ? -term : term;
+            }
+            return sum;
+        }
+
+        // Taylor series, for x in [0, 0.5]
+        constexpr int64_t AsinSeries(int64_t x) {
+            int64_t xSquared = MultiplyQ30(x, x);
+            int64_t term = x; // (2k)! / (4^k * (k!)^2) * x^(2k + 1)
+            int64_t sum = x;
+            for (int64_t k = 1; term != 0; k++) {
+                term = MultiplyQ30(term, xSquared) * (2 * k - 1) / (2 * k);
+                sum += term / (2 * k + 1);
+            }
+            return sum;
+        }
+
+        // Euler's series, for x in [0, 0.5]. All terms are positive and shrink by at least 5x each step at x = 0.5
+        constexpr int64_t AtanSeries(int64_t x) {
+            int64_t xSquared = MultiplyQ30(x, x);
+            int64_t onePlusXSquared = kOneQ30 + xSquared;
+            int64_t ratio = (xSquared << kTableFractionBits) / onePlusXSquared; // x^2 / (1 + x^2)
+            int64_t term = (x << kTableFractionBits) / onePlusXSquared;
+            int64_t sum = term;
+            for (int64_t k = 1; term != 0; k++) {
+                term = MultiplyQ30(term, ratio) * (2 * k) / (2 * k + 1);
+                sum += term;
+            }
+            return sum;
+        }
+
+        // For x in [0, 1], using atan(x) = atan(0.5) + atan((x - 0.5) / (1 + x / 2)) above 0.5 to keep series short
+        constexpr int64_t Atan(int64_t x) {
+            constexpr int64_t kHalf = kOneQ30 >> 1;
+            if (x <= kHalf) {
+                return AtanSeries(x);
+            }
+
+            int64_t reduced = ((x - kHalf) << kTableFractionBits) / (kOneQ30 + (x >> 1));
+            return AtanSeries(kHalf) + AtanSeries(reduced);
+        }
+
+        // sin over [0, pi/2]
+        constexpr Table GenerateSinTable() {
+            Table table{};
+            for (int32_t i = 0; i <= kSegmentCount; i++) {
+                table[i] = static_cast<int32_t>(SinSeries(kHalfPiQ30 * i / kSegmentCount));
+            }
+            return table;
+        }
+
+        // asin over [0, 0.5]
+        constexpr Table GenerateAsinTable() {
+            Table table{};
+            for (int32_t i = 0; i <= kSegmentCount; i++) {
+                table[i] = static_cast<int32_t>(AsinSeries((kOneQ30 >> 1) * i / kSegmentCount));
+            }
+            return table;
+        }
+
+        // atan over [0, 1]
+        constexpr Table GenerateAtanTable() {
+            Table table{};
+            for (int32_t i = 0; i <= kSegmentCount; i++) {
+                table[i] = static_cast<int32_t>(Atan(kOneQ30 * i / kSegmentCount));
+            }
+            return table;
+        }
+
+        inline constexpr Table kSinTable = GenerateSinTable();
+        inline constexpr Table kAsinTable = GenerateAsinTable();
+        inline constexpr Table kAtanTable = GenerateAtanTable();
+    }
+
+    /// <summary>
+    /// Interpolated lookup table trig functions (in radians), as a faster and more accurate alternative to the fpm
+    ///     approximations used by FPMath. Lookups are integer-only, so results are deterministic on every platform.
+    ///
+    /// Accuracy: every result is within 0.6 LSB (LSB = 2^-16, ~0.000015) of the exact value, versus up to ~60 LSB for
+    ///     the fpm versions. See FPTrigLookupTests for the measured error of each function.
+    /// FPMath uses these when NOMAD_USE_TRIG_LOOKUP is defined as 1.
+    /// </summary>
+    class FPTrigLookup {
+      public:
+        FPTrigLookup() = delete;
+
+        static constexpr fp sin(fp radians) {
+            return fp::from_raw_value(SinFromQuarterTurns(ToSegmentPosition(radians)));
+        }
+
+        static constexpr fp cos(fp radians) {
+            constexpr int64_t kQuarterTurn = int64_t{FPTrigLookupTables::kSegmentCount} << kFractionBits;
+            return fp::from_raw_value(SinFromQuarterTurns(ToSegmentPosition(radians) + kQuarterTurn));
+        }
+
+        // Input is clamped to [-1, 1]
+        static constexpr fp asin(fp value) {
+            int64_t result = AsinQ30(value);
+            return fp::from_raw_value(result < 0 ? -RoundQ30(-result) : RoundQ30(result));
+        }
+
+        // Input is clamped to [-1, 1]
+        static constexpr fp acos(fp value) {
+            return fp::from_raw_value(RoundQ30(FPTrigLookupTables::kHalfPiQ30 - AsinQ30(value)));
+        }
+
+        // Returns angle in [-pi, pi]. Same conventions as fpm::atan2, including asserting that y and x aren't both 0
+        static constexpr fp atan2(fp y, fp x) {
+            using namespace FPTrigLookupTables;
+
+            if (x == fp{0} && y == fp{0}) {
+                assertm(false, "atan2 is undefined when both inputs are 0");
+                return fp{0};
+            }
+
+            uint64_t xMagnitude = GetMagnitude(x.raw_value());
+            uint64_t yMagnitude = GetMagnitude(y.raw_value());
+            uint64_t larger = xMagnitude > yMagnitude ? xMagnitude : yMagnitude;
+            uint64_t smaller = xMagnitude > yMagnitude ? yMagnitude : xMagnitude;
+
+            // Keep ratio calculation within 64 bits. Only loses precision for values beyond 2^16
+            int shift = std::bit_width(larger) > 32 ? std::bit_width(larger) - 32 : 0;
+            larger >>= shift;
+            smaller >>= shift;
+
+            uint64_t ratio = ((smaller << kTableFractionBits) + larger / 2) / larger;
+            int64_t angle = Interpolate(kAtanTable, static_cast<int64_t>(ToPosition(ratio)));
+            if (yMagnitude > xMagnitude) {
+                angle = kHalfPiQ30 - angle;
+            }
+            if (x < fp{0}) {
+                angle = kPiQ30 - angle;
+            }
+
+            int64_t result = RoundQ30(angle);
+            return fp::from_raw_value(y < fp{0} ? -result : result);
+        }
+
+      private:
+        static constexpr int kFractionBits = 16;
+        static_assert(fp{1}.raw_value() == int64_t{1} << kFractionBits, "Lookups assume fp has 16 fraction bits");
+        static constexpr int kQ30ToSegmentShift =
+            FPTrigLookupTables::kTableFractionBits - FPTrigLookupTables::kSegmentBits - kFractionBits;
+
+        static constexpr uint64_t GetMagnitude(int64_t value) {
+            return value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value);
+        }
+
+        static constexpr int64_t RoundQ30(int64_t value) {
+            constexpr int kShift = FPTrigLookupTables::kTableFractionBits - kFractionBits;
+            return (value + (int64_t{1} << (kShift - 1))) >> kShift;
+        }
+
+        // Converts a Q30 value in [0, 1] to table position, ie segment index with 16 fraction bits
+        static constexpr uint64_t ToPosition(uint64_t valueQ30) {
+            return (valueQ30 + (uint64_t{1} << (kQ30ToSegmentShift - 1))) >> kQ30ToSegmentShift;
+        }
+
+        // Position is segment index with 16 fraction bits, clamped to end of table
+        static constexpr int64_t Interpolate(const FPTrigLookupTables::Table& table, int64_t position) {
+            int64_t index = position >> kFractionBits;
+            if (index >= FPTrigLookupTables::kSegmentCount) {
+                return table[FPTrigLookupTables::kSegmentCount];
+            }
+
+            int64_t fraction = position & ((int64_t{1} << kFractionBits) - 1);
+            int64_t delta = static_cast<int64_t>(table[index + 1]) - table[index];
+            return table[index] + ((delta * fraction + (int64_t{1} << (kFractionBits - 1))) >> kFractionBits);
+        }
+
+        /**
+        * Converts angle to sin table positions, where every table length is one quarter turn. Only the position
+        *   within a full turn matters, which is just the low bits of angle * segments per radian. Thus unsigned
+        *   wraparound multiply gives exact results without needing a (less accurate) modulo by 2pi first.
+        **/
+        static constexpr int64_t ToSegmentPosition(fp radians) {
+            constexpr uint64_t kSegmentsPerRadianQ32 = 1399941684381; // round(4 * kSegmentCount / (2 * pi) * 2^32)
+            constexpr uint64_t kFullTurnMask = (uint64_t{1} << (FPTrigLookupTables::kSegmentBits + 2 + kFractionBits)) - 1;
+
+            uint64_t scaled = static_cast<uint64_t>(radians.raw_value()) * kSegmentsPerRadianQ32 + (uint64_t{1} << 31);
+            return static_cast<int64_t>((scaled >> 32) & kFullTurnMask);
+        }
+
+        static constexpr int64_t SinFromQuarterTurns(int64_t position) {
+            constexpr int kQuarterTurnBits = FPTrigLookupTables::kSegmentBits + kFractionBits;
+            constexpr int64_t kQuarterTurn = int64_t{1} << kQuarterTurnBits;
+
+            int64_t quadrant = (position >> kQuarterTurnBits) & 3;
+            int64_t offset = position & (kQuarterTurn - 1);
+            if (quadrant % 2 == 1) { // sin is mirrored in second and fourth quadrants
+                offset = kQuarterTurn - offset;
+            }
+
+            int64_t result = RoundQ30(Interpolate(FPTrigLookupTables::kSinTable, offset));
+            return quadrant >= 2 ? -result : result;
+        }
+
+        // Returns asin in Q30, so acos can be derived before rounding
+        static constexpr int64_t AsinQ30(fp value) {
+            using namespace FPTrigLookupTables;
+            constexpr int64_t kOne = int64_t{1} << kFractionBits;
+
+            int64_t magnitude = static_cast<int64_t>(GetMagnitude(value.raw_value()));
+            assertm(magnitude <= kOne, "asin/acos input should be within [-1, 1]");
+            if (magnitude > kOne) {
+                magnitude = kOne;
+            }
+
+            int64_t result;
+            if (magnitude <= kOne / 2) {
+                // Table covers [0, 0.5], so position is value * 2 * kSegmentCount
+                result = Interpolate(kAsinTable, magnitude << (kSegmentBits + 1));
+            }
+            else {
+                // asin(x) = pi/2 - 2 * asin(sqrt((1 - x) / 2)), as asin's slope approaches infinity near 1
+                // (1 - x) / 2 in 60 fraction bits is (1 - x) in 16 bits shifted by 43, and its sqrt has 30 fraction bits
+                uint64_t halfComplement = static_cast<uint64_t>(kOne - magnitude) << (2 * kTableFractionBits - kFractionBits - 1);
+                uint64_t root = FPRsqrt::Sqrt(halfComplement);
+                result = kHalfPiQ30 - 2 * Interpolate(kAsinTable, static_cast<int64_t>(ToPosition(root << 1)));
+            }
+
+            return value < fp{0} ? -result : result;
+        }
+    };
+}
@@ -2,6 +2,7 @@
 
 // #include <ostream>
 
+#include "FPMath.h"
 #include "FVectorFP.h"
 #include "fpm/FixedPoint.h"
 
@@ -24,20 +25,87 @@ struct THENOMADGAME_API FQuatFP {
     UPROPERTY(EditAnywhere)
     FVectorFP v;
 
-    FQuatFP() : w(FFixedPoint{0}), v(FFixedPoint{0}, FFixedPoint{0}, FFixedPoint{0}) {}
-    FQuatFP(FFixedPoint w, FVectorFP vector) : w(w), v(vector) {}
+    constexpr FQuatFP() : w(FFixedPoint{0}), v(FFixedPoint{0}, FFixedPoint{0}, FFixedPoint{0}) {}
+    constexpr FQuatFP(FFixedPoint w, FVectorFP vector) : w(w), v(vector) {}
 
     // Building a quaternion from an axis-angle rotation.
-    static FQuatFP fromRadians(const FVectorFP& n, FFixedPoint angleInRadians);
-    static FQuatFP fromDegrees(const FVectorFP& n, FFixedPoint angleInDegrees);
+    // http://youtu.be/SCbpxiCN0U0
+    static constexpr FQuatFP fromRadians(const FVectorFP& n, FFixedPoint angleInRadians) {
+        // TODO: Debug assert if n is not normal
 
-    static FQuatFP identity();
-    FQuatFP inverted() const;
+        FFixedPoint w = ProjectNomad::FPMath::cosR(angleInRadians / 2);
+        FVectorFP v = n * ProjectNomad::FPMath::sinR(angleInRadians / 2);
+
+        return FQuatFP(w, v);
+    }
+
+    static constexpr FQuatFP fromDegrees(const FVectorFP& n, FFixedPoint angleInDegrees) {
+        return fromRadians(n, ProjectNomad::FPMath::degreesToRadians(angleInDegrees));
+    }
+
+    static constexpr FQuatFP identity() {
+        return FQuatFP(FFixedPoint{1}, FVectorFP(FFixedPoint{0}, FFixedPoint{0}, FFixedPoint{0}));
+    }
+
+    // http://youtu.be/A6A0rpV9ElA
+    // ASSUMING unit quaternion! Everything here pretty much assumes that to be fair...
+    constexpr FQuatFP inverted() const {
+        return FQuatFP(w, -v);
+    }
+
+    constexpr FFixedPoint Dot(const FQuatFP& q) const {
+        return w * q.w + v.Dot(q.v);
+    }
+
+    constexpr FFixedPoint GetLengthSquared() const {
+        return Dot(*this);
+    }
+
+    // Rescales to unit length, eg to remove drift after many multiplications. Zero quat results in identity.
+    // Same approach as FVectorFP::NormalizedFast (see FPRsqrt::NormalizeRaw)
+    constexpr FQuatFP Normalized() const {
+        int64_t components[4] = {w.raw_value(), v.x.raw_value(), v.y.raw_value(), v.z.raw_value()};
+        if (!ProjectNomad::FPRsqrt::NormalizeRaw(components)) {
+            return identity();
+        }
+
+        return FQuatFP(
+            FFixedPoint::from_raw_value(components[0]),
+            FVectorFP(FFixedPoint::from_raw_value(components[1]),
+                      FFixedPoint::from_raw_value(components[2]),
+                      FFixedPoint::from_raw_value(components[3]))
+        );
+    }
+
+    constexpr void Normalize() {
+        *this = Normalized();
+    }
 
     // Multiplying two quaternions together combines the rotations.
-    FQuatFP operator*(const FQuatFP& q) const;
+    // http://youtu.be/CRiR2eY5R_s
+    constexpr FQuatFP operator*(const FQuatFP& q) const {
+        FQuatFP result;
+
+        result.w = w * q.w + v.Dot(q.v);
+        result.v = v * q.w + q.v * w + v.Cross(q.v);
+
+        return result;
+    }
+
     // Rotate a vector with this quaternion.
-    FVectorFP operator*(const FVectorFP& input) const;
+    // http://youtu.be/Ne3RNhEVSIE
+    // The basic equation is qpq* (the * means inverse) but we use a simplified version of that equation.
+    constexpr FVectorFP operator*(const FVectorFP& input) const {
+        // Could do it this way:
+        /*
+        const Quaternion& q = (*this);
+        return (q * p * q.Inverted()).v;
+        */
+
+        // But let's optimize it a bit instead.
+        FVectorFP vCrossInput = v.Cross(input);
+        return input + vCrossInput * (2 * w) + v.Cross(vCrossInput) * FFixedPoint{2};
+    }
 
     auto operator<=>(const FQuatFP&) const = default;
     
@@ -2,23 +2,56 @@
 
 #include <CRCpp/CRC.h>
 #include "FPMath.h"
+#include "FPRsqrt.h"
 
-FFixedPoint FVectorFP::GetLength() const {
-    return ProjectNomad::FPMath::sqrt(GetLengthSquared());
+namespace {
+    /**
+    * Shared by the fast normalize functions. See FPRsqrt::NormalizeRaw
+    * @param outLength optional, as calculating length is an extra step
+    * @returns false if vector is zero
+    **/
+    bool CalculateDirection(const FVectorFP& vector, FVectorFP& outDirection, FFixedPoint* outLength) {
+        int64_t components[3] = {vector.x.raw_value(), vector.y.raw_value(), vector.z.raw_value()};
+        int64_t length = 0;
+        if (!ProjectNomad::FPRsqrt::NormalizeRaw(components, outLength ? &length : nullptr)) {
+            return false;
+        }
+
+        outDirection = FVectorFP(
+            FFixedPoint::from_raw_value(components[0]),
+            FFixedPoint::from_raw_value(components[1]),
+            FFixedPoint::from_raw_value(components[2])
+        );
+        if (outLength) {
+            *outLength = FFixedPoint::from_raw_value(length);
+        }
+        return true;
+    }
+}
+
+FVectorFP FVectorFP::NormalizedFast() const {
+    FVectorFP direction;
+    if (!CalculateDirection(*this, direction, nullptr)) {
+        return Zero();
+    }
+    return direction;
 }
 
-FFixedPoint FVectorFP::operator[](int i) const {
-    switch (i) {
-        case 0:
-            return x;
-        case 1:
-            return y;
-        case 2:
-            return z;
-        default:
-            // TODO: Throw error!
-            return ProjectNomad::FPMath::minLimit();
+FFixedPoint FVectorFP::NormalizeAndGetLength() {
+    FFixedPoint length;
+    if (!CalculateDirection(*this, *this, &length)) {
+        return FFixedPoint{0};
     }
+    return length;
+}
+
+bool FVectorFP::SafeNormalize(FFixedPoint toleranceSquared) {
+    if (GetLengthSquared() <= toleranceSquared) {
+        return false;
+    }
+
+    *this = NormalizedFast();
+    return true;
 }
 
 bool FVectorFP::IsNear(const FVectorFP& other, const FFixedPoint& positiveErrorRange) {
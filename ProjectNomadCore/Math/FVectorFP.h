@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fpm/FixedPoint.h>
+#include "FPMath.h"
 
 #if WITH_ENGINE // Use following necessary includes if in Unreal context
 #include "CoreMinimal.h"
@@ -71,7 +72,9 @@ struct THENOMADGAME_API FVectorFP {
         return x * x + y * y + z * z;
     }
     
-    FFixedPoint GetLength() const;
+    constexpr FFixedPoint GetLength() const {
+        return ProjectNomad::FPMath::sqrt(GetLengthSquared());
+    }
 
     constexpr FVectorFP operator-() const {
         return {-x, -y, -z};
@@ -109,11 +112,23 @@ struct THENOMADGAME_API FVectorFP {
         return {x / value, y / value, z / value};
     }
 
-    FFixedPoint operator[](int i) const;
+    constexpr FFixedPoint operator[](int i) const {
+        switch (i) {
+            case 0:
+                return x;
+            case 1:
+                return y;
+            case 2:
+                return z;
+            default:
+                // TODO: Throw error!
+                return ProjectNomad::FPMath::minLimit();
+        }
+    }
     
     auto operator<=>(const FVectorFP&) const = default;
 
-    FVectorFP Normalized() const {
+    constexpr FVectorFP Normalized() const {
         auto length = GetLength();
 
         // IDEA: Likely far better to log and/or assert as likely unexpected scenario
@@ -125,15 +140,31 @@ struct THENOMADGAME_API FVectorFP {
         return *this / length;
     }
 
-    void Normalize() {
+    constexpr void Normalize() {
         *this = Normalized();
     }
 
-    FVectorFP Flipped() const {
+    /**
+     * Same as Normalized, but multiplies by a reciprocal square root (see FPRsqrt) rather than using sqrt and divides.
+     * Faster and more precise (especially for short vectors), but results may differ from Normalized by 1 LSB.
+     */
+    FVectorFP NormalizedFast() const;
+
+    // Normalizes in place like NormalizedFast, and returns length prior to normalizing (0 if vector is zero)
+    FFixedPoint NormalizeAndGetLength();
+
+    /**
+     * Normalizes in place like NormalizedFast, unless vector is too short to have a meaningful direction.
+     * @param toleranceSquared vector is left as-is if its length squared is at most this value
+     * @returns false if vector was too short to normalize
+     */
+    bool SafeNormalize(FFixedPoint toleranceSquared = FFixedPoint{1.e-4f});
+
+    constexpr FVectorFP Flipped() const {
         return *this * FFixedPoint{-1};
     }
 
-    void Flip() {
+    constexpr void Flip() {
         *this = Flipped();
     }
 
@@ -0,0 +1,69 @@
+#include "FixedPointOverflowTracker.h"
+
+#if defined(_WIN32)
+#if WITH_ENGINE
+#include "Windows/AllowWindowsPlatformTypes.h"
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#if WITH_ENGINE
+#include "Windows/HideWindowsPlatformTypes.h"
+#endif
+#elif __has_include(<execinfo.h>)
+#include <execinfo.h>
+#endif
+
+#if defined(_MSC_VER)
+#define NOMAD_NOINLINE __declspec(noinline)
+#else
+#define NOMAD_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+    // Skips Report's own frame, which is why Report must never be inlined
+    NOMAD_NOINLINE uint32_t CaptureCallStack(const void** result, uint32_t maxDepth) {
+        constexpr uint32_t kSkippedFrames = 2; // This function and Report
+#if defined(_WIN32)
+        return CaptureStackBackTrace(kSkippedFrames, maxDepth, const_cast<void**>(result), nullptr);
+#elif __has_include(<execinfo.h>)
+        void* frames[kSkippedFrames + ProjectNomad::FixedPointOverflowRecord::kMaxCallStackDepth];
+        int depth = backtrace(frames, static_cast<int>(kSkippedFrames + maxDepth));
+        uint32_t resultDepth = 0;
+        for (int i = kSkippedFrames; i < depth; i++) {
+            result[resultDepth++] = frames[i];
+        }
+        return resultDepth;
+#else
+        // No stack walking available, so settle for Report's direct caller
+        result[0] = __builtin_return_address(1);
+        return 1;
+#endif
+    }
+}
+
+namespace ProjectNomad {
+    NOMAD_NOINLINE void FixedPointOverflowTracker::Report(FixedPointOperation operation,
+                                                          int64_t lhsRaw, int64_t rhsRaw) {
+        mCounts[static_cast<size_t>(operation)].fetch_add(1, std::memory_order_relaxed);
+
+        // Check before claiming a slot so the index can't keep growing (and eventually wrap) once buffer is full
+        if (mNextSlot.load(std::memory_order_relaxed) >= kMaxRecordedOverflows) {
+            return;
+        }
+        uint32_t slotIndex = mNextSlot.fetch_add(1, std::memory_order_relaxed);
+        if (slotIndex >= kMaxRecordedOverflows) {
+            return;
+        }
+
+        // Slot is exclusively owned by this call from here on, so only needs publishing once fully written
+        Slot& slot = mSlots[slotIndex];
+        slot.record.operation = operation;
+        slot.record.lhsRaw = lhsRaw;
+        slot.record.rhsRaw = rhsRaw;
+        slot.record.callStackDepth = CaptureCallStack(slot.record.callStack,
+                                                      FixedPointOverflowRecord::kMaxCallStackDepth);
+        slot.isPublished.store(true, std::memory_order_release);
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace ProjectNomad {
+    enum class FixedPointOperation : uint8_t {
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        DivideByZero,
+        Count // Not an operation, just number of entries above
+    };
+
+    inline const char* FixedPointOperationToString(FixedPointOperation operation) {
+        switch (operation) {
+            case FixedPointOperation::Add:          return "Add";
+            case FixedPointOperation::Subtract:     return "Subtract";
+            case FixedPointOperation::Multiply:     return "Multiply";
+            case FixedPointOperation::Divide:       return "Divide";
+            case FixedPointOperation::DivideByZero: return "DivideByZero";
+            default:                                return "Unknown";
+        }
+    }
+
+    struct FixedPointOverflowRecord {
+        static constexpr uint32_t kMaxCallStackDepth = 8;
+
+        FixedPointOperation operation = FixedPointOperation::Count;
+        int64_t lhsRaw = 0;
+        int64_t rhsRaw = 0; // Raw value of fp operand, or value as-is for integer operand
+        // Return addresses starting from the code which performed the operation. More than one frame as unoptimized
+        //      builds don't inline fp operators, so first few frames are the operators themselves.
+        //      Resolve with a debugger or symbolizer, eg addr2line -f -C -e <binary> <address - load address>
+        const void* callStack[kMaxCallStackDepth] = {};
+        uint32_t callStackDepth = 0;
+    };
+
+    /// <summary>
+    /// Counts fixed point overflows and division by zero detected by FFixedPoint's checked arithmetic mode
+    /// (NOMAD_CHECKED_FIXED_POINT), and keeps the operands and call site of the first kMaxRecordedOverflows.
+    /// Safe to report into from any number of threads without locking. Nothing reports here in unchecked builds.
+    /// </summary>
+    class FixedPointOverflowTracker {
+      public:
+        static constexpr uint32_t kMaxRecordedOverflows = 64;
+
+        FixedPointOverflowTracker() = delete;
+
+        /**
+        * Counts an overflow and records it (including call stack) if there's still space.
+        * Defined out of line so checked fp operators stay small, and only the first few reports pay for a stack walk
+        **/
+        static void Report(FixedPointOperation operation, int64_t lhsRaw, int64_t rhsRaw);
+
+        static uint64_t GetCount(FixedPointOperation operation) {
+            return mCounts[static_cast<size_t>(operation)].load(std::memory_order_relaxed);
+        }
+
+        static uint64_t GetTotalCount() {
+            uint64_t total = 0;
+            for (const std::atomic<uint64_t>& count : mCounts) {
+                total += count.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+        /**
+        * Copies out a recorded overflow, in the order they were reported
+        * @returns false if index isn't recorded (yet), such as if another thread is still writing it
+        **/
+        static bool TryGetRecord(uint32_t index, FixedPointOverflowRecord& result) {
+            if (index >= kMaxRecordedOverflows || !mSlots[index].isPublished.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            result = mSlots[index].record;
+            return true;
+        }
+
+        static uint32_t GetRecordedCount() {
+            uint32_t recordedCount = 0;
+            while (recordedCount < kMaxRecordedOverflows
+                   && mSlots[recordedCount].isPublished.load(std::memory_order_acquire)) {
+                recordedCount++;
+            }
+            return recordedCount;
+        }
+
+        // Not safe to call while other threads may still be reporting, eg only call between tests or simulation runs
+        static void Reset() {
+            for (std::atomic<uint64_t>& count : mCounts) {
+                count.store(0, std::memory_order_relaxed);
+            }
+            for (Slot& slot : mSlots) {
+                slot.isPublished.store(false, std::memory_order_relaxed);
+            }
+            mNextSlot.store(0, std::memory_order_release);
+        }
+
+        static std::string ToString() {
+            std::ostringstream result;
+            result << "FixedPointOverflowTracker: " << GetTotalCount() << " total";
+            for (size_t i = 0; i < static_cast<size_t>(FixedPointOperation::Count); i++) {
+                auto operation = static_cast<FixedPointOperation>(i);
+                result << ", " << FixedPointOperationToString(operation) << " " << GetCount(operation);
+            }
+
+            FixedPointOverflowRecord record;
+            for (uint32_t i = 0; TryGetRecord(i, record); i++) {
+                result << "\n  " << FixedPointOperationToString(record.operation) << "(" << record.lhsRaw << ", "
+                       << record.rhsRaw << ") at";
+                for (uint32_t frame = 0; frame < record.callStackDepth; frame++) {
+                    result << " " << record.callStack[frame];
+                }
+            }
+            return result.str();
+        }
+
+      private:
+        struct Slot {
+            std::atomic<bool> isPublished; // Value initialized to false as of C++20
+            FixedPointOverflowRecord record;
+        };
+
+        static inline std::atomic<uint64_t> mCounts[static_cast<size_t>(FixedPointOperation::Count)] = {};
+        static inline std::atomic<uint32_t> mNextSlot = 0;
+        static inline Slot mSlots[kMaxRecordedOverflows];
+    };
+}
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "FixedPoint.h"
+#include "FPMath.h"
+#include "FPRsqrt.h"
+#include "FQuatFP.h"
+#include "FVectorFP.h"
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Builds and queries rotations directly in quaternion form, rather than going through Euler angles or
+    /// axis-angle. Most functions only need multiplies plus a single reciprocal sqrt (no trig), which makes them
+    /// suitable for per-frame character and camera orientation.
+    /// Directions follow game conventions: Forward is +x, Right is +y and Up is +z.
+    /// </summary>
+    class QuatUtilities {
+    public:
+        QuatUtilities() = delete;
+
+        /**
+        * Shortest arc rotation which rotates fromDir onto toDir, without any trig.
+        * If directions are opposite, then rotates 180 degrees around an arbitrary perpendicular axis.
+        * @param fromDir - Starting direction. Must be normalized
+        * @param toDir - Target direction. Must be normalized
+        * @returns unit quaternion such that result * fromDir is (nearly) toDir
+        **/
+        static constexpr FQuatFP FromTo(const FVectorFP& fromDir, const FVectorFP& toDir) {
+            // Half angle trick: (1 + cos(angle), sin(angle) * axis) has the same direction as
+            //      (cos(angle/2), sin(angle/2) * axis), so normalizing gives the rotation quaternion directly.
+            //      See https://stackoverflow.com/a/11741520
+            fp w = fp{1} + fromDir.Dot(toDir);
+            if (w < kOppositeDirTolerance) {
+                return FQuatFP(fp{0}, GetPerpendicularAxis(fromDir));
+            }
+
+            return FQuatFP(w, fromDir.Cross(toDir)).Normalized();
+        }
+
+        /**
+        * Yaw-only rotation which rotates Forward to face the given direction, ignoring any vertical (z) component.
+        * Rotation axis is always Up, including when facing backwards.
+        * @param direction - Direction to face. Doesn't need to be normalized
+        * @returns yaw-only unit quaternion, or identity if direction has no horizontal component
+        **/
+        static constexpr FQuatFP FromYawDirection(const FVectorFP& direction) {
+            // Same as FromTo(Forward, horizontal direction), but skips normalizing input by scaling w by its length
+            fp horizontalLength = GetHorizontalLength(direction);
+            if (horizontalLength == fp{0}) {
+                return FQuatFP::identity();
+            }
+
+            fp w = horizontalLength + direction.x;
+            if (w < kOppositeDirTolerance * horizontalLength) {
+                return FQuatFP(fp{0}, FVectorFP::Up());
+            }
+
+            return FQuatFP(w, FVectorFP(fp{0}, fp{0}, direction.y)).Normalized();
+        }
+
+        /**
+        * Rotation which faces Forward towards the given direction while keeping Right horizontal (relative to up),
+        * like a camera looking at a target.
+        * @param forward - Direction to face. Doesn't need to be normalized, but must be non-zero
+        * @param up - Reference up direction. If forward is parallel to this, falls back to FromTo(Forward, forward)
+        * @returns unit quaternion such that result * Forward is forward's direction and result * Up is as close to
+        *          up as possible
+        **/
+        static FQuatFP LookRotation(const FVectorFP& forward, const FVectorFP& up = FVectorFP::Up()) {
+            // Not constexpr, as SafeNormalize keeps full precision for short vectors (unlike Normalized), which
+            //      matters for right direction when forward is close to up
+            FVectorFP forwardDir = forward;
+            if (!forwardDir.SafeNormalize(fp{0})) {
+                return FQuatFP::identity();
+            }
+
+            FVectorFP rightDir = up.Cross(forwardDir);
+            if (!rightDir.SafeNormalize()) {
+                return FromTo(FVectorFP::Forward(), forwardDir);
+            }
+
+            return FromBasis(forwardDir, rightDir, forwardDir.Cross(rightDir));
+        }
+
+        /**
+        * Normalized linear interpolation, which takes the shorter path between rotations.
+        * Doesn't rotate at a constant speed like Slerp, but much cheaper and close enough for small steps
+        * (eg, smoothing a camera each frame).
+        **/
+        static constexpr FQuatFP Nlerp(const FQuatFP& from, const FQuatFP& to, fp alpha) {
+            // q and -q are the same rotation, so flip target when needed to avoid going the long way around
+            fp toSign = from.Dot(to) < fp{0} ? fp{-1} : fp{1};
+            fp fromWeight = fp{1} - alpha;
+            fp toWeight = alpha * toSign;
+
+            return FQuatFP(from.w * fromWeight + to.w * toWeight, from.v * fromWeight + to.v * toWeight).Normalized();
+        }
+
+        /**
+        * Spherical linear interpolation, which rotates at a constant angular speed along the shorter path.
+        * Uses acos + sin, so prefer Nlerp for per-frame smoothing. Falls back to Nlerp for nearly equal rotations.
+        **/
+        static constexpr FQuatFP Slerp(const FQuatFP& from, const FQuatFP& to, fp alpha) {
+            fp cosAngle = from.Dot(to);
+            fp toSign = fp{1};
+            if (cosAngle < fp{0}) {
+                cosAngle = -cosAngle;
+                toSign = fp{-1};
+            }
+
+            // sin(angle) is too small to divide by accurately here, and rotations are close enough to be linear
+            if (cosAngle > kSlerpToNlerpThreshold) {
+                return Nlerp(from, to, alpha);
+            }
+
+            fp angle = FPMath::acosR(cosAngle);
+            fp inverseSinAngle = fp{1} / FPMath::sinR(angle);
+            fp fromWeight = FPMath::sinR((fp{1} - alpha) * angle) * inverseSinAngle;
+            fp toWeight = FPMath::sinR(alpha * angle) * inverseSinAngle * toSign;
+
+            return FQuatFP(from.w * fromWeight + to.w * toWeight, from.v * fromWeight + to.v * toWeight).Normalized();
+        }
+
+        // Same as rotation * FVectorFP::Forward(), but reads it directly from the quaternion (fewer multiplies)
+        static constexpr FVectorFP GetForward(const FQuatFP& rotation) {
+            const fp& w = rotation.w;
+            const fp& x = rotation.v.x;
+            const fp& y = rotation.v.y;
+            const fp& z = rotation.v.z;
+            return {fp{1} - fp{2} * (y * y + z * z), fp{2} * (x * y + w * z), fp{2} * (x * z - w * y)};
+        }
+
+        // Same as rotation * FVectorFP::Right(), but reads it directly from the quaternion (fewer multiplies)
+        static constexpr FVectorFP GetRight(const FQuatFP& rotation) {
+            const fp& w = rotation.w;
+            const fp& x = rotation.v.x;
+            const fp& y = rotation.v.y;
+            const fp& z = rotation.v.z;
+            return {fp{2} * (x * y - w * z), fp{1} - fp{2} * (x * x + z * z), fp{2} * (y * z + w * x)};
+        }
+
+        // Same as rotation * FVectorFP::Up(), but reads it directly from the quaternion (fewer multiplies)
+        static constexpr FVectorFP GetUp(const FQuatFP& rotation) {
+            const fp& w = rotation.w;
+            const fp& x = rotation.v.x;
+            const fp& y = rotation.v.y;
+            const fp& z = rotation.v.z;
+            return {fp{2} * (x * z + w * y), fp{2} * (y * z - w * x), fp{1} - fp{2} * (x * x + y * y)};
+        }
+
+        /**
+        * Gets yaw of the rotated Forward direction, ie the direction being faced on the horizontal plane.
+        * @returns yaw in degrees in range [-180, 180], where positive is towards Right. 0 if facing straight up or down
+        **/
+        static constexpr fp GetYawDegrees(const FQuatFP& rotation) {
+            FVectorFP forward = GetForward(rotation);
+            if (forward.x == fp{0} && forward.y == fp{0}) {
+                return fp{0};
+            }
+            return FPMath::atanD(forward.y, forward.x);
+        }
+
+        /**
+        * Gets pitch of the rotated Forward direction.
+        * @returns pitch in degrees in range [-90, 90], where positive is upwards
+        **/
+        static constexpr fp GetPitchDegrees(const FQuatFP& rotation) {
+            // atan2 rather than asin(z), as it stays accurate near straight up/down and tolerates non-unit quats
+            FVectorFP forward = GetForward(rotation);
+            return FPMath::atanD(forward.z, FPMath::sqrt(forward.x * forward.x + forward.y * forward.y));
+        }
+
+        /**
+        * Removes pitch and roll from the given rotation, keeping only the direction faced on the horizontal plane.
+        * Useful for getting character facing from a camera rotation.
+        * @returns yaw-only unit quaternion, or identity if rotation faces straight up or down
+        **/
+        static constexpr FQuatFP GetYawOnly(const FQuatFP& rotation) {
+            return FromYawDirection(GetForward(rotation));
+        }
+
+    private:
+        // 1 + cos(angle) below this means directions are too close to opposite for cross product to give a
+        //      meaningful axis (~0.8 degrees from opposite)
+        static constexpr fp kOppositeDirTolerance = fp{1.e-4f};
+        static constexpr fp kSlerpToNlerpThreshold = fp{0.9995f};
+
+        // Picks rotation axis for opposite directions. Same axis choice as FPMath2::dirVectorToQuat has always used
+        static constexpr FVectorFP GetPerpendicularAxis(const FVectorFP& dir) {
+            FVectorFP axis = FVectorFP::Up().Cross(dir);
+            if (axis == FVectorFP::Zero()) {
+                axis = FVectorFP::Forward().Cross(dir);
+            }
+            return axis.Normalized();
+        }
+
+        // Exact (rounded) length of x and y components. Uses FPRsqrt on integer squares, as fpm's sqrt is far slower
+        //      and fp multiplies would round away most of a short vector's length
+        static constexpr fp GetHorizontalLength(const FVectorFP& direction) {
+            int64_t components[2] = {direction.x.raw_value(), direction.y.raw_value()};
+            return fp::from_raw_value(FPRsqrt::LengthRaw(components));
+        }
+
+        /**
+        * Converts orthonormal basis (ie, rotated Forward, Right and Up) to a quaternion.
+        * Uses the largest of w/x/y/z to solve for the rest, so only needs a single reciprocal sqrt and stays accurate
+        * for every rotation. See https://www.euclideanspace.com/maths/geometry/rotations/conversions/matrixToQuaternion/
+        **/
+        static constexpr FQuatFP FromBasis(const FVectorFP& forward, const FVectorFP& right, const FVectorFP& up) {
+            // Rotation matrix has basis vectors as columns
+            const fp& m00 = forward.x; const fp& m01 = right.x; const fp& m02 = up.x;
+            const fp& m10 = forward.y; const fp& m11 = right.y; const fp& m12 = up.y;
+            const fp& m20 = forward.z; const fp& m21 = right.z; const fp& m22 = up.z;
+
+            fp trace = m00 + m11 + m22;
+            if (trace > fp{0}) {
+                fp fourWSquared = trace + fp{1};
+                fp scale = fp{0.5f} * FPMath::rsqrt(fourWSquared);
+                return FQuatFP(fourWSquared * scale, FVectorFP(m21 - m12, m02 - m20, m10 - m01) * scale);
+            }
+            if (m00 >= m11 && m00 >= m22) {
+                fp fourXSquared = fp{1} + m00 - m11 - m22;
+                fp scale = fp{0.5f} * FPMath::rsqrt(fourXSquared);
+                return FQuatFP((m21 - m12) * scale, FVectorFP(fourXSquared, m01 + m10, m02 + m20) * scale);
+            }
+            if (m11 >= m22) {
+                fp fourYSquared = fp{1} + m11 - m00 - m22;
+                fp scale = fp{0.5f} * FPMath::rsqrt(fourYSquared);
+                return FQuatFP((m02 - m20) * scale, FVectorFP(m01 + m10, fourYSquared, m12 + m21) * scale);
+            }
+            fp fourZSquared = fp{1} + m22 - m00 - m11;
+            fp scale = fp{0.5f} * FPMath::rsqrt(fourZSquared);
+            return FQuatFP((m10 - m01) * scale, FVectorFP(m02 + m20, m12 + m21, fourZSquared) * scale);
+        }
+    };
+}
@@ -7,7 +7,7 @@
 namespace ProjectNomad {
     class VectorUtilities {
     public:
-        static FVectorFP getAnyPerpendicularVector(const FVectorFP& normalizedInput) {
+        static constexpr FVectorFP getAnyPerpendicularVector(const FVectorFP& normalizedInput) {
             // Choose any arbitrary direction to cross with for a perpendicular vector EXCEPT a parallel vector
             if (normalizedInput != FVectorFP::Up() && normalizedInput != FVectorFP::Down()) {
                 return normalizedInput.Cross(FVectorFP::Up());
@@ -25,7 +25,7 @@ namespace ProjectNomad {
         * @param normalizedInput - Direction to get perpendicular direction to
         * @returns perpendicular to input direction that is one of two of the more "vertical" perpendicular options
         **/
-        static FVectorFP GetVerticalPerpendicularDirection(const FVectorFP& normalizedInput) {
+        static constexpr FVectorFP GetVerticalPerpendicularDirection(const FVectorFP& normalizedInput) {
             // Edge case: If already perfectly vertical, then nothing to do
             // NOTE: This almost certainly won't work for up/down directions with minor errors (eg, <0.000031f, 0, 1>)
             if (normalizedInput == FVectorFP::Up() || normalizedInput == FVectorFP::Down()) {
@@ -55,7 +55,7 @@ namespace ProjectNomad {
         * @param normalizedInput - Direction to get perpendicular direction to
         * @returns perpendicular to input direction that is most "upwards"
         **/
-        static FVectorFP GetUpwardsPerpendicularDirection(const FVectorFP& normalizedInput) {
+        static constexpr FVectorFP GetUpwardsPerpendicularDirection(const FVectorFP& normalizedInput) {
             FVectorFP verticalPerpVector = GetVerticalPerpendicularDirection(normalizedInput);
 
             // If facing downwards, then flip to face upwards. Note that need to flip entire vector, as just flipping
@@ -74,7 +74,7 @@ namespace ProjectNomad {
         /// <param name="testVector">Vector to project onto given direction</param>
         /// <param name="unitVectorToProjectOnto">Direction to project onto. NOTe: Hard assumption that this is a unit vector</param>
         /// <param name="parallelComponent">Resulting parallel component of projection</param>
-        static void getParallelVectorProjection(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
+        static constexpr void getParallelVectorProjection(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
                                                 FVectorFP& parallelComponent) {
             bool isParallelOppositeDir;
             getParallelVectorProjection(testVector, unitVectorToProjectOnto, parallelComponent, isParallelOppositeDir);
@@ -87,7 +87,7 @@ namespace ProjectNomad {
         /// <param name="unitVectorToProjectOnto">Direction to project onto. NOTe: Hard assumption that this is a unit vector</param>
         /// <param name="parallelComponent">Resulting parallel component of projection</param>
         /// <param name="isParallelOppositeDir">True if projection is in direction of unit vector, false if in opposite direction</param>
-        static void getParallelVectorProjection(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
+        static constexpr void getParallelVectorProjection(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
                                                 FVectorFP& parallelComponent, bool& isParallelOppositeDir) {
             // IDEA: Double check if input unit vector is actually a unit vector. Throw error if not
 
@@ -98,13 +98,13 @@ namespace ProjectNomad {
             parallelComponent = unitVectorToProjectOnto.Dot(testVector) * unitVectorToProjectOnto;
         }
 
-        static void getVectorsRelativeToDir(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
+        static constexpr void getVectorsRelativeToDir(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
                                             FVectorFP& parallelComponent, FVectorFP& perpendicularComponent) {
             bool isParallelOppositeDir;
             getVectorsRelativeToDir(testVector, unitVectorToProjectOnto, parallelComponent, perpendicularComponent, isParallelOppositeDir);
         }
 
-        static void getVectorsRelativeToDir(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
+        static constexpr void getVectorsRelativeToDir(const FVectorFP& testVector, const FVectorFP& unitVectorToProjectOnto,
                                             FVectorFP& parallelComponent, FVectorFP& perpendicularComponent,
                                             bool& isParallelOppositeDir) {
             getParallelVectorProjection(testVector, unitVectorToProjectOnto, parallelComponent, isParallelOppositeDir);
@@ -121,7 +121,7 @@ namespace ProjectNomad {
         /// Note that this method does not make any distinction between "left" and "right".
         /// ie, Forward x Left = 90 and  Forward x Right = 90 as well. Use isXYCrossDotPositive to distinguish the two.
         /// </returns>
-        static fp getAngleBetweenVectorsInDegrees(const FVectorFP& a, const FVectorFP& b) {
+        static constexpr fp getAngleBetweenVectorsInDegrees(const FVectorFP& a, const FVectorFP& b) {
             // TODO: I don't even remember what formula I used. A reference here would be nice
             fp value = a.Normalized().Dot(b.Normalized());
 
@@ -133,7 +133,7 @@ namespace ProjectNomad {
             return FPMath::acosD(value);
         }
 
-        static bool isAngleBetweenVectorsInRange(const FVectorFP& a, const FVectorFP& b, fp angleRangeInclusive) {
+        static constexpr bool isAngleBetweenVectorsInRange(const FVectorFP& a, const FVectorFP& b, fp angleRangeInclusive) {
             fp angleBetweenAttackerDirAndFacingDir = getAngleBetweenVectorsInDegrees(a, b);
             return angleBetweenAttackerDirAndFacingDir <= angleRangeInclusive;
         }
@@ -145,7 +145,7 @@ namespace ProjectNomad {
         /// <param name="a">First vector (doesn't need to be a unit vector)</param>
         /// <param name="b">Second vector (doesn't need to be a unit vector)</param>
         /// <returns>Positive if b is to "right" of a, and negative if b is to "left" of a. See unit tests for examples</returns>
-        static bool isXYCrossDotPositive(FVectorFP a, FVectorFP b) {
+        static constexpr bool isXYCrossDotPositive(FVectorFP a, FVectorFP b) {
             // TODO: A source link from years back would be nice
             return a.Cross(b).Dot(FVectorFP::Up()) >= fp{0};
         }
@@ -157,7 +157,7 @@ namespace ProjectNomad {
         * @param angleRangeInclusive - allowed angle difference. Must be >= 0
         * @returns true if given direction is close to horizontal, false otherwise
         **/
-        static bool IsDirectionCloseToHorizontal(const FVectorFP& inputDir, fp angleRangeInclusive) {
+        static constexpr bool IsDirectionCloseToHorizontal(const FVectorFP& inputDir, fp angleRangeInclusive) {
             // FUTURE NOTE: There *is* some sort of optimization checking just the magnitude of the z value
             // (as x-y vs z ratio varies in conjunction with angle), BUT current implementation certainly works and
             // don't want to superficially think about all this math and waste time on pre-optimizing
@@ -179,14 +179,14 @@ namespace ProjectNomad {
             return isAngleBetweenVectorsInRange(inputDir, horizontalProjectionDir, angleRangeInclusive);
         }
 
-        static FVectorFP zeroOutZ(const FVectorFP& vector) {
+        static constexpr FVectorFP zeroOutZ(const FVectorFP& vector) {
             return FVectorFP(vector.x, vector.y, fp{0});
         }
-        static FVectorFP zeroOutXY(const FVectorFP& vector) {
+        static constexpr FVectorFP zeroOutXY(const FVectorFP& vector) {
             return FVectorFP(fp{0}, fp{0}, vector.z);
         }
 
-        static FVectorFP RemoveParallelButOppositeComponent(const FVectorFP& velocity, const FVectorFP& direction) {
+        static constexpr FVectorFP RemoveParallelButOppositeComponent(const FVectorFP& velocity, const FVectorFP& direction) {
             // Check for any amount that's parallel but opposite to the "taut rope" direction
             fp curSpeedInRopeDir = velocity.Dot(direction);
             if (curSpeedInRopeDir >= fp{0}) {
@@ -0,0 +1,101 @@
+#include "BoundingVolumeHierarchy.h"
+
+#include <algorithm>
+
+namespace ProjectNomad {
+    void BoundingVolumeHierarchy::Clear() {
+        mProxies.clear();
+        mNodes.clear();
+    }
+
+    void BoundingVolumeHierarchy::AddProxy(const AABB& bounds,
+                                           entt::entity entity,
+                                           bool isDynamic,
+                                           const CollisionLayerFilter& layerFilter) {
+        BroadphaseProxy proxy;
+        proxy.bounds = bounds;
+        proxy.entity = entity;
+        proxy.isDynamic = isDynamic;
+        proxy.layerFilter = layerFilter;
+
+        mProxies.push_back(proxy);
+    }
+
+    void BoundingVolumeHierarchy::Build() {
+        mNodes.clear();
+        if (mProxies.empty()) {
+            return;
+        }
+
+        // Registry iteration order isn't guaranteed to survive snapshot restoration, so normalize input order first.
+        //      Leaves are small enough to not be sorted further, so this also defines visiting order within a leaf
+        std::sort(
+            mProxies.begin(),
+            mProxies.end(),
+            [](const BroadphaseProxy& a, const BroadphaseProxy& b) { return a.entity < b.entity; }
+        );
+
+        // Binary tree with n leaves has 2n - 1 nodes. Reserve up front so BuildRange never reallocates mid-build
+        mNodes.reserve(mProxies.size() * 2);
+        BuildRange(0, static_cast<uint32_t>(mProxies.size()));
+    }
+
+    uint32_t BoundingVolumeHierarchy::BuildRange(uint32_t begin, uint32_t end) {
+        uint32_t nodeIndex = static_cast<uint32_t>(mNodes.size());
+        mNodes.emplace_back();
+
+        // Calculate bounds of entire range. Also track centroid bounds for choosing split axis
+        AABB bounds = mProxies[begin].bounds;
+        FVectorFP centroidMin = mProxies[begin].bounds.GetCenter();
+        FVectorFP centroidMax = centroidMin;
+        for (uint32_t i = begin + 1; i < end; i++) {
+            bounds = AABB::Merge(bounds, mProxies[i].bounds);
+
+            FVectorFP centroid = mProxies[i].bounds.GetCenter();
+            AABB centroidBounds = AABB::Merge(AABB(centroidMin, centroidMax), AABB(centroid, centroid));
+            centroidMin = centroidBounds.min;
+            centroidMax = centroidBounds.max;
+        }
+        mNodes[nodeIndex].bounds = bounds;
+
+        uint32_t count = end - begin;
+        if (count <= kMaxProxiesPerLeaf) {
+            mNodes[nodeIndex].firstProxyIndex = begin;
+            mNodes[nodeIndex].proxyCount = count;
+            return nodeIndex;
+        }
+
+        // Split along longest centroid axis
+        FVectorFP centroidExtents = centroidMax - centroidMin;
+        int splitAxis = 0;
+        if (centroidExtents.y > centroidExtents[splitAxis]) {
+            splitAxis = 1;
+        }
+        if (centroidExtents.z > centroidExtents[splitAxis]) {
+            splitAxis = 2;
+        }
+
+        // Full sort with total order rather than nth_element, as latter's handling of equal elements is
+        //      implementation-defined and thus could produce different trees on different platforms
+        std::sort(
+            mProxies.begin() + begin,
+            mProxies.begin() + end,
+            [splitAxis](const BroadphaseProxy& a, const BroadphaseProxy& b) {
+                // No need to divide by 2 for actual centroid as only relative ordering matters
+                fp aCentroid = a.bounds.min[splitAxis] + a.bounds.max[splitAxis];
+                fp bCentroid = b.bounds.min[splitAxis] + b.bounds.max[splitAxis];
+                if (aCentroid != bCentroid) {
+                    return aCentroid < bCentroid;
+                }
+                return a.entity < b.entity;
+            }
+        );
+
+        uint32_t middle = begin + count / 2;
+        BuildRange(begin, middle); // Left child is always nodeIndex + 1
+        uint32_t rightChildIndex = BuildRange(middle, end);
+        mNodes[nodeIndex].rightChildIndex = rightChildIndex;
+
+        return nodeIndex;
+    }
+}
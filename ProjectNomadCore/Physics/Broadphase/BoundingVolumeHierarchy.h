@@ -0,0 +1,176 @@
+#pragma once
+
+#include <vector>
+#include <EnTT/entt.hpp>
+
+#include "Math/FixedPoint.h"
+#include "Math/FPMath.h"
+#include "Math/FVectorFP.h"
+#include "Physics/Model/AABB.h"
+#include "Physics/Model/CollisionLayers.h"
+
+namespace ProjectNomad {
+    /**
+    * Single collider entry within the broadphase
+    **/
+    struct BroadphaseProxy {
+        AABB bounds;
+        entt::entity entity = entt::null;
+        bool isDynamic = false;
+        // Copied from collider component so layer rejection never needs to touch the registry
+        CollisionLayerFilter layerFilter = {};
+    };
+
+    /**
+    * Single node within the BVH. Nodes are laid out depth-first, so a node's left child is always the very next node
+    **/
+    struct BvhNode {
+        AABB bounds;
+        uint32_t rightChildIndex = 0;
+        uint32_t firstProxyIndex = 0;
+        uint32_t proxyCount = 0; // Only leaves reference proxies directly
+
+        bool IsLeaf() const {
+            return proxyCount > 0;
+        }
+    };
+
+    /// <summary>
+    /// Rebuild-only AABB tree used to cull scene queries and pair generation down from linear to logarithmic cost.
+    /// Built top-down via median splits along the longest axis. All sorting uses a total order (centroid then
+    ///     entity id) so that the exact same tree - and thus exact same query visiting order - is produced on all
+    ///     platforms for the same input.
+    /// Intended to be fully rebuilt from the registry (eg, once per frame for dynamic colliders) rather than
+    ///     incrementally updated, so that rollback restoration never leaves the tree in a stale state.
+    /// </summary>
+    class BoundingVolumeHierarchy {
+      public:
+        static constexpr uint32_t kMaxProxiesPerLeaf = 4;
+        static constexpr uint32_t kMaxTraversalDepth = 64;
+
+        // Removes all proxies and nodes. Memory is retained so that rebuilding each frame does not reallocate
+        void Clear();
+        // Proxies are only reflected in queries after Build() is called
+        void AddProxy(const AABB& bounds, entt::entity entity, bool isDynamic, const CollisionLayerFilter& layerFilter);
+        void Build();
+
+        uint32_t GetProxyCount() const {
+            return static_cast<uint32_t>(mProxies.size());
+        }
+
+        bool IsEmpty() const {
+            return mNodes.empty();
+        }
+
+        /**
+        * Visits every proxy whose bounds overlap the given bounds.
+        * @param queryBounds - world bounds to test against
+        * @param callback - called as callback(const BroadphaseProxy&). Return false to stop traversal early
+        **/
+        template <typename Callback>
+        void QueryOverlap(const AABB& queryBounds, Callback&& callback) const {
+            if (mNodes.empty()) {
+                return;
+            }
+
+            uint32_t stack[kMaxTraversalDepth];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+
+            while (stackSize > 0) {
+                uint32_t nodeIndex = stack[--stackSize];
+                const BvhNode& node = mNodes[nodeIndex];
+                if (!node.bounds.Overlaps(queryBounds)) {
+                    continue;
+                }
+
+                if (node.IsLeaf()) {
+                    for (uint32_t i = node.firstProxyIndex; i < node.firstProxyIndex + node.proxyCount; i++) {
+                        if (mProxies[i].bounds.Overlaps(queryBounds) && !callback(mProxies[i])) {
+                            return;
+                        }
+                    }
+                    continue;
+                }
+
+                // Push right first so left is visited first. Order doesn't matter for correctness but keep it fixed
+                stack[stackSize++] = node.rightChildIndex;
+                stack[stackSize++] = nodeIndex + 1;
+            }
+        }
+
+        /**
+        * Visits every proxy whose bounds are touched by the given ray, roughly front to back.
+        * @param origin - start of ray
+        * @param direction - normalized direction of ray
+        * @param maxDistance - max distance along ray to consider
+        * @param callback - called as callback(const BroadphaseProxy&, fp& currentMaxDistance). Callback may lower
+        *                   currentMaxDistance (eg, after a confirmed closest hit) to cull the remaining traversal.
+        *                   Return false to stop traversal early
+        **/
+        template <typename Callback>
+        void QueryRay(const FVectorFP& origin,
+                      const FVectorFP& direction,
+                      fp maxDistance,
+                      Callback&& callback) const {
+            if (mNodes.empty()) {
+                return;
+            }
+
+            uint32_t stack[kMaxTraversalDepth];
+            uint32_t stackSize = 0;
+            stack[stackSize++] = 0;
+
+            while (stackSize > 0) {
+                uint32_t nodeIndex = stack[--stackSize];
+                const BvhNode& node = mNodes[nodeIndex];
+                fp entryDistance;
+                if (!node.bounds.IntersectsRay(origin, direction, maxDistance, entryDistance)) {
+                    continue;
+                }
+
+                if (node.IsLeaf()) {
+                    for (uint32_t i = node.firstProxyIndex; i < node.firstProxyIndex + node.proxyCount; i++) {
+                        if (!mProxies[i].bounds.IntersectsRay(origin, direction, maxDistance, entryDistance)) {
+                            continue;
+                        }
+                        if (!callback(mProxies[i], maxDistance)) {
+                            return;
+                        }
+                    }
+                    continue;
+                }
+
+                // Visit nearer child first so that closest-hit queries can shrink maxDistance as early as possible
+                uint32_t leftIndex = nodeIndex + 1; // Left child is implicitly next node due to depth-first layout
+                uint32_t rightIndex = node.rightChildIndex;
+                fp leftEntry, rightEntry;
+                bool hitsLeft = mNodes[leftIndex].bounds.IntersectsRay(origin, direction, maxDistance, leftEntry);
+                bool hitsRight = mNodes[rightIndex].bounds.IntersectsRay(origin, direction, maxDistance, rightEntry);
+
+                if (hitsLeft && hitsRight) {
+                    if (rightEntry < leftEntry) {
+                        stack[stackSize++] = leftIndex;
+                        stack[stackSize++] = rightIndex;
+                    }
+                    else {
+                        stack[stackSize++] = rightIndex;
+                        stack[stackSize++] = leftIndex;
+                    }
+                }
+                else if (hitsLeft) {
+                    stack[stackSize++] = leftIndex;
+                }
+                else if (hitsRight) {
+                    stack[stackSize++] = rightIndex;
+                }
+            }
+        }
+
+      private:
+        uint32_t BuildRange(uint32_t begin, uint32_t end);
+
+        std::vector<BroadphaseProxy> mProxies;
+        std::vector<BvhNode> mNodes;
+    };
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include "Math/FixedPoint.h"
 #include "Math/FVectorFP.h"
 
 struct FCollider;
@@ -17,5 +18,15 @@ namespace ProjectNomad {
         /// Watch the following for a quick overview on supporting points for simplex: https://youtu.be/MDusDn8oTSE?t=80
         /// </summary>
         static FVectorFP GetFurthestPoint(CoreContext& coreContext, const FCollider& collider, const FVectorFP& direction);
+
+        /// <summary>
+        /// Every supported collider is a "core" shape (box, line segment, or point) swept by a radius:
+        ///     Box = box + 0 radius, Capsule = medial line + capsule radius, Sphere = center point + sphere radius.
+        /// GJK runs much faster and more precisely against the core shapes as they have no curved surfaces, with the
+        ///     radii simply being subtracted from the resulting distance afterwards.
+        /// </summary>
+        /// <param name="direction">Search direction. Does NOT need to be normalized</param>
+        static FVectorFP GetCoreFurthestPoint(const FCollider& collider, const FVectorFP& direction);
+        static fp GetCoreRadius(const FCollider& collider);
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
-#include <vector>
+#include <utility>
+#include <span>
 
 #include "Model/Line.h"
 #include "Utilities/Assertion.h"
@@ -20,43 +21,36 @@ namespace ProjectNomad {
         /// Tests if two boxes are intersecting along a given axis
         /// Heavily inspired by https://gamedev.stackexchange.com/a/92055/67844
         /// </summary>
-        /// <param name="boxAVertices">Vector of 8 points representing the vertices of a box under test</param>
-        /// <param name="boxBVertices">Vector of 8 points representing the vertices of a box under test</param>
+        /// <param name="boxAVertices">Exactly 8 points representing the vertices of a box under test</param>
+        /// <param name="boxBVertices">Exactly 8 points representing the vertices of a box under test</param>
         /// <param name="axis">
         /// Represents the axis to use for a projection separation test. 
         /// Eg, value of <1, 0, 0> tests for intersection along x axis
         /// </param>
         /// <returns>Intersection amount if positive, 0 if objects are touching, and less than 0 represents distance between objects along this axis</returns>
-        static fp getIntersectionDistAlongAxis(std::vector<FVectorFP> boxAVertices, std::vector<FVectorFP> boxBVertices,
-                                               FVectorFP axis) {
+        static fp getIntersectionDistAlongAxis(std::span<const FVectorFP> boxAVertices,
+                                               std::span<const FVectorFP> boxBVertices,
+                                               const FVectorFP& axis) {
             assertm(boxAVertices.size() == 8, "boxAVertices should contain exactly 8 points");
             assertm(boxBVertices.size() == 8, "boxBVertices should contain exactly 8 points");
             assertm(axis != FVectorFP::Zero(), "Test axis should not be invalid (zero)");
 
-            // Variables to store min and max points along axis for each box
-            // TODO: For cleaner code, use fp::Min and fp::Max or such
-            fp aMin = fp{-1};
-            fp aMax = fp{-1};
-            fp bMin = fp{-1};
-            fp bMax = fp{-1};
+            // Variables to store min and max points along axis for each box, starting from first vertex of each
+            //      (rather than a sentinel value, which could be a legitimate projected distance)
+            fp aMin = axis.Dot(boxAVertices[0]);
+            fp aMax = aMin;
+            fp bMin = axis.Dot(boxBVertices[0]);
+            fp bMax = bMin;
 
             // Find the respective min and max points along the axis for each box, vertex by vertex
-            for (uint32_t i = 0; i < boxAVertices.size(); i++) {
-                fp aProjectedDist = axis.Dot(boxAVertices.at(i));
-                if (aMin == fp{-1} || aProjectedDist < aMin) {
-                    aMin = aProjectedDist;
-                }
-                if (aMax == fp{-1} || aProjectedDist > aMax) {
-                    aMax = aProjectedDist;
-                }
+            for (size_t i = 1; i < boxAVertices.size(); i++) {
+                fp aProjectedDist = axis.Dot(boxAVertices[i]);
+                aMin = FPMath::min(aMin, aProjectedDist);
+                aMax = FPMath::max(aMax, aProjectedDist);
 
-                fp bProjectedDist = axis.Dot(boxBVertices.at(i));
-                if (bMin == fp{-1} || bProjectedDist < bMin) {
-                    bMin = bProjectedDist;
-                }
-                if (bMax == fp{-1} || bProjectedDist > bMax) {
-                    bMax = bProjectedDist;
-                }
+                fp bProjectedDist = axis.Dot(boxBVertices[i]);
+                bMin = FPMath::min(bMin, bProjectedDist);
+                bMax = FPMath::max(bMax, bProjectedDist);
             }
 
             // Finally, calculate the one-dimensional intersection test between our a and b projected segments
@@ -209,9 +203,17 @@ namespace ProjectNomad {
                                                     fp& timeOfIntersection, FVectorFP& closestPoint) {
         
             FVectorFP segmentDir = segmentEnd - segmentStart;
+            fp segmentLengthSq = segmentDir.Dot(segmentDir);
+
+            // Degenerate segment (eg, medial line of a capsule with no cylinder portion) is just its start point
+            if (segmentLengthSq == fp{0}) {
+                timeOfIntersection = fp{0};
+                closestPoint = segmentStart;
+                return;
+            }
         
             // Project c onto ab, computing parameterized position d(t)=a+t*(b � a)
-            timeOfIntersection = segmentDir.Dot(point - segmentStart) / segmentDir.Dot(segmentDir);
+            timeOfIntersection = segmentDir.Dot(point - segmentStart) / segmentLengthSq;
         
             // If outside segment, clamp t (and therefore d) to the closest endpoint
             if (timeOfIntersection < fp{0}) timeOfIntersection = fp{0};
@@ -220,5 +222,228 @@ namespace ProjectNomad {
             // Compute projected position from the clamped t
             closestPoint = segmentStart + timeOfIntersection * segmentDir;
         }
+
+        /// <summary>
+        /// Computes closest points between segment and an origin-centered AABB (eg, a capsule's medial line in box space).
+        /// Squared distance to the box along the segment is convex and piecewise quadratic, with pieces split where the
+        ///     segment crosses a face plane. Thus the minimum is found in closed form from each piece's own minimum.
+        /// </summary>
+        /// <param name="segment">Segment to compare with, in AABB's space</param>
+        /// <param name="boxHalfSize">Positive half extents of AABB</param>
+        /// <param name="timeOfClosestPoint">Time along segment of closest point, where point = start + t * (end - start)</param>
+        /// <param name="segmentPoint">Closest point on segment</param>
+        /// <param name="boxPoint">Closest point on or within AABB</param>
+        /// <returns>Squared distance between closest points. 0 if segment touches or passes through the AABB</returns>
+        static fp getClosestPtsBetweenSegmentAndAABB(const Line& segment, const FVectorFP& boxHalfSize,
+                                                     fp& timeOfClosestPoint, FVectorFP& segmentPoint, FVectorFP& boxPoint) {
+            FVectorFP segmentDir = segment.end - segment.start;
+
+            // Collect times where segment crosses any face plane, which are where the distance function changes form
+            fp pieceBoundaries[8];
+            uint32_t boundaryCount = 0;
+            pieceBoundaries[boundaryCount++] = fp{0};
+            for (int axis = 0; axis < 3; axis++) {
+                if (segmentDir[axis] == fp{0}) {
+                    continue;
+                }
+                for (fp faceExtent : {-boxHalfSize[axis], boxHalfSize[axis]}) {
+                    fp crossingTime = (faceExtent - segment.start[axis]) / segmentDir[axis];
+                    if (crossingTime > fp{0} && crossingTime < fp{1}) {
+                        pieceBoundaries[boundaryCount++] = crossingTime;
+                    }
+                }
+            }
+            pieceBoundaries[boundaryCount++] = fp{1};
+
+            // Simple insertion sort of the crossings (which sit between the fixed 0 and 1), as there are at most 6
+            for (uint32_t i = 2; i + 1 < boundaryCount; i++) {
+                for (uint32_t j = i; j > 1 && pieceBoundaries[j] < pieceBoundaries[j - 1]; j--) {
+                    std::swap(pieceBoundaries[j], pieceBoundaries[j - 1]);
+                }
+            }
+
+            fp bestDistSq = FPMath::maxLimit();
+            for (uint32_t piece = 0; piece + 1 < boundaryCount; piece++) {
+                fp pieceStart = pieceBoundaries[piece];
+                fp pieceEnd = pieceBoundaries[piece + 1];
+
+                // Within a piece, each axis is either within the slab (contributes nothing) or outside a specific face
+                //      (contributes (start + t * dir - face)^2). Sum is a * t^2 + 2 * b * t + c, minimized at t = -b / a
+                fp pieceMiddle = (pieceStart + pieceEnd) / fp{2};
+                fp a = fp{0}, b = fp{0};
+                for (int axis = 0; axis < 3; axis++) {
+                    fp middleExtent = segment.start[axis] + segmentDir[axis] * pieceMiddle;
+                    fp faceExtent;
+                    if (middleExtent < -boxHalfSize[axis]) {
+                        faceExtent = -boxHalfSize[axis];
+                    }
+                    else if (middleExtent > boxHalfSize[axis]) {
+                        faceExtent = boxHalfSize[axis];
+                    }
+                    else {
+                        continue;
+                    }
+
+                    a += segmentDir[axis] * segmentDir[axis];
+                    b += (segment.start[axis] - faceExtent) * segmentDir[axis];
+                }
+                fp time = a > fp{0} ? FPMath::clamp(-b / a, pieceStart, pieceEnd) : pieceStart;
+
+                // Evaluate actual points rather than the quadratic, so that all outputs are exactly consistent
+                FVectorFP candidateSegmentPoint = segment.start + segmentDir * time;
+                FVectorFP candidateBoxPoint(
+                    FPMath::clamp(candidateSegmentPoint.x, -boxHalfSize.x, boxHalfSize.x),
+                    FPMath::clamp(candidateSegmentPoint.y, -boxHalfSize.y, boxHalfSize.y),
+                    FPMath::clamp(candidateSegmentPoint.z, -boxHalfSize.z, boxHalfSize.z)
+                );
+                fp candidateDistSq = FVectorFP::DistanceSq(candidateSegmentPoint, candidateBoxPoint);
+                if (candidateDistSq < bestDistSq) {
+                    bestDistSq = candidateDistSq;
+                    timeOfClosestPoint = time;
+                    segmentPoint = candidateSegmentPoint;
+                    boxPoint = candidateBoxPoint;
+                }
+            }
+
+            return bestDistSq;
+        }
+
+        /// <summary>
+        /// Computes smallest movement which pushes a segment entirely out of an origin-centered AABB.
+        /// The Minkowski difference of a box and a segment is a convex polytope whose face normals are the box axes plus
+        ///     the cross products of segment direction with each box axis, so the shallowest of those 6 axes is exact.
+        /// When segment is a single point, this is simply pushing the point out through its nearest face.
+        /// </summary>
+        /// <param name="segment">Segment which touches or intersects the AABB, in AABB's space</param>
+        /// <param name="boxHalfSize">Positive half extents of AABB</param>
+        /// <param name="pushDirection">Normalized direction to move segment in, ie pointing from box towards segment</param>
+        /// <param name="pushDistance">Distance to move segment along pushDirection</param>
+        static void getSmallestPushOfSegmentOutOfAABB(const Line& segment, const FVectorFP& boxHalfSize,
+                                                      FVectorFP& pushDirection, fp& pushDistance) {
+            FVectorFP segmentDir = segment.end - segment.start;
+            FVectorFP candidateAxes[6] = {
+                FVectorFP::Forward(), FVectorFP::Right(), FVectorFP::Up(),
+                segmentDir.Cross(FVectorFP::Forward()), segmentDir.Cross(FVectorFP::Right()), segmentDir.Cross(FVectorFP::Up())
+            };
+
+            pushDistance = FPMath::maxLimit();
+            pushDirection = FVectorFP::Forward();
+            for (int i = 0; i < 6; i++) {
+                FVectorFP axis = candidateAxes[i];
+                if (i >= 3) {
+                    // Segment is (nearly) parallel to this box axis, in which case face axes already cover the direction
+                    if (axis.GetLengthSquared() < getEpsilon()) {
+                        continue;
+                    }
+                    axis = axis.Normalized();
+                }
+
+                fp boxExtent = FPMath::abs(axis.x) * boxHalfSize.x
+                             + FPMath::abs(axis.y) * boxHalfSize.y
+                             + FPMath::abs(axis.z) * boxHalfSize.z;
+                fp startExtent = axis.Dot(segment.start);
+                fp endExtent = axis.Dot(segment.end);
+
+                // Either push segment's min extent past box's max extent, or segment's max extent past box's min extent
+                fp pushAlongAxis = boxExtent - FPMath::min(startExtent, endExtent);
+                fp pushAgainstAxis = FPMath::max(startExtent, endExtent) + boxExtent;
+
+                // Strict comparisons against best so far, so that earlier candidates (box faces) win ties
+                if (pushAlongAxis <= pushAgainstAxis) {
+                    if (pushAlongAxis < pushDistance) {
+                        pushDistance = pushAlongAxis;
+                        pushDirection = axis;
+                    }
+                }
+                else if (pushAgainstAxis < pushDistance) {
+                    pushDistance = pushAgainstAxis;
+                    pushDirection = axis.Flipped();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Clips segment to the portion within a sphere (eg, a cone's range), by solving |start + t*(end - start) - c|^2 = r^2
+        /// </summary>
+        /// <param name="segment">Segment to clip</param>
+        /// <param name="sphereCenter">Center of sphere</param>
+        /// <param name="sphereRadius">Radius of sphere</param>
+        /// <param name="timeOfEntry">Time along segment where clipped portion starts, where point = start + t * (end - start)</param>
+        /// <param name="timeOfExit">Time along segment where clipped portion ends</param>
+        /// <returns>True if any part of segment is within sphere, false otherwise</returns>
+        static bool clipSegmentToSphere(const Line& segment, const FVectorFP& sphereCenter, fp sphereRadius,
+                                        fp& timeOfEntry, fp& timeOfExit) {
+            FVectorFP segmentDir = segment.end - segment.start;
+            FVectorFP centerToStart = segment.start - sphereCenter;
+            fp b = centerToStart.Dot(segmentDir);
+            fp c = centerToStart.Dot(centerToStart) - sphereRadius * sphereRadius;
+            fp e = segmentDir.Dot(segmentDir);
+
+            // Degenerate segment is just its start point
+            if (e == fp{0}) {
+                timeOfEntry = fp{0};
+                timeOfExit = fp{0};
+                return c <= fp{0};
+            }
+
+            fp discriminant = b * b - e * c;
+            if (discriminant < fp{0}) {
+                return false; // Line misses sphere entirely
+            }
+
+            fp discriminantRoot = FPMath::sqrt(discriminant);
+            timeOfEntry = (-b - discriminantRoot) / e;
+            timeOfExit = (-b + discriminantRoot) / e;
+            if (timeOfEntry > fp{1} || timeOfExit < fp{0}) {
+                return false; // Line only passes through sphere beyond either end of segment
+            }
+
+            timeOfEntry = FPMath::max(timeOfEntry, fp{0});
+            timeOfExit = FPMath::min(timeOfExit, fp{1});
+            return true;
+        }
+
+        /// <summary>
+        /// Finds point along segment which has the smallest angle relative to a direction from some apex point.
+        /// ie, the point on the segment that is "most in front of" the apex, as used for cone tests.
+        /// Maximizing cos(angle) = (a + b*t) / sqrt(c + 2*d*t + e*t^2) has a single critical point which is linear in t,
+        ///     so the answer is either that critical point or one of the segment endpoints.
+        /// </summary>
+        /// <param name="apex">Point that angles are measured from</param>
+        /// <param name="direction">Normalized direction that angles are measured against</param>
+        /// <param name="segment">Segment to search along</param>
+        /// <param name="timeOfBestPoint">Time along segment of best point, where point = start + t * (end - start)</param>
+        /// <returns>Cosine of angle between direction and apex-to-best-point. 1 if segment passes through apex</returns>
+        static fp getMaxAngleCosAlongSegment(const FVectorFP& apex, const FVectorFP& direction, const Line& segment,
+                                             fp& timeOfBestPoint) {
+            FVectorFP segmentDir = segment.end - segment.start;
+            FVectorFP apexToStart = segment.start - apex;
+            fp a = direction.Dot(apexToStart);
+            fp b = direction.Dot(segmentDir);
+            fp c = apexToStart.Dot(apexToStart);
+            fp d = apexToStart.Dot(segmentDir);
+            fp e = segmentDir.Dot(segmentDir);
+
+            fp candidates[3] = {fp{0}, fp{1}, fp{0}};
+            uint32_t candidateCount = 2;
+            fp denom = b * d - a * e;
+            if (denom != fp{0}) {
+                candidates[2] = FPMath::clamp((a * d - b * c) / denom, fp{0}, fp{1});
+                candidateCount = 3;
+            }
+
+            fp bestCos = fp{-2}; // Below any possible cosine so first candidate always wins
+            for (uint32_t i = 0; i < candidateCount; i++) {
+                fp t = candidates[i];
+                fp distSq = c + fp{2} * d * t + e * t * t;
+                fp candidateCos = distSq <= fp{0} ? fp{1} : (a + b * t) / FPMath::sqrt(distSq);
+                if (candidateCos > bestCos) {
+                    bestCos = candidateCos;
+                    timeOfBestPoint = t;
+                }
+            }
+
+            return bestCos;
+        }
     };
 }
@@ -4,7 +4,7 @@
 #include "CollisionHelpers.h"
 #include "Model/FCollider.h"
 #include "Model/Line.h"
-#include "Model/Ray.h"
+#include "Model/RuntimeCollider.h"
 #include "SimpleCollisions.h"
 #include "Context/CoreContext.h"
 #include "Math/FixedPoint.h"
@@ -76,6 +76,32 @@ namespace ProjectNomad {
         return ImpactResult::noCollision();
     }
 
+    ImpactResult ComplexCollisions::IsColliding(CoreContext& coreContext,
+                                                const FCollider& A,
+                                                const FCollider& B,
+                                                NarrowphaseCacheEntry& inOutCacheEntry) {
+        // Cached axis checks query support points many times, so precalculate rotation data only once
+        RuntimeCollider runtimeA(A);
+        RuntimeCollider runtimeB(B);
+
+        ImpactResult result = ImpactResult::noCollision();
+        if (TryReuseCachedContact(runtimeA, runtimeB, inOutCacheEntry, result)) {
+            return result;
+        }
+
+        if (A.IsBox() && (B.IsCapsule() || B.IsSphere())) {
+            result = IsBoxAndRoundedShapeColliding(runtimeA, runtimeB);
+        }
+        else if (B.IsBox() && (A.IsCapsule() || A.IsSphere())) {
+            result = IsBoxAndRoundedShapeColliding(runtimeB, runtimeA).Flipped();
+        }
+        else {
+            result = IsColliding(coreContext, A, B);
+        }
+        CacheContact(runtimeA, runtimeB, result, inOutCacheEntry);
+        return result;
+    }
+
     ImpactResult ComplexCollisions::IsBoxAndBoxColliding(CoreContext& coreContext, const FCollider& boxA, const FCollider& boxB) {
         if (!boxA.IsBox()) {
             coreContext.logger.LogErrorMessage("Collider A was not a box but instead a " + boxA.GetTypeAsString());
@@ -106,10 +132,10 @@ namespace ProjectNomad {
         // FUTURE: Use the Real-Time Collision Detection algorithm, which is far more efficient but still a bit over my head
 
         // Create necessary data used for SAT tests
-        std::vector<FVectorFP> aNormals = boxA.GetBoxNormalsInWorldCoordinates();
-        std::vector<FVectorFP> bNormals = boxB.GetBoxNormalsInWorldCoordinates();
-        std::vector<FVectorFP> aVertices = boxA.GetBoxVerticesInWorldCoordinates();
-        std::vector<FVectorFP> bVertices = boxB.GetBoxVerticesInWorldCoordinates();
+        BoxNormals aNormals = boxA.GetBoxNormalsInWorldCoordinates();
+        BoxNormals bNormals = boxB.GetBoxNormalsInWorldCoordinates();
+        BoxVertices aVertices = boxA.GetBoxVerticesInWorldCoordinates();
+        BoxVertices bVertices = boxB.GetBoxVerticesInWorldCoordinates();
 
         // Estimate penetration depth by keeping track of shortest penetration axis
         fp smallestPenDepth = fp{-1};
@@ -134,63 +160,63 @@ namespace ProjectNomad {
         // Now check for axes based on cross products with each combination of normals
         // FUTURE: Probs could do the deal-with-square-at-end trick instead of full normalizations
         FVectorFP testAxis;
-        testAxis = aNormals.at(0).Cross(bNormals.at(0)).Normalized(); // Normalize to fix pen depth calculations
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(0)).Normalized(); // Normalize to fix pen depth calculations
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(0).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(1)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(0).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(2)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(0)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(0)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(1)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(2)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(0)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(0)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(1)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
             return ImpactResult::noCollision();
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(2)).Normalized();
         if (!SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
             aVertices, bVertices, testAxis, smallestPenDepth,
             penDepthAxis)) {
@@ -325,33 +351,20 @@ namespace ProjectNomad {
             return ImpactResult::noCollision();
         }
 
-        // Base logic is from Real-Time Collisions 5.5.7
-
-        // Compute line points for capsule
-        auto worldSpaceCapsulePoints = capsule.GetCapsuleMedialLineExtremes();
-        // Convert line points from world space to local space so can continue with Capsule vs AABB approach
-        FVectorFP boxSpaceCapsulePointA = box.ToLocalSpaceFromWorld(worldSpaceCapsulePoints.start);
-        FVectorFP boxSpaceCapsulePointB = box.ToLocalSpaceFromWorld(worldSpaceCapsulePoints.end);
-        Line boxSpaceCapsuleMedialSegment(boxSpaceCapsulePointA, boxSpaceCapsulePointB);
-
-        // Compute the AABB resulting from expanding box faces by capsule radius
-        FCollider expandedCheckBox(box);
-        expandedCheckBox.SetBoxHalfSize(box.GetBoxHalfSize() + FVectorFP(capsule.GetCapsuleRadius()));
-
-        fp timeOfIntersection;
-        FVectorFP pointOfIntersection;
-        bool didIntersect = GetBoxCapsuleIntersection(
-            coreContext, box, expandedCheckBox, boxSpaceCapsuleMedialSegment, capsule.GetCapsuleRadius(),
-            capsule.GetMedialHalfLineLength(), timeOfIntersection, pointOfIntersection
+        // Work in box space, where box is simply an AABB and capsule is a rounded segment
+        Line worldSpaceCapsuleMedialSegment = capsule.GetCapsuleMedialLineExtremes();
+        Line boxSpaceCapsuleMedialSegment(
+            box.ToLocalSpaceFromWorld(worldSpaceCapsuleMedialSegment.start),
+            box.ToLocalSpaceFromWorld(worldSpaceCapsuleMedialSegment.end)
         );
 
-        if (!didIntersect) {
+        FVectorFP boxSpacePenetrationDir;
+        fp penetrationDepth;
+        if (!CalculateBoxAndRoundedSegmentPenetration(box.GetBoxHalfSize(), boxSpaceCapsuleMedialSegment,
+                                                      capsule.GetCapsuleRadius(), boxSpacePenetrationDir, penetrationDepth)) {
             return ImpactResult::noCollision();
         }
-        return CalculateBoxCapsulePenetrationInfo(
-            coreContext, box, capsule, expandedCheckBox, boxSpaceCapsuleMedialSegment, timeOfIntersection,
-            pointOfIntersection
-        );
+        return ImpactResult(box.ToWorldSpaceForOriginCenteredValue(boxSpacePenetrationDir), penetrationDepth);
     }
 
     ImpactResult ComplexCollisions::IsBoxAndSphereColliding(CoreContext& coreContext, const FCollider& box,
@@ -366,57 +379,17 @@ namespace ProjectNomad {
             return ImpactResult::noCollision();
         }
 
-        // Algorithm references:
-        // AABB vs Sphere https://developer.mozilla.org/en-US/docs/Games/Techniques/3D_collision_detection#bounding_spheres
-        // OOBB vs Sphere https://gamedev.stackexchange.com/a/163874/67844
-
-        // Convert sphere's center to OBB's local space, with OOB's center as origin
-        // This allows us to use simplified Sphere vs AABB logic here on out
-        FVectorFP localSphereCenter = box.ToLocalSpaceFromWorld(sphere.GetCenter());
-
-        // Find the closest point on the box to the sphere's center
-        // Essentially just uses sphere center coordinate on each axis IF within box, otherwise clamps to nearest box extent
-        // Suggest visualizing with number lines
-        const FVectorFP& extents = box.GetBoxHalfSize();
-        // Represents min and max points, since using box center as origin
-        FVectorFP closestBoxPointToSphere;
-        closestBoxPointToSphere.x = FPMath::max(-extents.x, FPMath::min(localSphereCenter.x, extents.x));
-        closestBoxPointToSphere.y = FPMath::max(-extents.y, FPMath::min(localSphereCenter.y, extents.y));
-        closestBoxPointToSphere.z = FPMath::max(-extents.z, FPMath::min(localSphereCenter.z, extents.z));
-
-        // Finally do ordinary point distance vs sphere radius checking
-        FVectorFP closestPointOffSetToSphere = localSphereCenter - closestBoxPointToSphere;
-        fp sphereCenterToBoxDistance = closestPointOffSetToSphere.GetLength();
-
-        // Edge case: Sphere center within box. Confirmed collision but need to calculate penetration info in a different way
-        if (sphereCenterToBoxDistance == fp{0}) {
-            // FUTURE: Something feels off with below method vs ordinary method
-            //          Why does ordinary case resolve successfully in an arbitrary (sphere) direction, while here
-            //              we have to adhere to box normals?
-            //          Feels like there should be a smoother + more accurate (and likely more efficient) answer
-            // Albeit maybe I'm overthinking this, as it's pretty smooth when moving a small sphere through a big box
-
-            // Calculate direction and distance necessary to push sphere's center out of box and to the box's face
-            FVectorFP dirToPushSphereOutToBoxFace;
-            fp distanceToPushSphereCenterOutOfBox;
-            CalculateSmallestPushToOutsideBox(box, localSphereCenter, dirToPushSphereOutToBoxFace,
-                                              distanceToPushSphereCenterOutOfBox);
-
-            // To clear collision, the sphere needs to be pushed further until its surface only just touches the box
-            fp penetrationDistance = distanceToPushSphereCenterOutOfBox + sphere.GetSphereRadius();
-
-            // Finally return result
-            // Note that NOT flipping face normal as this follows penetration axis standard (ie, direction that first collider is penetrating into B)
-            return ImpactResult(dirToPushSphereOutToBoxFace, penetrationDistance);
-        }
-
-        // Calculate how much sphere is intersecting into the box, if at all
-        fp intersectionDepth = sphere.GetSphereRadius() - sphereCenterToBoxDistance;
-        if (intersectionDepth > fp{0}) {
-            return ImpactResult(closestPointOffSetToSphere.Normalized(), intersectionDepth);
-        }
+        // Sphere is simply a rounded segment of zero length, so same approach as box vs capsule
+        FVectorFP boxSpaceSphereCenter = box.ToLocalSpaceFromWorld(sphere.GetCenter());
+        Line boxSpaceSphereSegment(boxSpaceSphereCenter, boxSpaceSphereCenter);
 
-        return ImpactResult::noCollision();
+        FVectorFP boxSpacePenetrationDir;
+        fp penetrationDepth;
+        if (!CalculateBoxAndRoundedSegmentPenetration(box.GetBoxHalfSize(), boxSpaceSphereSegment,
+                                                      sphere.GetSphereRadius(), boxSpacePenetrationDir, penetrationDepth)) {
+            return ImpactResult::noCollision();
+        }
+        return ImpactResult(box.ToWorldSpaceForOriginCenteredValue(boxSpacePenetrationDir), penetrationDepth);
     }
 
     ImpactResult ComplexCollisions::IsCapsuleAndSphereColliding(CoreContext& coreContext, const FCollider& capsule,
@@ -477,367 +450,120 @@ namespace ProjectNomad {
         return ImpactResult(penetrationDir, penetrationMagnitude);
     }
 
-    void ComplexCollisions::CalculateSmallestPushToOutsideBox(const FCollider& box,
-                                                  const FVectorFP& localSpacePoint,
-                                                  FVectorFP& outPushToOutsideBoxDirInWorldSpace,
-                                                  fp& outPushToBoxFaceDistance,
-                                                  bool useWrongDirectionFiltering,
-                                                  const FVectorFP& directionForFiltering) {
-        // Declare variables
-        fp smallestDistToPushSoFar = FPMath::maxLimit();
-        FVectorFP bestPushDirSoFar = FVectorFP::Zero();
-        // At time of writing this is guaranteed to be set again, but best to be safe
-        FVectorFP boxHalfSize = box.GetBoxHalfSize();
-        // Cache so don't have to recreate every time (given current implementation)
-
-        // Check each axis (pair of faces) for closest face distance to push point to
-        CheckIfFaceAlongAxisIsClosestToPoint(
-            boxHalfSize, FVectorFP::Forward(), localSpacePoint, smallestDistToPushSoFar, bestPushDirSoFar,
-            useWrongDirectionFiltering, directionForFiltering
-        );
-        CheckIfFaceAlongAxisIsClosestToPoint(
-            boxHalfSize, FVectorFP::Right(), localSpacePoint, smallestDistToPushSoFar, bestPushDirSoFar,
-            useWrongDirectionFiltering, directionForFiltering
+    ImpactResult ComplexCollisions::IsBoxAndRoundedShapeColliding(const RuntimeCollider& box,
+                                                                  const RuntimeCollider& roundedShape) {
+        // Spheres also have a (zero length) medial segment in runtime form
+        const Line& worldSpaceSegment = roundedShape.capsuleMedialSegment;
+        Line boxSpaceSegment(
+            box.ToLocalSpaceFromWorld(worldSpaceSegment.start), box.ToLocalSpaceFromWorld(worldSpaceSegment.end)
         );
-        CheckIfFaceAlongAxisIsClosestToPoint(
-            boxHalfSize, FVectorFP::Up(), localSpacePoint, smallestDistToPushSoFar, bestPushDirSoFar,
-            useWrongDirectionFiltering, directionForFiltering
-        );
-
-        // NOTE: No need to check edges, as edges will never be shorter distance than pushing out to a face
-        //       Easy check: Pythagoras. An edge is like the hypotenuse with faces are other parts of triangle/pyramid,
-        //                      and hypotenuse is always greater than the other parts
-
-        // Set results
-        outPushToBoxFaceDistance = smallestDistToPushSoFar; // Magnitude so don't need to convert to world space
-        outPushToOutsideBoxDirInWorldSpace = box.ToWorldSpaceForOriginCenteredValue(bestPushDirSoFar);
-    }
-
-    void ComplexCollisions::CheckIfFaceAlongAxisIsClosestToPoint(const FVectorFP& boxHalfSize,
-                                                     const FVectorFP& curAxisDir,
-                                                     const FVectorFP& pointToPush,
-                                                     fp& smallestDistSoFar,
-                                                     FVectorFP& bestPushDirSoFar,
-                                                     bool useWrongDirectionFiltering,
-                                                     const FVectorFP& directionForFiltering) {
-        fp pointExtentInAxis = curAxisDir.Dot(pointToPush); // Eg, Up.dot(Px, Py, Pz) will result in Pz
-        fp distanceToFace;
-
-        // First check if face along positive axis direction is the closest face to our point thus far
-        if (!useWrongDirectionFiltering || directionForFiltering.Dot(curAxisDir) >= fp{0}) {
-            fp extentInPosFaceDir = curAxisDir.Dot(boxHalfSize); // Eg, Up.dot(HalfSize) will result in zMax
-            distanceToFace = FPMath::abs(extentInPosFaceDir - pointExtentInAxis);
-
-            if (distanceToFace < smallestDistSoFar) {
-                // Remember this face as the closest face thus far
-                smallestDistSoFar = distanceToFace;
-                bestPushDirSoFar = curAxisDir;
-            }
-        }
-
-        // Next check if face along negative axis direction is the closest face to our point thus far
-        // Note that can't optimize this out as one direction may be closer than before but then other direction is even closer
-        if (!useWrongDirectionFiltering || directionForFiltering.Dot(-curAxisDir) >= fp{0}) {
-            FVectorFP negAxisDir = curAxisDir.Flipped();
-            fp extentInNegFaceDir = negAxisDir.Dot(boxHalfSize); // Eg, Down * HalfSize will result in -zMax
-            distanceToFace = FPMath::abs(extentInNegFaceDir - pointExtentInAxis);
 
-            if (distanceToFace < smallestDistSoFar) {
-                // Remember this face as the closest face thus far
-                smallestDistSoFar = distanceToFace;
-                bestPushDirSoFar = negAxisDir;
-            }
+        FVectorFP boxSpacePenetrationDir;
+        fp penetrationDepth;
+        if (!CalculateBoxAndRoundedSegmentPenetration(box.boxHalfSize, boxSpaceSegment, roundedShape.coreRadius,
+                                                      boxSpacePenetrationDir, penetrationDepth)) {
+            return ImpactResult::noCollision();
         }
+        return ImpactResult(box.ToWorldSpaceForOriginCenteredValue(boxSpacePenetrationDir), penetrationDepth);
     }
 
-    bool ComplexCollisions::GetBoxCapsuleIntersection(CoreContext& coreContext,
-                                          const FCollider& box,
-                                          const FCollider& expandedCheckBox,
-                                          const Line& boxSpaceCapsuleMedialSegment,
-                                          const fp& capsuleRadius,
-                                          const fp& capsuleMedialHalfLineLength,
-                                          fp& timeOfIntersection,
-                                          FVectorFP& pointOfIntersection) {
-        // Shortcut variables
-        const FVectorFP& boxSpaceCapsulePointA = boxSpaceCapsuleMedialSegment.start;
-        const FVectorFP& boxSpaceCapsulePointB = boxSpaceCapsuleMedialSegment.end;
-
-        // Intersect ray against expanded box. Exit with no intersection if ray misses box, else get intersection point and time as result
-        // NOTE: Pretty certain didn't need to convert to box space for this test (since raycast does that)
-        //          Minor optimization: Do this raycast test *before* converting to box local space
-        //          HOWEVER, may not work due to following math (and if not possible, then update these comments so don't go down this path again)
-        Ray intersectionTestRay = Ray::fromPoints(boxSpaceCapsulePointA, boxSpaceCapsulePointB);
-        bool didRaycastIntersectCheckBox = SimpleCollisions::raycastForAABB(
-            coreContext, intersectionTestRay, expandedCheckBox, timeOfIntersection, pointOfIntersection
+    bool ComplexCollisions::CalculateBoxAndRoundedSegmentPenetration(const FVectorFP& boxHalfSize,
+                                                                     const Line& boxSpaceSegment,
+                                                                     fp radius,
+                                                                     FVectorFP& outBoxSpacePenetrationDir,
+                                                                     fp& outPenetrationDepth) {
+        fp throwaway;
+        FVectorFP closestSegmentPoint, closestBoxPoint;
+        fp distSq = CollisionHelpers::getClosestPtsBetweenSegmentAndAABB(
+            boxSpaceSegment, boxHalfSize, throwaway, closestSegmentPoint, closestBoxPoint
         );
-        // If raycast did not hit at all then definitely no collision
-        if (!didRaycastIntersectCheckBox) {
+        if (distSq >= radius * radius) {
             return false;
         }
-        // Verify that raycast intersection point is within range of the capsule median line
-        // (ie, turn this into a linetest)
-        timeOfIntersection = timeOfIntersection / (capsuleMedialHalfLineLength * 2);
-        // Raycast "time" is actually distance based
-        if (timeOfIntersection >= fp{1}) {
-            // Edge case: Median line is within the expanded box but doesn't intersect with the surface of the box.
-            //              Raycast usage will not catch this case so check for it explicitly 
-            if (expandedCheckBox.IsLocalSpacePtWithinBoxExcludingOnSurface(boxSpaceCapsulePointA)) {
-                // Default to final capsule median line point for further calculations
-                // Side note: Not sure whether to pick initial or final point, but given there's a min operation
-                //              operation with time later on, it's safest to use the maximum time. No idea if matters
-                timeOfIntersection = fp{1};
-                // Latter linetest considers 1 = 100% of line length. Yes this is inconsistent with raycast
-                pointOfIntersection = boxSpaceCapsulePointB;
-            }
-            // Otherwise the box is certainly too far for an intersection
-            else {
-                return false;
-            }
-        }
 
-        // Compute which min and max faces of box the intersection point lies outside of.
-        // Note, the two vars cannot have the same bits set and they must have at least one bit set among them
-        uint32_t lessThanMinExtentChecks = 0, greaterThanMaxExtentChecks = 0;
-        FVectorFP minBoxExtents = -box.GetBoxHalfSize();
-        FVectorFP maxBoxExtents = box.GetBoxHalfSize();
-        if (pointOfIntersection.x < minBoxExtents.x) lessThanMinExtentChecks |= 1;
-        if (pointOfIntersection.x > maxBoxExtents.x) greaterThanMaxExtentChecks |= 1;
-        if (pointOfIntersection.y < minBoxExtents.y) lessThanMinExtentChecks |= 2;
-        if (pointOfIntersection.y > maxBoxExtents.y) greaterThanMaxExtentChecks |= 2;
-        if (pointOfIntersection.z < minBoxExtents.z) lessThanMinExtentChecks |= 4;
-        if (pointOfIntersection.z > maxBoxExtents.z) greaterThanMaxExtentChecks |= 4;
-
-        // "Or" all set bits together into a bit mask (note: effectively here u + v == u | v as same bit can't be set in both variables)
-        uint32_t mask = lessThanMinExtentChecks + greaterThanMaxExtentChecks;
-
-        // If all 3 bits set (m == 7) then intersection point (if any) is in a vertex region
-        if (mask == 7) {
-            bool didIntersect;
-
-            // Must now intersect capsule line segment against the capsules of the three
-            // edges meeting at the vertex and return the best time, if one or more hit
-            fp tMin = FPMath::maxLimit();
-            FVectorFP tMinIntersectionPoint;
-
-            // Note that endpoint of test line will be changed for each test
-            Line testCapsuleMedianLine(
-                SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents, greaterThanMaxExtentChecks),
-                FVectorFP::Zero()
-            );
-
-            testCapsuleMedianLine.end = SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents,
-                                                                    greaterThanMaxExtentChecks ^ 1);
-            didIntersect = SimpleCollisions::LinetestWithCapsule(
-                coreContext, boxSpaceCapsuleMedialSegment, testCapsuleMedianLine,
-                capsuleRadius, timeOfIntersection, pointOfIntersection
-            );
-            if (didIntersect && timeOfIntersection < tMin) {
-                tMin = timeOfIntersection;
-                tMinIntersectionPoint = pointOfIntersection;
-            }
+        // Shallow case: Only the rounded part overlaps, so push directly away from closest box feature
+        fp distance = FPMath::sqrt(distSq);
+        if (distance > CollisionHelpers::getEpsilon()) {
+            outBoxSpacePenetrationDir = (closestSegmentPoint - closestBoxPoint) / distance;
+            outPenetrationDepth = radius - distance;
+            return true;
+        }
 
-            testCapsuleMedianLine.end = SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents,
-                                                                    greaterThanMaxExtentChecks ^ 2);
-            didIntersect = SimpleCollisions::LinetestWithCapsule(
-                coreContext, boxSpaceCapsuleMedialSegment, testCapsuleMedianLine,
-                capsuleRadius, timeOfIntersection, pointOfIntersection
-            );
-            if (didIntersect && timeOfIntersection < tMin) {
-                tMin = timeOfIntersection;
-                tMinIntersectionPoint = pointOfIntersection;
-            }
+        // Deep case: Segment itself touches box, so push whole segment out then further by radius
+        fp segmentPushDistance;
+        CollisionHelpers::getSmallestPushOfSegmentOutOfAABB(
+            boxSpaceSegment, boxHalfSize, outBoxSpacePenetrationDir, segmentPushDistance
+        );
+        outPenetrationDepth = segmentPushDistance + radius;
+        return true;
+    }
 
-            testCapsuleMedianLine.end = SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents,
-                                                                    greaterThanMaxExtentChecks ^ 4);
-            didIntersect = SimpleCollisions::LinetestWithCapsule(
-                coreContext, boxSpaceCapsuleMedialSegment, testCapsuleMedianLine,
-                capsuleRadius, timeOfIntersection, pointOfIntersection
-            );
-            if (didIntersect && timeOfIntersection < tMin) {
-                tMin = timeOfIntersection;
-                tMinIntersectionPoint = pointOfIntersection;
-            }
+    bool ComplexCollisions::TryReuseCachedContact(const RuntimeCollider& A,
+                                                  const RuntimeCollider& B,
+                                                  const NarrowphaseCacheEntry& cacheEntry,
+                                                  ImpactResult& outResult) {
+        static constexpr fp kMaxCachedContactDriftSquared = kMaxCachedContactDrift * kMaxCachedContactDrift;
 
-            // If didn't find a single intersection, then confirmed that there was no intersection
-            if (tMin == FPMath::maxLimit()) {
-                return false;
-            }
+        const CachedContact& contact = cacheEntry.contact;
+        if (!contact.isValid || cacheEntry.lastUsedFrame - contact.calculatedFrame > kMaxCachedContactAge) {
+            return false;
+        }
 
-            timeOfIntersection = tMin;
-            pointOfIntersection = tMinIntersectionPoint;
-            return true;
+        // Movement along the axis is accounted for exactly by projecting onto axis below, but sideways movement may
+        //      expose a different (shallower) axis. Eg, a capsule sliding off the edge of a box
+        FVectorFP drift = (B.center - A.center) - contact.referenceOffset;
+        FVectorFP sidewaysDrift = drift - contact.axis * drift.Dot(contact.axis);
+        if (sidewaysDrift.GetLengthSquared() > kMaxCachedContactDriftSquared) {
+            return false;
         }
 
-        // If only one bit set in m, then intersection point is in a face region
-        if ((mask & (mask - 1)) == 0) {
-            // Do nothing. Time t from intersection with expanded box is correct intersection time
-            // TODO: Comment is incorrect, as doesn't work for case where median line within extended capsule
+        // Separating axis theorem: No overlap along any single axis means no collision at all
+        fp overlap = CalculateOverlapAlongAxis(A, B, contact.axis);
+        if (overlap <= fp{0}) {
+            outResult = ImpactResult::noCollision();
             return true;
         }
 
-        // p is in an edge region. Intersect against the capsule at the edge
-        Line testCapsuleMedianLine(
-            SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents, lessThanMinExtentChecks ^ 7),
-            SimpleCollisions::getCorner(minBoxExtents, maxBoxExtents, greaterThanMaxExtentChecks)
-        );
-        bool didIntersect = SimpleCollisions::LinetestWithCapsule(
-            coreContext,
-            boxSpaceCapsuleMedialSegment,
-            testCapsuleMedianLine,
-            capsuleRadius,
-            timeOfIntersection,
-            pointOfIntersection
-        );
+        // Otherwise only trust the axis as penetration axis if it was one before and hasn't gotten much deeper since.
+        //      Moving out along axis keeps it the shallowest axis, but moving deeper may not
+        if (!contact.wasColliding || overlap > contact.depth + kMaxCachedContactDrift) {
+            return false;
+        }
 
-        return didIntersect;
+        outResult = ImpactResult(contact.axis, overlap);
+        return true;
     }
 
-    ImpactResult ComplexCollisions::CalculateBoxCapsulePenetrationInfo(CoreContext& coreContext,
-                                                           const FCollider& box,
-                                                           const FCollider& capsule,
-                                                           const FCollider& expandedCheckBox,
-                                                           const Line& boxSpaceCapsuleMedialLine,
-                                                           const fp& timeOfInitialIntersection,
-                                                           const FVectorFP& pointOfInitialIntersection) {
-        if (!box.IsBox()) {
-            coreContext.logger.
-                        LogErrorMessage("Provided collider was not a box but instead a " + box.GetTypeAsString());
-            return ImpactResult::noCollision();
-        }
-        if (!expandedCheckBox.IsBox()) {
-            coreContext.logger.LogErrorMessage(
-                "Provided checkAgainstBox collider was not a box but instead a " + box.GetTypeAsString());
-            return ImpactResult::noCollision();
-        }
-        if (!capsule.IsCapsule()) {
-            coreContext.logger.LogErrorMessage(
-                "Collider capsule was not a capsule but instead a " + capsule.GetTypeAsString());
-            return ImpactResult::noCollision();
-        }
-
-        // Check if either capsule medial line endpoints are within the expanded box.
-        //      Specifically checking expanded box as it includes capsule radius (eg, catch case where capsule median
-        //      line is right outside original box but intersecting due to the width of the capsule itself)
-        // TODO: Check if there are any inaccuracies stemming from expanded box corners vs normal box
-        bool isCapsuleLineStartInExpandedBox = expandedCheckBox.IsLocalSpacePtWithinBoxExcludingOnSurface(
-            boxSpaceCapsuleMedialLine.start);
-        bool isCapsuleLineEndInExpandedBox = expandedCheckBox.IsLocalSpacePtWithinBoxExcludingOnSurface(
-            boxSpaceCapsuleMedialLine.end);
-
-        /// Choose approach depending on number of endpoints within box
-        //  Note that standard is for pen direction to point from one object INTO other object,
-        //      and specifically from box's perspective (as box-capsule method has box as first 
-        FVectorFP boxPenetrationDirInWorldSpace = FVectorFP::Zero();
-        fp penetrationMagnitude = fp{0};
-        FVectorFP capsuleLineDir = boxSpaceCapsuleMedialLine.getDirection();
-        if (isCapsuleLineStartInExpandedBox && isCapsuleLineEndInExpandedBox) {
-            // Approach: We have 2 options for getting capsule out of box with smallest possible movement:
-            // 1. Parallel to line direction: Move first medial line endpoints towards other endpoint and out of box
-            // 2. Opposite line direction: Move second endpoint towards first endpoint and out of box
-            // Calculate both and choose the one with smallest movement
-
-            // Thus, the approach here is to solve for all three approaches then choose one with smallest distance
-            // Approach 1: Try moving start endpoint to closest face in general line direction
-            FVectorFP fromStartPenetrationDirInWorldSpace;
-            fp fromStartPenetrationMagnitude;
-            CalculateSmallestPushToOutsideBox(
-                expandedCheckBox, boxSpaceCapsuleMedialLine.start, fromStartPenetrationDirInWorldSpace,
-                fromStartPenetrationMagnitude,
-                true, capsuleLineDir
-            );
-
-            // Approach 2: Try moving end endpoint to closest face in opposite line direction
-            FVectorFP fromEndPenetrationDirInWorldSpace;
-            fp fromEndPenetrationMagnitude;
-            CalculateSmallestPushToOutsideBox(
-                expandedCheckBox, boxSpaceCapsuleMedialLine.end, fromEndPenetrationDirInWorldSpace,
-                fromEndPenetrationMagnitude,
-                true, capsuleLineDir.Flipped()
-            );
-
-            // Finally choose the push method with the smallest distance
-            if (fromEndPenetrationMagnitude < fromStartPenetrationMagnitude) {
-                penetrationMagnitude = fromEndPenetrationMagnitude;
-                boxPenetrationDirInWorldSpace = fromEndPenetrationDirInWorldSpace;
-            } else {
-                penetrationMagnitude = fromStartPenetrationMagnitude;
-                boxPenetrationDirInWorldSpace = fromStartPenetrationDirInWorldSpace;
-            }
-        } else if (isCapsuleLineStartInExpandedBox) {
-            // Simple approach: Move endpoint to closest face while ignoring faces opposite of line direction
-            CalculateSmallestPushToOutsideBox(
-                expandedCheckBox, boxSpaceCapsuleMedialLine.start, boxPenetrationDirInWorldSpace, penetrationMagnitude,
-                true, capsuleLineDir
-            );
-        } else if (isCapsuleLineEndInExpandedBox) {
-            // Simple approach: Move endpoint to closest face while ignoring faces opposite of line direction
-            CalculateSmallestPushToOutsideBox(
-                expandedCheckBox, boxSpaceCapsuleMedialLine.end, boxPenetrationDirInWorldSpace, penetrationMagnitude,
-                true, capsuleLineDir.Flipped()
-            );
-        }
-        // Otherwise no medial line endpoint within box... 
-        else {
-            // Given we need to move the ENTIRE intersection line of the box but intersection is in middle of capsule,
-            //      we'll need to focus on the best direction to move the intersection itself.
-            // Note that need to move the middle point of the intersection line (and perpendicularly to line),
-            //      as it guarantees all intersecting points will exit the box.
-            // Approach:
-            // 1. Get middle point of intersection
-            // 2. Find closest face to move middle point out of box
-            // 3. Get perpendicular-to-line direction that closest matches the closest face
-            // 4. Calculate distance via raycast method
-
-            /// 1. Get middle point of intersection
-            // Get intersection point when line is reversed
-            FVectorFP pointOfLastIntersection;
-            fp throwaway;
-            Line reversedMedialLine(boxSpaceCapsuleMedialLine.end, boxSpaceCapsuleMedialLine.start);
-            GetBoxCapsuleIntersection(
-                coreContext, box, expandedCheckBox, reversedMedialLine, capsule.GetCapsuleRadius(),
-                capsule.GetMedialHalfLineLength(),
-                throwaway, pointOfLastIntersection
-            );
-            // Finally calculate middle of intersection
-            FVectorFP middleIntersectionPoint = (pointOfInitialIntersection + pointOfLastIntersection) / fp{2};
-
-            /// Steps 2-4 will be handled by following method:
-            GetBestPushInfoOutOfBoxForMiddlePointOfBoxSpaceLine(
-                coreContext, expandedCheckBox, middleIntersectionPoint, capsuleLineDir,
-                boxPenetrationDirInWorldSpace, penetrationMagnitude
-            );
-        }
-
-        return ImpactResult(boxPenetrationDirInWorldSpace, penetrationMagnitude);
+    void ComplexCollisions::CacheContact(const RuntimeCollider& A,
+                                         const RuntimeCollider& B,
+                                         const ImpactResult& fullResult,
+                                         NarrowphaseCacheEntry& inOutCacheEntry) {
+        CachedContact& contact = inOutCacheEntry.contact;
+        contact.referenceOffset = B.center - A.center;
+        contact.calculatedFrame = inOutCacheEntry.lastUsedFrame;
+
+        if (fullResult.isColliding) {
+            contact.isValid = true;
+            contact.wasColliding = true;
+            contact.axis = fullResult.penetrationDirection;
+            contact.depth = fullResult.penetrationMagnitude;
+            return;
+        }
+
+        // Full checks don't return a separating axis, but direction between centers is one in most cases that matter
+        //      (ie, nearby roughly convex-ish arrangements). If not, simply don't cache anything
+        FVectorFP candidateAxis = contact.referenceOffset.Normalized();
+        contact.isValid = !candidateAxis.IsZero() && CalculateOverlapAlongAxis(A, B, candidateAxis) <= fp{0};
+        contact.wasColliding = false;
+        contact.axis = candidateAxis;
+        contact.depth = fp{0};
     }
-    
-    void ComplexCollisions::GetBestPushInfoOutOfBoxForMiddlePointOfBoxSpaceLine(CoreContext& coreContext,
-                                                                    const FCollider& box,
-                                                                    const FVectorFP& middleIntersectionPoint,
-                                                                    const FVectorFP& lineDir,
-                                                                    FVectorFP& bestDirToPushLineOutOfBox,
-                                                                    fp& penetrationMagnitude) {
-        // Find closest face to move middle point out of box
-        FVectorFP smallestPushToFaceDir;
-        fp throwaway;
-        CalculateSmallestPushToOutsideBox(
-            box, middleIntersectionPoint, smallestPushToFaceDir, throwaway
-        );
 
-        // Get perpendicular-to-line direction that closest matches the closest-face direction
-        // Based on following: https://math.stackexchange.com/a/410549/815287
-        FVectorFP bestMovementDir = lineDir.Cross(smallestPushToFaceDir).Cross(lineDir);
-        // Warning: smallestPushToFaceDir x lineDir x lineDir will return opposite direction
-
-        /// Calculate distance via raycast method
-        // As this is all in local space, we will directly use the AABB method for raycast testing
-        Ray testRay(middleIntersectionPoint, bestMovementDir);
-        FVectorFP raycastIntersectionPoint;
-        fp raycastIntersectionTime;
-        SimpleCollisions::raycastForAABB(coreContext, testRay, box, raycastIntersectionTime, raycastIntersectionPoint);
-
-        // Finally set the well-earned results
-        bestDirToPushLineOutOfBox = box.ToWorldSpaceForOriginCenteredValue(bestMovementDir);
-        penetrationMagnitude = raycastIntersectionTime; // Raycast "time" is actually equivalent to distance
+    fp ComplexCollisions::CalculateOverlapAlongAxis(const RuntimeCollider& A,
+                                                    const RuntimeCollider& B,
+                                                    const FVectorFP& axis) {
+        fp maxAlongAxisForA = A.GetCoreFurthestPoint(axis).Dot(axis) + A.coreRadius;
+        fp minAlongAxisForB = B.GetCoreFurthestPoint(axis.Flipped()).Dot(axis) - B.coreRadius;
+        return maxAlongAxisForA - minAlongAxisForB;
     }
 }
@@ -1,18 +1,31 @@
 #pragma once
 #include "Model/CollisionData.h"
 #include "Math/FixedPoint.h"
+#include "Model/GjkData.h"
 
 struct FCollider;
 
 namespace ProjectNomad {
     class Line;
     struct CoreContext;
+    struct RuntimeCollider;
 
     class ComplexCollisions {
       public:
         ComplexCollisions() = delete;
 
         static ImpactResult IsColliding(CoreContext& coreContext, const FCollider& A, const FCollider& B);
+        /**
+        * Same as above, but first tries to reuse the last fully calculated contact for this pair (see CachedContact).
+        * Falls back to a full check only when cached axis can't be trusted, then caches that result. Box vs capsule and
+        *   box vs sphere full checks use the closed form box space routines rather than GJK/EPA, as those are both
+        *   exact and cheaper. The entry's GJK warm start is left to SweptCollisions, which does use GJK distances.
+        * @param inOutCacheEntry - persistent data for this specific pair. Expected to be retrieved this frame
+        **/
+        static ImpactResult IsColliding(CoreContext& coreContext,
+                                        const FCollider& A,
+                                        const FCollider& B,
+                                        NarrowphaseCacheEntry& inOutCacheEntry);
         static ImpactResult IsBoxAndBoxColliding(CoreContext& coreContext, const FCollider& boxA, const FCollider& boxB);
         static ImpactResult IsCapsuleAndCapsuleColliding(CoreContext& coreContext, const FCollider& capA, const FCollider& capB);
         static ImpactResult IsSphereAndSphereColliding(CoreContext& coreContext, const FCollider& sphereA, const FCollider& sphereB);
@@ -21,57 +34,38 @@ namespace ProjectNomad {
         static ImpactResult IsCapsuleAndSphereColliding(CoreContext& coreContext, const FCollider& capsule, const FCollider& sphere);
 
       private:
-        // Collision resolution purpose: Have a point in space within box and want to find which direction to push it,
-        //                                  such that it's the smallest direction to push the point out of the box
-        // NOTE: outPushToBoxFaceDistance is >= 0 (ie, is a magnitude and should not be negative)
-        static void CalculateSmallestPushToOutsideBox(const FCollider& box,
-                                                      const FVectorFP& localSpacePoint,
-                                                      FVectorFP& outPushToOutsideBoxDirInWorldSpace,
-                                                      fp& outPushToBoxFaceDistance,
-                                                      bool useWrongDirectionFiltering = false,
-                                                      const FVectorFP& directionForFiltering = FVectorFP::Zero());
+        // Max sideways movement (relative to cached axis) before a different axis could plausibly become shallower
+        static constexpr fp kMaxCachedContactDrift = fp{0.25f};
+        // Cached axis is recalculated at least this often, as rotation changes aren't otherwise accounted for
+        static constexpr FrameType kMaxCachedContactAge = 10;
 
-        // curAxisDir = Up, Right, or Forward vectors as working in box local space
-        static void CheckIfFaceAlongAxisIsClosestToPoint(const FVectorFP& boxHalfSize,
-                                                         const FVectorFP& curAxisDir,
-                                                         const FVectorFP& pointToPush,
-                                                         fp& smallestDistSoFar,
-                                                         FVectorFP& bestPushDirSoFar,
-                                                         bool useWrongDirectionFiltering,
-                                                         const FVectorFP& directionForFiltering);
+        /**
+        * Checks if cached contact is still trustworthy, and if so calculates result purely from the cached axis
+        * @returns true if outResult was set from cached contact
+        **/
+        static bool TryReuseCachedContact(const RuntimeCollider& A,
+                                          const RuntimeCollider& B,
+                                          const NarrowphaseCacheEntry& cacheEntry,
+                                          ImpactResult& outResult);
+        static void CacheContact(const RuntimeCollider& A,
+                                 const RuntimeCollider& B,
+                                 const ImpactResult& fullResult,
+                                 NarrowphaseCacheEntry& inOutCacheEntry);
+        // How far A's extent along axis passes B's extent along axis. Non-positive means axis separates A and B
+        static fp CalculateOverlapAlongAxis(const RuntimeCollider& A, const RuntimeCollider& B, const FVectorFP& axis);
 
-        static bool GetBoxCapsuleIntersection(CoreContext& coreContext,
-                                              const FCollider& box,
-                                              const FCollider& expandedCheckBox,
-                                              const Line& boxSpaceCapsuleMedialSegment,
-                                              const fp& capsuleRadius,
-                                              const fp& capsuleMedialHalfLineLength,
-                                              fp& timeOfIntersection,
-                                              FVectorFP& pointOfIntersection);
-
-        static ImpactResult CalculateBoxCapsulePenetrationInfo(CoreContext& coreContext,
-                                                               const FCollider& box,
-                                                               const FCollider& capsule,
-                                                               const FCollider& expandedCheckBox,
-                                                               const Line& boxSpaceCapsuleMedialLine,
-                                                               const fp& timeOfInitialIntersection,
-                                                               const FVectorFP& pointOfInitialIntersection);
-
-        /// <summary>Calculate which direction to push an intersecting line out of a box with minimum distance</summary>
-        /// <param name="box">Box to push line out of</param>
-        /// <param name="middleIntersectionPoint">
-        /// Middle of intersection of line. Note that this isn't necessarily the middle point of an ENTIRE line segment but
-        /// the merely middle of the segment of the line which intersects the box. 
-        /// </param>
-        /// <param name="lineDir">Normalized direction of the line</param>
-        /// <param name="bestDirToPushLineOutOfBox">Output variable, direction to push middle point out of box</param>
-        /// <param name="penetrationMagnitude">Output variable, how much to push middleIntersectionPoint along output direction</param>
-        static void GetBestPushInfoOutOfBoxForMiddlePointOfBoxSpaceLine(CoreContext& coreContext,
-                                                                        const FCollider& box,
-                                                                        const FVectorFP& middleIntersectionPoint,
-                                                                        const FVectorFP& lineDir,
-                                                                        FVectorFP& bestDirToPushLineOutOfBox,
-                                                                        fp& penetrationMagnitude);
-        
+        // Same as IsBoxAndCapsuleColliding/IsBoxAndSphereColliding, but with precalculated rotation data
+        static ImpactResult IsBoxAndRoundedShapeColliding(const RuntimeCollider& box, const RuntimeCollider& roundedShape);
+        /**
+        * Closed form penetration of a rounded segment (capsule, or sphere when segment is a single point) into a box,
+        *   all in box's local space where box is an AABB. Depth is the smallest push which separates the two.
+        * @param outBoxSpacePenetrationDir - normalized, pointing from box towards rounded segment
+        * @returns true if colliding, in which case outputs are set
+        **/
+        static bool CalculateBoxAndRoundedSegmentPenetration(const FVectorFP& boxHalfSize,
+                                                             const Line& boxSpaceSegment,
+                                                             fp radius,
+                                                             FVectorFP& outBoxSpacePenetrationDir,
+                                                             fp& outPenetrationDepth);
     };
 }
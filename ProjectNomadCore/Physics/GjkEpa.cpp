@@ -0,0 +1,632 @@
+#include "GjkEpa.h"
+
+#include "Context/CoreContext.h"
+#include "Math/FPMath.h"
+#include "Model/FCollider.h"
+
+namespace ProjectNomad {
+    namespace {
+        // Distance considered "close enough" for both overlap detection and convergence. Fixed point has ~0.00002
+        //      precision, but values that small don't survive the rescaling done in closest point calculations
+        constexpr fp kGjkTolerance = fp{0.01f};
+        constexpr fp kEpaTolerance = fp{0.01f};
+
+        /**
+        * Power of two scale which brings the largest coordinate of the given points to roughly unit size.
+        * Dividing by a power of two is exact in fixed point, so barycentric weights computed on scaled points stay
+        *   as precise as possible while products of dot products can no longer overflow (or underflow to 0).
+        **/
+        fp CalculateUnitScale(const FVectorFP* points, uint32_t pointCount) {
+            fp maxCoordinate = fp{0};
+            for (uint32_t i = 0; i < pointCount; i++) {
+                maxCoordinate = FPMath::max(maxCoordinate, FPMath::abs(points[i].x));
+                maxCoordinate = FPMath::max(maxCoordinate, FPMath::abs(points[i].y));
+                maxCoordinate = FPMath::max(maxCoordinate, FPMath::abs(points[i].z));
+            }
+
+            static constexpr fp kMinScale = fp{1} / fp{256};
+            fp scale = fp{1};
+            while (scale < maxCoordinate) {
+                scale *= fp{2};
+            }
+            while (scale / fp{2} >= maxCoordinate && scale > kMinScale) {
+                scale /= fp{2};
+            }
+            return scale;
+        }
+
+        // Normalizes edges before crossing, as crossing raw edges of level-sized shapes overflows once squared
+        FVectorFP CalculateTriangleNormal(const FVectorFP& a, const FVectorFP& b, const FVectorFP& c) {
+            FVectorFP edgeAB = (b - a).Normalized();
+            FVectorFP edgeAC = (c - a).Normalized();
+            return edgeAB.Cross(edgeAC).Normalized();
+        }
+
+        struct EpaFace {
+            uint32_t a = 0;
+            uint32_t b = 0;
+            uint32_t c = 0;
+            FVectorFP normal = FVectorFP::Zero();
+            fp distance = fp{0};
+            bool isValid = false;
+        };
+
+        struct EpaEdge {
+            uint32_t a = 0;
+            uint32_t b = 0;
+        };
+    }
+
+    GjkDistanceResult GjkEpa::CalculateCoreDistance(const RuntimeCollider& A,
+                                                    const RuntimeCollider& B,
+                                                    GjkWarmStart& inOutWarmStart) {
+        GjkDistanceResult result;
+
+        Simplex simplex;
+        InitializeSimplex(A, B, SupportMode::Core, inOutWarmStart, simplex);
+
+        FVectorFP closestPoint;
+        result.areCoresOverlapping = RunGjk(A, B, SupportMode::Core, simplex, closestPoint, result.iterations);
+        if (!result.areCoresOverlapping) {
+            result.coreDistance = closestPoint.GetLength();
+            // Closest point on A - B is (closest on A) - (closest on B), so direction from A to B is its opposite
+            result.directionAToB = closestPoint.Flipped().Normalized();
+        }
+
+        StoreWarmStart(simplex, inOutWarmStart);
+        return result;
+    }
+
+    ImpactResult GjkEpa::IsColliding(CoreContext& coreContext,
+                                     const RuntimeCollider& A,
+                                     const RuntimeCollider& B,
+                                     GjkWarmStart& inOutWarmStart,
+                                     uint32_t* outIterationCount) {
+        if (A.IsNotInitialized() || B.IsNotInitialized()) {
+            coreContext.logger.LogErrorMessage("Collider was not initialized");
+            return ImpactResult::noCollision();
+        }
+
+        GjkDistanceResult coreResult = CalculateCoreDistance(A, B, inOutWarmStart);
+        if (outIterationCount) {
+            *outIterationCount = coreResult.iterations;
+        }
+        fp radiusSum = A.coreRadius + B.coreRadius;
+
+        // Shallow case: Cores are apart, so penetration is simply how much the radii overlap. No EPA needed
+        if (!coreResult.areCoresOverlapping) {
+            if (coreResult.coreDistance >= radiusSum) {
+                return ImpactResult::noCollision(); // Touching is not considered colliding
+            }
+            return ImpactResult(coreResult.directionAToB, radiusSum - coreResult.coreDistance);
+        }
+
+        // Deep case: Need a tetrahedron enclosing the origin within the full shapes for EPA. Seeding from the core
+        //      result's directions typically gives such a tetrahedron immediately
+        uint32_t iterations = coreResult.iterations;
+        Simplex simplex;
+        InitializeSimplex(A, B, SupportMode::FullShape, inOutWarmStart, simplex);
+        FVectorFP closestPoint;
+        bool areShapesOverlapping = RunGjk(A, B, SupportMode::FullShape, simplex, closestPoint, iterations);
+        if (!areShapesOverlapping || !ExpandToTetrahedron(A, B, simplex)) {
+            // Only possible within tolerance of touching, ie not meaningfully colliding
+            if (outIterationCount) {
+                *outIterationCount = iterations;
+            }
+            return ImpactResult::noCollision();
+        }
+
+        ImpactResult result = RunEpa(coreContext, A, B, simplex, iterations);
+        if (outIterationCount) {
+            *outIterationCount = iterations;
+        }
+        return result;
+    }
+
+    GjkDistanceResult GjkEpa::CalculateCoreDistance(const FCollider& A,
+                                                    const FCollider& B,
+                                                    GjkWarmStart& inOutWarmStart) {
+        return CalculateCoreDistance(RuntimeCollider(A), RuntimeCollider(B), inOutWarmStart);
+    }
+
+    ImpactResult GjkEpa::IsColliding(CoreContext& coreContext,
+                                     const FCollider& A,
+                                     const FCollider& B,
+                                     GjkWarmStart& inOutWarmStart,
+                                     uint32_t* outIterationCount) {
+        if (A.IsNotInitialized() || B.IsNotInitialized()) {
+            coreContext.logger.LogErrorMessage(
+                "Collider was not initialized. A: " + A.GetTypeAsString() + ", B: " + B.GetTypeAsString()
+            );
+            return ImpactResult::noCollision();
+        }
+
+        return IsColliding(coreContext, RuntimeCollider(A), RuntimeCollider(B), inOutWarmStart, outIterationCount);
+    }
+
+    ImpactResult GjkEpa::IsColliding(CoreContext& coreContext, const FCollider& A, const FCollider& B) {
+        GjkWarmStart coldStart;
+        return IsColliding(coreContext, A, B, coldStart);
+    }
+
+    SimplexVertex GjkEpa::GetSupport(const RuntimeCollider& A,
+                                     const RuntimeCollider& B,
+                                     const FVectorFP& direction,
+                                     SupportMode supportMode) {
+        SimplexVertex result;
+        result.direction = direction;
+
+        FVectorFP furthestOnA = A.GetCoreFurthestPoint(direction);
+        FVectorFP furthestOnB = B.GetCoreFurthestPoint(direction.Flipped());
+        result.point = furthestOnA - furthestOnB;
+
+        if (supportMode == SupportMode::FullShape) {
+            fp radiusSum = A.coreRadius + B.coreRadius;
+            if (radiusSum > fp{0}) {
+                result.point += direction.Normalized() * radiusSum;
+            }
+        }
+
+        return result;
+    }
+
+    bool GjkEpa::RunGjk(const RuntimeCollider& A,
+                        const RuntimeCollider& B,
+                        SupportMode supportMode,
+                        Simplex& simplex,
+                        FVectorFP& outClosestPoint,
+                        uint32_t& inOutIterations) {
+        static constexpr fp kGjkToleranceSquared = kGjkTolerance * kGjkTolerance;
+
+        fp prevDistanceSquared = fp{0};
+        Simplex prevSimplex;
+        FVectorFP prevClosestPoint;
+        for (uint32_t i = 0; i < kMaxGjkIterations; i++) {
+            bool isOriginEnclosed = ReduceToClosestPoint(simplex, outClosestPoint);
+            fp distanceSquared = outClosestPoint.GetLengthSquared();
+            if (isOriginEnclosed || distanceSquared <= kGjkToleranceSquared) {
+                outClosestPoint = FVectorFP::Zero();
+                return true;
+            }
+
+            // Closest distance must strictly decrease each iteration. Rounding can otherwise cycle between simplices,
+            //      or reduce a nearly flat tetrahedron to the wrong face. Either way, prior iteration was the best result
+            if (i > 0 && distanceSquared >= prevDistanceSquared) {
+                simplex = prevSimplex;
+                outClosestPoint = prevClosestPoint;
+                return false;
+            }
+            prevDistanceSquared = distanceSquared;
+            prevSimplex = simplex;
+            prevClosestPoint = outClosestPoint;
+
+            SimplexVertex newVertex = GetSupport(A, B, outClosestPoint.Flipped(), supportMode);
+            inOutIterations++;
+
+            // Stop once new support point doesn't get meaningfully closer to origin than current closest point.
+            //      ie, v . (v - w) is (projected progress) * |v|
+            fp progressTimesLength = outClosestPoint.Dot(outClosestPoint - newVertex.point);
+            if (progressTimesLength <= kGjkTolerance * outClosestPoint.GetLength()) {
+                return false;
+            }
+            if (!simplex.Add(newVertex)) { // Already part of simplex, so no further progress possible
+                return false;
+            }
+        }
+
+        // Out of iterations. Closest point found so far is the best estimate
+        return ReduceToClosestPoint(simplex, outClosestPoint);
+    }
+
+    void GjkEpa::InitializeSimplex(const RuntimeCollider& A,
+                                   const RuntimeCollider& B,
+                                   SupportMode supportMode,
+                                   const GjkWarmStart& warmStart,
+                                   Simplex& outSimplex) {
+        outSimplex.Clear();
+        for (uint32_t i = 0; i < warmStart.directionCount; i++) {
+            outSimplex.Add(GetSupport(A, B, warmStart.directions[i], supportMode));
+        }
+
+        if (outSimplex.GetSize() == 0) {
+            // Cold start: Search from B towards A, as (center A - center B) is a point within A - B
+            FVectorFP initialDirection = B.center - A.center;
+            if (initialDirection.IsZero()) {
+                initialDirection = FVectorFP::Forward();
+            }
+            outSimplex.Add(GetSupport(A, B, initialDirection, supportMode));
+        }
+    }
+
+    void GjkEpa::StoreWarmStart(const Simplex& simplex, GjkWarmStart& outWarmStart) {
+        outWarmStart.directionCount = simplex.GetSize();
+        for (uint32_t i = 0; i < simplex.GetSize(); i++) {
+            outWarmStart.directions[i] = simplex.Get(i).direction;
+        }
+    }
+
+    bool GjkEpa::ReduceToClosestPoint(Simplex& simplex, FVectorFP& outClosestPoint) {
+        uint32_t size = simplex.GetSize();
+        FVectorFP scaledPoints[Simplex::kMaxVertices];
+        for (uint32_t i = 0; i < size; i++) {
+            scaledPoints[i] = simplex.GetPoint(i);
+        }
+        fp scale = CalculateUnitScale(scaledPoints, size);
+        for (uint32_t i = 0; i < size; i++) {
+            scaledPoints[i] = scaledPoints[i] / scale;
+        }
+
+        fp weights[Simplex::kMaxVertices] = {fp{0}, fp{0}, fp{0}, fp{0}};
+        bool isOriginEnclosed = false;
+
+        if (size == 1) {
+            weights[0] = fp{1};
+        }
+        else if (size == 2) {
+            fp segmentWeights[2];
+            CalculateClosestOnSegment(scaledPoints[0], scaledPoints[1], segmentWeights);
+            weights[0] = segmentWeights[0];
+            weights[1] = segmentWeights[1];
+        }
+        else if (size == 3) {
+            fp triangleWeights[3];
+            CalculateClosestOnTriangle(scaledPoints[0], scaledPoints[1], scaledPoints[2], triangleWeights);
+            weights[0] = triangleWeights[0];
+            weights[1] = triangleWeights[1];
+            weights[2] = triangleWeights[2];
+        }
+        else if (size == 4) {
+            // Based on Real-Time Collision Detection, Section 5.1.6 (ClosestPtPointTetrahedron).
+            //      Each face is listed with the vertex opposite to it
+            static constexpr uint32_t kFaces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+
+            bool wasAnyFaceOutside = false;
+            fp bestDistanceSquared = fp{0};
+            for (const auto& face : kFaces) {
+                const FVectorFP& a = scaledPoints[face[0]];
+                const FVectorFP& b = scaledPoints[face[1]];
+                const FVectorFP& c = scaledPoints[face[2]];
+                const FVectorFP& opposite = scaledPoints[face[3]];
+
+                // Origin is outside this face if it's on the opposite side of the face's plane from 4th vertex.
+                //      A flat tetrahedron (opposite vertex on plane) can't enclose anything, so check all its faces
+                FVectorFP normal = (b - a).Cross(c - a);
+                fp originSide = a.Flipped().Dot(normal);
+                fp oppositeSide = (opposite - a).Dot(normal);
+                bool isOutside = oppositeSide == fp{0} || (originSide > fp{0}) != (oppositeSide > fp{0});
+                if (!isOutside || (originSide == fp{0} && oppositeSide != fp{0})) {
+                    continue;
+                }
+
+                fp faceWeights[3];
+                CalculateClosestOnTriangle(a, b, c, faceWeights);
+                FVectorFP closestOnFace = a * faceWeights[0] + b * faceWeights[1] + c * faceWeights[2];
+                fp distanceSquared = closestOnFace.GetLengthSquared();
+                if (!wasAnyFaceOutside || distanceSquared < bestDistanceSquared) {
+                    wasAnyFaceOutside = true;
+                    bestDistanceSquared = distanceSquared;
+                    for (fp& weight : weights) {
+                        weight = fp{0};
+                    }
+                    weights[face[0]] = faceWeights[0];
+                    weights[face[1]] = faceWeights[1];
+                    weights[face[2]] = faceWeights[2];
+                }
+            }
+
+            if (!wasAnyFaceOutside) {
+                isOriginEnclosed = true;
+                for (fp& weight : weights) {
+                    weight = fp{1} / fp{4}; // Not meaningful, but keeps all vertices
+                }
+            }
+        }
+
+        outClosestPoint = FVectorFP::Zero();
+        bool isVertexUsed[Simplex::kMaxVertices] = {false, false, false, false};
+        for (uint32_t i = 0; i < size; i++) {
+            isVertexUsed[i] = weights[i] > fp{0};
+            outClosestPoint += simplex.GetPoint(i) * weights[i];
+        }
+        if (isOriginEnclosed) {
+            outClosestPoint = FVectorFP::Zero();
+        }
+
+        simplex.Reduce(isVertexUsed);
+        return isOriginEnclosed;
+    }
+
+    void GjkEpa::CalculateClosestOnSegment(const FVectorFP& a, const FVectorFP& b, fp (&outWeights)[2]) {
+        FVectorFP ab = b - a;
+        fp projectedOrigin = a.Flipped().Dot(ab);
+        fp segmentLengthSquared = ab.GetLengthSquared();
+
+        if (projectedOrigin <= fp{0}) {
+            outWeights[0] = fp{1};
+            outWeights[1] = fp{0};
+        }
+        else if (projectedOrigin >= segmentLengthSquared) {
+            outWeights[0] = fp{0};
+            outWeights[1] = fp{1};
+        }
+        else {
+            fp t = projectedOrigin / segmentLengthSquared;
+            outWeights[0] = fp{1} - t;
+            outWeights[1] = t;
+        }
+    }
+
+    void GjkEpa::CalculateClosestOnTriangle(const FVectorFP& a,
+                                            const FVectorFP& b,
+                                            const FVectorFP& c,
+                                            fp (&outWeights)[3]) {
+        // Based on Real-Time Collision Detection, Section 5.1.5 (ClosestPtPointTriangle) with query point at origin
+        outWeights[0] = fp{0};
+        outWeights[1] = fp{0};
+        outWeights[2] = fp{0};
+
+        FVectorFP ab = b - a;
+        FVectorFP ac = c - a;
+
+        // Vertex region outside A
+        fp d1 = ab.Dot(a.Flipped());
+        fp d2 = ac.Dot(a.Flipped());
+        if (d1 <= fp{0} && d2 <= fp{0}) {
+            outWeights[0] = fp{1};
+            return;
+        }
+
+        // Vertex region outside B
+        fp d3 = ab.Dot(b.Flipped());
+        fp d4 = ac.Dot(b.Flipped());
+        if (d3 >= fp{0} && d4 <= d3) {
+            outWeights[1] = fp{1};
+            return;
+        }
+
+        // Edge region of AB
+        fp vc = d1 * d4 - d3 * d2;
+        if (vc <= fp{0} && d1 >= fp{0} && d3 <= fp{0}) {
+            fp v = d1 / (d1 - d3);
+            outWeights[0] = fp{1} - v;
+            outWeights[1] = v;
+            return;
+        }
+
+        // Vertex region outside C
+        fp d5 = ab.Dot(c.Flipped());
+        fp d6 = ac.Dot(c.Flipped());
+        if (d6 >= fp{0} && d5 <= d6) {
+            outWeights[2] = fp{1};
+            return;
+        }
+
+        // Edge region of AC
+        fp vb = d5 * d2 - d1 * d6;
+        if (vb <= fp{0} && d2 >= fp{0} && d6 <= fp{0}) {
+            fp w = d2 / (d2 - d6);
+            outWeights[0] = fp{1} - w;
+            outWeights[2] = w;
+            return;
+        }
+
+        // Edge region of BC
+        fp va = d3 * d6 - d5 * d4;
+        if (va <= fp{0} && (d4 - d3) >= fp{0} && (d5 - d6) >= fp{0}) {
+            fp w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            outWeights[1] = fp{1} - w;
+            outWeights[2] = w;
+            return;
+        }
+
+        // Face region. Degenerate (zero area) triangles would divide by zero, so fall back to the best edge instead
+        fp denominator = va + vb + vc;
+        if (denominator <= fp{0}) {
+            const FVectorFP* points[3] = {&a, &b, &c};
+            fp bestDistanceSquared = fp{0};
+            for (uint32_t i = 0; i < 3; i++) {
+                uint32_t next = (i + 1) % 3;
+                fp edgeWeights[2];
+                CalculateClosestOnSegment(*points[i], *points[next], edgeWeights);
+                fp distanceSquared = (*points[i] * edgeWeights[0] + *points[next] * edgeWeights[1]).GetLengthSquared();
+                if (i == 0 || distanceSquared < bestDistanceSquared) {
+                    bestDistanceSquared = distanceSquared;
+                    outWeights[0] = fp{0};
+                    outWeights[1] = fp{0};
+                    outWeights[2] = fp{0};
+                    outWeights[i] = edgeWeights[0];
+                    outWeights[next] = edgeWeights[1];
+                }
+            }
+            return;
+        }
+
+        fp v = vb / denominator;
+        fp w = vc / denominator;
+        outWeights[0] = fp{1} - v - w;
+        outWeights[1] = v;
+        outWeights[2] = w;
+    }
+
+    bool GjkEpa::ExpandToTetrahedron(const RuntimeCollider& A, const RuntimeCollider& B, Simplex& simplex) {
+        static constexpr FVectorFP kSearchAxes[6] = {
+            FVectorFP::Forward(), FVectorFP::Backward(), FVectorFP::Right(),
+            FVectorFP::Left(), FVectorFP::Up(), FVectorFP::Down()
+        };
+
+        // Origin is on the boundary of any lower dimension simplex here (otherwise GJK would have kept going), so
+        //      adding points in any direction keeps origin within (or on) the resulting tetrahedron
+        if (simplex.GetSize() == 1) {
+            for (const FVectorFP& axis : kSearchAxes) {
+                if (simplex.Add(GetSupport(A, B, axis, SupportMode::FullShape))) {
+                    break;
+                }
+            }
+        }
+
+        if (simplex.GetSize() == 2) {
+            FVectorFP lineDir = (simplex.GetPoint(1) - simplex.GetPoint(0)).Normalized();
+            for (const FVectorFP& axis : kSearchAxes) {
+                FVectorFP perpendicular = lineDir.Cross(axis);
+                if (perpendicular.IsZero()) {
+                    continue;
+                }
+
+                SimplexVertex candidate = GetSupport(A, B, perpendicular, SupportMode::FullShape);
+                FVectorFP toCandidate = (candidate.point - simplex.GetPoint(0)).Normalized();
+                if (!lineDir.Cross(toCandidate).IsZero() && simplex.Add(candidate)) {
+                    break;
+                }
+            }
+        }
+
+        if (simplex.GetSize() == 3) {
+            FVectorFP normal = CalculateTriangleNormal(simplex.GetPoint(0), simplex.GetPoint(1), simplex.GetPoint(2));
+            if (normal.IsZero()) {
+                return false;
+            }
+
+            for (const FVectorFP& searchDir : {normal, normal.Flipped()}) {
+                SimplexVertex candidate = GetSupport(A, B, searchDir, SupportMode::FullShape);
+                if ((candidate.point - simplex.GetPoint(0)).Dot(normal) != fp{0} && simplex.Add(candidate)) {
+                    break;
+                }
+            }
+        }
+
+        return simplex.GetSize() == 4;
+    }
+
+    ImpactResult GjkEpa::RunEpa(CoreContext& coreContext,
+                                const RuntimeCollider& A,
+                                const RuntimeCollider& B,
+                                const Simplex& tetrahedron,
+                                uint32_t& inOutIterations) {
+        // Based on https://winter.dev/articles/epa-algorithm, but with fixed capacity for snapshot-friendly behavior
+        static constexpr uint32_t kMaxVertices = 4 + kMaxEpaIterations;
+        static constexpr uint32_t kMaxFaces = 128;
+        static constexpr uint32_t kMaxHorizonEdges = 64;
+
+        FVectorFP vertices[kMaxVertices];
+        uint32_t vertexCount = 0;
+        for (uint32_t i = 0; i < tetrahedron.GetSize(); i++) {
+            vertices[vertexCount++] = tetrahedron.GetPoint(i);
+        }
+
+        // Polytope stays convex and always contains the initial tetrahedron's centroid, which makes for a
+        //      robust "outward" reference even when origin itself is on the polytope's surface
+        FVectorFP interiorPoint = (vertices[0] + vertices[1] + vertices[2] + vertices[3]) / fp{4};
+
+        EpaFace faces[kMaxFaces];
+        uint32_t faceCount = 0;
+        auto addFace = [&](uint32_t a, uint32_t b, uint32_t c) {
+            if (faceCount >= kMaxFaces) {
+                return false;
+            }
+
+            EpaFace& face = faces[faceCount++];
+            face.a = a;
+            face.b = b;
+            face.c = c;
+            face.normal = CalculateTriangleNormal(vertices[a], vertices[b], vertices[c]);
+            face.isValid = !face.normal.IsZero();
+            if (face.normal.Dot(vertices[a] - interiorPoint) < fp{0}) {
+                face.b = c;
+                face.c = b;
+                face.normal.Flip();
+            }
+            face.distance = face.normal.Dot(vertices[a]);
+            return true;
+        };
+
+        addFace(0, 1, 2);
+        addFace(0, 3, 1);
+        addFace(0, 2, 3);
+        addFace(1, 3, 2);
+
+        int32_t closestFaceIndex = -1;
+        for (uint32_t iteration = 0; iteration < kMaxEpaIterations; iteration++) {
+            closestFaceIndex = -1;
+            for (uint32_t i = 0; i < faceCount; i++) {
+                if (faces[i].isValid && (closestFaceIndex < 0 || faces[i].distance < faces[closestFaceIndex].distance)) {
+                    closestFaceIndex = static_cast<int32_t>(i);
+                }
+            }
+            if (closestFaceIndex < 0) {
+                break;
+            }
+
+            const EpaFace closestFace = faces[closestFaceIndex];
+            FVectorFP support = GetSupport(A, B, closestFace.normal, SupportMode::FullShape).point;
+            inOutIterations++;
+
+            // Converged once polytope can't be expanded any further towards closest face
+            if (closestFace.normal.Dot(support) - closestFace.distance <= kEpaTolerance || vertexCount >= kMaxVertices) {
+                break;
+            }
+            uint32_t newVertexIndex = vertexCount;
+            vertices[vertexCount++] = support;
+
+            // Remove all faces which can "see" the new point, while tracking the boundary (horizon) of removed region.
+            //      Edges shared by two removed faces are interior and cancel out
+            EpaEdge horizonEdges[kMaxHorizonEdges];
+            uint32_t horizonEdgeCount = 0;
+            bool didHorizonOverflow = false;
+            for (uint32_t i = 0; i < faceCount; i++) {
+                EpaFace& face = faces[i];
+                if (!face.isValid || face.normal.Dot(support - vertices[face.a]) <= fp{0}) {
+                    continue;
+                }
+                face.isValid = false;
+
+                const EpaEdge faceEdges[3] = {{face.a, face.b}, {face.b, face.c}, {face.c, face.a}};
+                for (const EpaEdge& edge : faceEdges) {
+                    bool wasShared = false;
+                    for (uint32_t j = 0; j < horizonEdgeCount; j++) {
+                        if (horizonEdges[j].a == edge.b && horizonEdges[j].b == edge.a) {
+                            horizonEdges[j] = horizonEdges[horizonEdgeCount - 1];
+                            horizonEdgeCount--;
+                            wasShared = true;
+                            break;
+                        }
+                    }
+                    if (wasShared) {
+                        continue;
+                    }
+                    if (horizonEdgeCount >= kMaxHorizonEdges) {
+                        didHorizonOverflow = true;
+                        continue;
+                    }
+                    horizonEdges[horizonEdgeCount++] = edge;
+                }
+            }
+
+            bool didFaceOverflow = false;
+            for (uint32_t i = 0; i < horizonEdgeCount; i++) {
+                if (!addFace(horizonEdges[i].a, horizonEdges[i].b, newVertexIndex)) {
+                    didFaceOverflow = true;
+                }
+            }
+            if (didHorizonOverflow || didFaceOverflow) {
+                coreContext.logger.LogWarnMessage("EPA polytope exceeded max capacity, result may be imprecise");
+                break;
+            }
+        }
+
+        // Prior loop may have ended by invalidating closest face, so pick best remaining face
+        closestFaceIndex = -1;
+        for (uint32_t i = 0; i < faceCount; i++) {
+            if (faces[i].isValid && (closestFaceIndex < 0 || faces[i].distance < faces[closestFaceIndex].distance)) {
+                closestFaceIndex = static_cast<int32_t>(i);
+            }
+        }
+        if (closestFaceIndex < 0) {
+            coreContext.logger.LogWarnMessage("EPA found no valid polytope face");
+            return ImpactResult::noCollision();
+        }
+
+        // Face normal of A - B points from A towards B, as moving A by -normal * distance separates the shapes
+        const EpaFace& resultFace = faces[closestFaceIndex];
+        return ImpactResult(resultFace.normal, FPMath::max(fp{0}, resultFace.distance));
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Math/FixedPoint.h"
+#include "Math/FVectorFP.h"
+#include "Model/CollisionData.h"
+#include "Model/GjkData.h"
+#include "Model/RuntimeCollider.h"
+#include "Model/Simplex.h"
+
+struct FCollider;
+
+namespace ProjectNomad {
+    struct CoreContext;
+
+    struct GjkDistanceResult {
+        // True if core shapes (see ColliderHelpers::GetCoreFurthestPoint) overlap, ie penetration is deeper than radii
+        bool areCoresOverlapping = false;
+        // Distance between core shapes. 0 if overlapping
+        fp coreDistance = fp{0};
+        // Normalized direction from A's closest core point towards B's. Only valid if cores are not overlapping
+        FVectorFP directionAToB = FVectorFP::Zero();
+        uint32_t iterations = 0;
+    };
+
+    /// <summary>
+    /// Generic fixed point narrowphase for any pair of supported colliders via GJK (distance) and EPA (penetration).
+    ///
+    /// GJK runs on core shapes (box, line segment, point) with radii handled analytically, so shallow contacts such as
+    ///     capsule vs box resting contact never need EPA. EPA is only used when the cores themselves overlap.
+    /// All math works on the Minkowski difference A - B, which only depends on relative positions. Closest point
+    ///     calculations are additionally rescaled to unit size, as raw fixed point products of dot products would
+    ///     otherwise overflow for level-sized colliders.
+    ///
+    /// Warm starting: Pass the same GjkWarmStart for the same pair every frame (eg, via NarrowphaseCacheComponent).
+    ///     Last frame's final simplex directions are then re-evaluated first, which typically converges in 1-3
+    ///     iterations for coherent motion.
+    /// </summary>
+    class GjkEpa {
+      public:
+        GjkEpa() = delete;
+
+        static constexpr uint32_t kMaxGjkIterations = 32;
+        static constexpr uint32_t kMaxEpaIterations = 32;
+
+        /**
+        * Calculates distance between the core shapes of two colliders.
+        * @param inOutWarmStart - last frame's result for this pair (may be empty). Updated with this query's result
+        **/
+        static GjkDistanceResult CalculateCoreDistance(const RuntimeCollider& A,
+                                                       const RuntimeCollider& B,
+                                                       GjkWarmStart& inOutWarmStart);
+        static GjkDistanceResult CalculateCoreDistance(const FCollider& A,
+                                                       const FCollider& B,
+                                                       GjkWarmStart& inOutWarmStart);
+
+        /**
+        * Same interface and conventions as ComplexCollisions::IsColliding, ie penetration direction points from A
+        *   towards B and touching colliders are not considered colliding.
+        * @param inOutWarmStart - last frame's result for this pair (may be empty). Updated with this query's result
+        * @param outIterationCount - optional, set to total GJK + EPA iterations used (eg, for profiling and tests)
+        **/
+        static ImpactResult IsColliding(CoreContext& coreContext,
+                                        const RuntimeCollider& A,
+                                        const RuntimeCollider& B,
+                                        GjkWarmStart& inOutWarmStart,
+                                        uint32_t* outIterationCount = nullptr);
+        // Convenience overloads which create the runtime form of each collider first
+        static ImpactResult IsColliding(CoreContext& coreContext,
+                                        const FCollider& A,
+                                        const FCollider& B,
+                                        GjkWarmStart& inOutWarmStart,
+                                        uint32_t* outIterationCount = nullptr);
+        static ImpactResult IsColliding(CoreContext& coreContext, const FCollider& A, const FCollider& B);
+
+      private:
+        enum class SupportMode : uint8_t {
+            Core,     // Core shapes only, for GJK distance
+            FullShape // Including radii, for EPA
+        };
+
+        static SimplexVertex GetSupport(const RuntimeCollider& A,
+                                        const RuntimeCollider& B,
+                                        const FVectorFP& direction,
+                                        SupportMode supportMode);
+
+        /**
+        * Runs GJK starting from the given simplex until either origin is enclosed or closest point is found.
+        * @param simplex - starting simplex. Left as final simplex
+        * @param outClosestPoint - closest point on Minkowski difference to origin. Zero if overlapping
+        * @returns true if origin is within Minkowski difference (within tolerance)
+        **/
+        static bool RunGjk(const RuntimeCollider& A,
+                           const RuntimeCollider& B,
+                           SupportMode supportMode,
+                           Simplex& simplex,
+                           FVectorFP& outClosestPoint,
+                           uint32_t& inOutIterations);
+
+        static void InitializeSimplex(const RuntimeCollider& A,
+                                      const RuntimeCollider& B,
+                                      SupportMode supportMode,
+                                      const GjkWarmStart& warmStart,
+                                      Simplex& outSimplex);
+        static void StoreWarmStart(const Simplex& simplex, GjkWarmStart& outWarmStart);
+
+        /**
+        * Finds closest point to origin on current simplex, then drops any vertices not needed to express that point.
+        * @returns true if origin is enclosed by a full tetrahedron simplex
+        **/
+        static bool ReduceToClosestPoint(Simplex& simplex, FVectorFP& outClosestPoint);
+
+        // Weights are barycentric coordinates of closest point to origin. Vertices with zero weight are unused
+        static void CalculateClosestOnSegment(const FVectorFP& a, const FVectorFP& b, fp (&outWeights)[2]);
+        static void CalculateClosestOnTriangle(const FVectorFP& a,
+                                               const FVectorFP& b,
+                                               const FVectorFP& c,
+                                               fp (&outWeights)[3]);
+
+        // Grows a simplex enclosing origin (possibly on its boundary) into a tetrahedron suitable for EPA
+        static bool ExpandToTetrahedron(const RuntimeCollider& A, const RuntimeCollider& B, Simplex& simplex);
+
+        static ImpactResult RunEpa(CoreContext& coreContext,
+                                   const RuntimeCollider& A,
+                                   const RuntimeCollider& B,
+                                   const Simplex& tetrahedron,
+                                   uint32_t& inOutIterations);
+    };
+}
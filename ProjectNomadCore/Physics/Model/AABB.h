@@ -0,0 +1,108 @@
+#pragma once
+
+#include <CRCpp/CRC.h>
+
+#include "Math/FixedPoint.h"
+#include "Math/FPMath.h"
+#include "Math/FVectorFP.h"
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Defines a world axis-aligned bounding box via its min and max corners.
+    /// Intended for broadphase purposes, where cheap and conservative overlap tests matter far more than tightness
+    /// </summary>
+    struct AABB {
+        FVectorFP min = FVectorFP::Zero();
+        FVectorFP max = FVectorFP::Zero();
+
+        AABB() {}
+        AABB(const FVectorFP& min, const FVectorFP& max) : min(min), max(max) {}
+
+        static AABB FromCenterAndHalfSize(const FVectorFP& center, const FVectorFP& halfSize) {
+            return AABB(center - halfSize, center + halfSize);
+        }
+
+        // Smallest box which encloses both input boxes
+        static AABB Merge(const AABB& a, const AABB& b) {
+            return AABB(
+                FVectorFP(FPMath::min(a.min.x, b.min.x), FPMath::min(a.min.y, b.min.y), FPMath::min(a.min.z, b.min.z)),
+                FVectorFP(FPMath::max(a.max.x, b.max.x), FPMath::max(a.max.y, b.max.y), FPMath::max(a.max.z, b.max.z))
+            );
+        }
+
+        FVectorFP GetCenter() const {
+            return (min + max) / fp{2};
+        }
+
+        FVectorFP GetHalfSize() const {
+            return (max - min) / fp{2};
+        }
+
+        // Touching boxes are considered overlapping, as broadphase should err on the side of false positives
+        bool Overlaps(const AABB& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x
+                && min.y <= other.max.y && max.y >= other.min.y
+                && min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        bool Contains(const FVectorFP& point) const {
+            return point.x >= min.x && point.x <= max.x
+                && point.y >= min.y && point.y <= max.y
+                && point.z >= min.z && point.z <= max.z;
+        }
+
+        bool operator==(const AABB& other) const = default;
+
+        AABB Expanded(const fp& amount) const {
+            return AABB(min - FVectorFP(amount), max + FVectorFP(amount));
+        }
+
+        /**
+        * Slab test of a ray against this box (Real-Time Collision Detection, Section 5.3.3).
+        * Unlike SimpleCollisions::raycastForAABB, this does not calculate any hit point as only used for culling.
+        * @param origin - start of ray
+        * @param direction - normalized direction of ray
+        * @param maxDistance - max distance along ray to consider
+        * @param outEntryDistance - distance along ray where box is first entered. 0 if ray starts within box
+        * @returns true if ray touches box within [0, maxDistance]
+        **/
+        bool IntersectsRay(const FVectorFP& origin,
+                           const FVectorFP& direction,
+                           const fp& maxDistance,
+                           fp& outEntryDistance) const {
+            fp tMin = fp{0};
+            fp tMax = maxDistance;
+
+            for (int i = 0; i < 3; i++) {
+                // Ray parallel to slab. No hit if origin is not already within slab
+                if (direction[i] == fp{0}) {
+                    if (origin[i] < min[i] || origin[i] > max[i]) {
+                        return false;
+                    }
+                    continue;
+                }
+
+                fp inverseDir = fp{1} / direction[i];
+                fp tNear = (min[i] - origin[i]) * inverseDir;
+                fp tFar = (max[i] - origin[i]) * inverseDir;
+                if (tNear > tFar) {
+                    FPMath::swap(tNear, tFar);
+                }
+
+                tMin = FPMath::max(tMin, tNear);
+                tMax = FPMath::min(tMax, tFar);
+                if (tMin > tMax) {
+                    return false;
+                }
+            }
+
+            outEntryDistance = tMin;
+            return true;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            min.CalculateCRC32(resultThusFar);
+            max.CalculateCRC32(resultThusFar);
+        }
+    };
+}
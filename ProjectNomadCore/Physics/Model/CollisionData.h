@@ -60,6 +60,21 @@ namespace ProjectNomad {
         ImpactResult(bool isColliding) : isColliding(isColliding) {}
     };
 
+    struct TimeOfImpactResult {
+        bool isHit = false;
+        // Already overlapping at start of sweep, in which case penetration info needs a discrete check instead
+        bool wasInitiallyOverlapping = false;
+        // Fraction of sweep displacement (0 to 1) which can be travelled before reaching contact offset from collider
+        fp timeOfImpact = fp{1};
+        // Contact normal pointing from moving collider towards hit collider. Not set if initially overlapping
+        FVectorFP contactNormal = FVectorFP::Zero();
+        uint32_t iterations = 0;
+
+        static TimeOfImpactResult NoHit() {
+            return {};
+        }
+    };
+
     struct ImpactResultWithHitEntity {
         ImpactResult impactResult;
         entt::entity hitEntity = entt::null;
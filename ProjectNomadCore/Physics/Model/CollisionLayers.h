@@ -0,0 +1,39 @@
+#pragma once
+
+#include <CRCpp/CRC.h>
+
+namespace ProjectNomad {
+    // One bit per layer. Actual layer meanings (eg, player, enemy, camera) are up to the game to define
+    using CollisionLayerBits = uint32_t;
+
+    namespace CollisionLayers {
+        constexpr CollisionLayerBits kNone = 0;
+        constexpr CollisionLayerBits kDefault = 1u << 0;
+        constexpr CollisionLayerBits kAll = 0xFFFFFFFFu;
+    }
+
+    /**
+    * Determines which other colliders a collider interacts with, such as having the camera not collide with characters.
+    * Checked before any narrowphase work so that unwanted pairs cost a couple of bitwise ANDs rather than a full
+    *   SAT or capsule test. Defaults to colliding with everything, same as before layers existed.
+    **/
+    struct CollisionLayerFilter {
+        CollisionLayerBits layers = CollisionLayers::kDefault; // Which layers this collider belongs to
+        CollisionLayerBits mask = CollisionLayers::kAll;       // Which layers this collider interacts with
+
+        // Pairs only interact if both sides agree, so that eg a camera can opt out of characters on its own
+        bool CanCollideWith(const CollisionLayerFilter& other) const {
+            return (mask & other.layers) != 0 && (other.mask & layers) != 0;
+        }
+
+        // Scene queries only care about what the query wants to see, ie a single AND against query's mask
+        bool IsVisibleTo(CollisionLayerBits queryMask) const {
+            return (layers & queryMask) != 0;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&layers, sizeof(layers), CRC::CRC_32(), resultThusFar);
+            resultThusFar = CRC::Calculate(&mask, sizeof(mask), CRC::CRC_32(), resultThusFar);
+        }
+    };
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "AABB.h"
+#include "Math/FixedPoint.h"
+#include "Math/FPMath.h"
+#include "Math/FVectorFP.h"
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Defines a range-limited cone (ie, spherical sector): all points within maxDistance of the origin which are
+    ///     within halfAngle of the direction.
+    /// Intended for "what's roughly in front of me" searches such as grapple point targeting.
+    /// Half angle trig is computed once on construction so that per-collider tests never need trig.
+    /// </summary>
+    class Cone {
+      public:
+        FVectorFP origin;
+        FVectorFP direction;
+        fp halfAngleDegrees = fp{0};
+        fp maxDistance = fp{0};
+
+        fp cosHalfAngle = fp{1};
+        fp sinHalfAngle = fp{0};
+
+        Cone() : direction(FVectorFP::Forward()) {}
+
+        /**
+        * @param origin - apex of cone
+        * @param direction - direction of cone axis. Will be normalized
+        * @param halfAngleDegrees - angle between axis and edge of cone. Expected to be within (0, 90) degrees
+        * @param maxDistance - max distance from apex for any point within the cone
+        **/
+        Cone(const FVectorFP& origin, const FVectorFP& direction, fp halfAngleDegrees, fp maxDistance)
+        : origin(origin), direction(direction.Normalized()),
+          halfAngleDegrees(halfAngleDegrees), maxDistance(maxDistance) {
+            cosHalfAngle = FPMath::cosD(halfAngleDegrees);
+            sinHalfAngle = FPMath::sinD(halfAngleDegrees);
+        }
+
+        bool IsValid() const {
+            return !direction.IsZero() && maxDistance > fp{0}
+                && halfAngleDegrees > fp{0} && halfAngleDegrees < fp{90};
+        }
+
+        /**
+        * Checks if point is within cone.
+        * @param point - point to test
+        * @param outAngleCos - cosine of angle between cone direction and direction towards point. 1 if point is apex
+        * @returns true if point is within cone (including on surface)
+        **/
+        bool ContainsPoint(const FVectorFP& point, fp& outAngleCos) const {
+            FVectorFP toPoint = point - origin;
+            fp distSq = toPoint.GetLengthSquared();
+            if (distSq == fp{0}) {
+                outAngleCos = fp{1};
+                return true;
+            }
+            if (distSq > maxDistance * maxDistance) {
+                return false;
+            }
+
+            // Compare angle against half angle without a sqrt: dot >= |toPoint| * cos, where both sides are positive
+            fp projectedDist = toPoint.Dot(direction);
+            if (projectedDist <= fp{0}) {
+                return false;
+            }
+            if (projectedDist * projectedDist < distSq * cosHalfAngle * cosHalfAngle) {
+                return false;
+            }
+
+            outAngleCos = projectedDist / FPMath::sqrt(distSq);
+            return true;
+        }
+
+        /**
+        * Calculates exact world bounds of the cone, including the spherical cap at max distance
+        **/
+        AABB GetBounds() const {
+            FVectorFP boundsMin = origin;
+            FVectorFP boundsMax = origin;
+
+            // Center and radius of the rim circle where the cone side meets the spherical cap
+            FVectorFP rimCenter = origin + direction * (maxDistance * cosHalfAngle);
+            fp rimRadius = maxDistance * sinHalfAngle;
+
+            for (int i = 0; i < 3; i++) {
+                fp dirComponent = direction[i];
+                // Extent of a circle along world axis i depends on how tilted the circle is relative to that axis
+                fp rimExtent = rimRadius * FPMath::sqrt(FPMath::max(fp{0}, fp{1} - dirComponent * dirComponent));
+
+                // If the world axis itself is within the cone, then the cap bulges out to full max distance
+                fp maxSide = dirComponent >= cosHalfAngle ? origin[i] + maxDistance : rimCenter[i] + rimExtent;
+                fp minSide = -dirComponent >= cosHalfAngle ? origin[i] - maxDistance : rimCenter[i] - rimExtent;
+
+                SetComponent(boundsMax, i, FPMath::max(boundsMax[i], maxSide));
+                SetComponent(boundsMin, i, FPMath::min(boundsMin[i], minSide));
+            }
+
+            return AABB(boundsMin, boundsMax);
+        }
+
+      private:
+        static void SetComponent(FVectorFP& vector, int i, const fp& value) {
+            if (i == 0) {
+                vector.x = value;
+            }
+            else if (i == 1) {
+                vector.y = value;
+            }
+            else {
+                vector.z = value;
+            }
+        }
+    };
+}
@@ -86,6 +86,27 @@ bool FCollider::IsSphere() const {
     return colliderType == ColliderType::Sphere;
 }
 
+bool FCollider::IsSameShapeAndPose(const FCollider& other) const {
+    if (colliderType != other.colliderType || center != other.center || rotation != other.rotation) {
+        return false;
+    }
+
+    // Same as CalculateCRC32, only values in use by the collider type are relevant
+    switch (colliderType) {
+        case ColliderType::Box:
+            return boxHalfSizeX == other.boxHalfSizeX
+                && boxHalfSizeY == other.boxHalfSizeY
+                && boxHalfSizeZ == other.boxHalfSizeZ;
+        case ColliderType::Capsule:
+            return capsuleHalfHeight == other.capsuleHalfHeight && radius == other.radius;
+        case ColliderType::Sphere:
+            return radius == other.radius;
+        case ColliderType::NotInitialized:
+        default:
+            return true;
+    }
+}
+
 void FCollider::SetCenter(const FVectorFP& newCenter) {
     center = newCenter;
 }
@@ -207,6 +228,10 @@ FVectorFP FCollider::ToLocalSpaceForOriginCenteredValue(const FVectorFP& value)
     return rotation.inverted() * value;
 }
 
+FMatrix3FP FCollider::GetRotationMatrix() const {
+    return FMatrix3FP::FromQuat(rotation);
+}
+
 FFixedPoint FCollider::GetHorizontalPlaneBoundsRadius() const {
     switch (colliderType) {
         case ColliderType::Box:
@@ -235,6 +260,41 @@ FFixedPoint FCollider::GetVerticalHalfHeightBounds() const {
     }
 }
 
+ProjectNomad::AABB FCollider::GetWorldBounds() const {
+    switch (colliderType) {
+        case ColliderType::Box: {
+            // Project each rotated box axis onto world axes. ie, extent along world x is the sum of |x component| of
+            //      each rotated half size axis (Real-Time Collision Detection, Section 4.2.6)
+            FMatrix3FP rotationMatrix = GetRotationMatrix();
+            FVectorFP axisX = rotationMatrix.GetColumn(0) * boxHalfSizeX;
+            FVectorFP axisY = rotationMatrix.GetColumn(1) * boxHalfSizeY;
+            FVectorFP axisZ = rotationMatrix.GetColumn(2) * boxHalfSizeZ;
+
+            FVectorFP extents;
+            extents.x = ProjectNomad::FPMath::abs(axisX.x) + ProjectNomad::FPMath::abs(axisY.x)
+                      + ProjectNomad::FPMath::abs(axisZ.x);
+            extents.y = ProjectNomad::FPMath::abs(axisX.y) + ProjectNomad::FPMath::abs(axisY.y)
+                      + ProjectNomad::FPMath::abs(axisZ.y);
+            extents.z = ProjectNomad::FPMath::abs(axisX.z) + ProjectNomad::FPMath::abs(axisY.z)
+                      + ProjectNomad::FPMath::abs(axisZ.z);
+            return ProjectNomad::AABB::FromCenterAndHalfSize(center, extents);
+        }
+        case ColliderType::Capsule: {
+            // Bounds of the medial segment, then pushed out by radius in every direction
+            ProjectNomad::Line medialLine = GetCapsuleMedialLineExtremes();
+            ProjectNomad::AABB medialLineBounds = ProjectNomad::AABB::Merge(
+                ProjectNomad::AABB(medialLine.start, medialLine.start),
+                ProjectNomad::AABB(medialLine.end, medialLine.end)
+            );
+            return medialLineBounds.Expanded(GetCapsuleRadius());
+        }
+        case ColliderType::Sphere:
+            return ProjectNomad::AABB::FromCenterAndHalfSize(center, FVectorFP(GetSphereRadius()));
+        default:
+            return ProjectNomad::AABB(center, center);
+    }
+}
+
 void FCollider::ApplyMultiplier(FFixedPoint multiplier) {
     switch (colliderType) {
         case ColliderType::Box:
@@ -336,34 +396,40 @@ std::string FCollider::GetTypeAsString() const {
     }
 }
 
-std::vector<FVectorFP> FCollider::GetBoxVerticesInWorldCoordinates() const {
-    std::vector<FVectorFP> result;
+ProjectNomad::BoxVertices FCollider::GetBoxVerticesInWorldCoordinates() const {
     FVectorFP halfSize = GetBoxHalfSize();
 
-    // First, the bottom back left and top front right points
+    // First, the bottom back left and top front right points, then all the other combinations one by one
     //  ...yeah I do regret these location names. IDEA: Put names somewhere central, like in CollisionHelpers.h
-    result.push_back(center + rotation * -halfSize);
-    result.push_back(center + rotation * halfSize);
-
-    // Then calculate all the other combinations one by one
-    result.push_back(center + rotation * FVectorFP(-halfSize.x, halfSize.y, -halfSize.z)); // bottom back right
-    result.push_back(center + rotation * FVectorFP(halfSize.x, -halfSize.y, -halfSize.z)); // bottom front left
-    result.push_back(center + rotation * FVectorFP(halfSize.x, halfSize.y, -halfSize.z)); // bottom front right
-    result.push_back(center + rotation * FVectorFP(-halfSize.x, -halfSize.y, halfSize.z)); // top back left
-    result.push_back(center + rotation * FVectorFP(-halfSize.x, halfSize.y, halfSize.z)); // top back right
-    result.push_back(center + rotation * FVectorFP(halfSize.x, -halfSize.y, halfSize.z)); // top front left
+    FVectorFP vertices[8] = {
+        -halfSize,
+        halfSize,
+        FVectorFP(-halfSize.x, halfSize.y, -halfSize.z), // bottom back right
+        FVectorFP(halfSize.x, -halfSize.y, -halfSize.z), // bottom front left
+        FVectorFP(halfSize.x, halfSize.y, -halfSize.z), // bottom front right
+        FVectorFP(-halfSize.x, -halfSize.y, halfSize.z), // top back left
+        FVectorFP(-halfSize.x, halfSize.y, halfSize.z), // top back right
+        FVectorFP(halfSize.x, -halfSize.y, halfSize.z) // top front left
+    };
+    // Rotation is converted to a matrix once rather than applying the quaternion to all 8 vertices
+    GetRotationMatrix().TransformPoints(vertices, vertices, center);
 
+    ProjectNomad::BoxVertices result;
+    for (const FVectorFP& vertex : vertices) {
+        result.Add(vertex);
+    }
     return result;
 }
 
-std::vector<FVectorFP> FCollider::GetBoxNormalsInWorldCoordinates() const {
-    std::vector<FVectorFP> results;
+ProjectNomad::BoxNormals FCollider::GetBoxNormalsInWorldCoordinates() const {
+    ProjectNomad::BoxNormals results;
 
-    // Use x/y/z axes and rotate as necessary to get world coordinate axes
+    // Rotated x/y/z axes are simply the columns of the rotation matrix
     // In addition, no need currently for parallel normals (eg, -x and +x)
-    results.push_back(ToWorldSpaceForOriginCenteredValue(FVectorFP::Forward()));
-    results.push_back(ToWorldSpaceForOriginCenteredValue(FVectorFP::Right()));
-    results.push_back(ToWorldSpaceForOriginCenteredValue(FVectorFP::Up()));
+    FMatrix3FP rotationMatrix = GetRotationMatrix();
+    results.Add(rotationMatrix.GetColumn(0));
+    results.Add(rotationMatrix.GetColumn(1));
+    results.Add(rotationMatrix.GetColumn(2));
 
     return results;
 }
@@ -415,7 +481,7 @@ bool FCollider::IsLocalSpacePtWithinBoxExcludingOnSurface(const FVectorFP& local
     return true;
 }
 
-void FCollider::GetFacesThatLocalSpacePointTouches(const FVectorFP& localPoint, std::vector<FVectorFP>& resultFaces) const {
+void FCollider::GetFacesThatLocalSpacePointTouches(const FVectorFP& localPoint, ProjectNomad::BoxFaces& resultFaces) const {
     FVectorFP maxExtents = GetBoxHalfSize();
     FVectorFP minExtents = -maxExtents;
 
@@ -429,24 +495,24 @@ void FCollider::GetFacesThatLocalSpacePointTouches(const FVectorFP& localPoint,
     //      what the "optimal" solutions was after all that work, which seems to be a very common pattern...
         
     if (ProjectNomad::FPMath::isNear(localPoint.x, maxExtents.x, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Forward());
+        resultFaces.Add(FVectorFP::Forward());
     }
     else if (ProjectNomad::FPMath::isNear(localPoint.x, minExtents.x, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Backward());
+        resultFaces.Add(FVectorFP::Backward());
     }
 
     if (ProjectNomad::FPMath::isNear(localPoint.y, maxExtents.y, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Right());
+        resultFaces.Add(FVectorFP::Right());
     }
     else if (ProjectNomad::FPMath::isNear(localPoint.y, minExtents.y, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Left());
+        resultFaces.Add(FVectorFP::Left());
     }
 
     if (ProjectNomad::FPMath::isNear(localPoint.z, maxExtents.z, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Up());
+        resultFaces.Add(FVectorFP::Up());
     }
     else if (ProjectNomad::FPMath::isNear(localPoint.z, minExtents.z, FFixedPoint{0.001f})) {
-        resultFaces.push_back(FVectorFP::Down());
+        resultFaces.Add(FVectorFP::Down());
     }
 }
 
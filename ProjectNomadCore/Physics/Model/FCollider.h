@@ -1,8 +1,11 @@
 #pragma once
 
+#include "AABB.h"
 #include "ColliderType.h"
+#include "Math/FMatrix3FP.h"
 #include "Math/FQuatFP.h"
 #include "Line.h"
+#include "Utilities/Containers/FlexArray.h"
 
 #if WITH_ENGINE
 #include "CoreMinimal.h"
@@ -11,6 +14,13 @@
 #include "Utilities/PlatformSupport/UnrealReplacements.h"
 #endif
 
+namespace ProjectNomad {
+    // Fixed capacity results for box queries, so that narrowphase checks don't need any heap allocations
+    using BoxVertices = FlexArray<FVectorFP, 8>;
+    using BoxNormals = FlexArray<FVectorFP, 3>;
+    using BoxFaces = FlexArray<FVectorFP, 3>; // At most one face per axis
+}
+
 // Composite type for all supported colliders
 // Directly inspired by Unreal's FCollisionShape. Yay for stumbling on a great way to do this without pointers!
 // Perhaps should just make this a class to make it explicit to go through getters/setters?
@@ -66,6 +76,8 @@ struct THENOMADGAME_API FCollider {
     bool IsBox() const;
     bool IsCapsule() const;
     bool IsSphere() const;
+    // Exact comparison of type, pose and the shape values in use. Unlike world bounds, mirrored rotations differ
+    bool IsSameShapeAndPose(const FCollider& other) const;
 
     void SetCenter(const FVectorFP& newCenter);
     FVectorFP GetCenter() const;
@@ -102,9 +114,14 @@ struct THENOMADGAME_API FCollider {
     // TODO: Refactor these methods into public toLocalSpaceFromWorldPosition and toLocalSpaceFromWorldDirection
     FVectorFP ToLocalSpaceForOriginCenteredValue(const FVectorFP& value) const;
 
+    // Local to world rotation as a matrix. Transpose for world to local. Cheaper than quaternion when rotating many values
+    FMatrix3FP GetRotationMatrix() const;
+
     // Return more or less rough estimate of bounds on horizontal plane
     FFixedPoint GetHorizontalPlaneBoundsRadius() const;
     FFixedPoint GetVerticalHalfHeightBounds() const;
+    // Return exact world axis-aligned bounds of collider. Intended for broadphase usage
+    ProjectNomad::AABB GetWorldBounds() const;
 
     void ApplyMultiplier(FFixedPoint multiplier);
 
@@ -119,9 +136,8 @@ struct THENOMADGAME_API FCollider {
 
 #pragma region Box Specific Functionality
 
-    std::vector<FVectorFP> GetBoxVerticesInWorldCoordinates() const;
-    // TODO: Not vastly important due to small fixed size, but preferably don't copy results. Instead pass in a vector to fill with data
-    std::vector<FVectorFP> GetBoxNormalsInWorldCoordinates() const;
+    ProjectNomad::BoxVertices GetBoxVerticesInWorldCoordinates() const;
+    ProjectNomad::BoxNormals GetBoxNormalsInWorldCoordinates() const;
 
     bool IsWorldSpacePtWithinBoxIncludingOnSurface(const FVectorFP& point) const;
     bool IsLocalSpacePtWithinBoxIncludingOnSurface(const FVectorFP& localPoint) const;
@@ -140,8 +156,8 @@ struct THENOMADGAME_API FCollider {
     /// Point to check against. This is assumed to already be known to NOT be outside box.
     /// (ie, the point is either on surface of box or within box)
     /// </param>
-    /// <param name="resultFaces">Results ("faces" that point touches) are added to this vector</param>
-    void GetFacesThatLocalSpacePointTouches(const FVectorFP& localPoint, std::vector<FVectorFP>& resultFaces) const;
+    /// <param name="resultFaces">Results ("faces" that point touches) are added to this array</param>
+    void GetFacesThatLocalSpacePointTouches(const FVectorFP& localPoint, ProjectNomad::BoxFaces& resultFaces) const;
 
 #pragma endregion
 #pragma region Capsule Specific Functionality
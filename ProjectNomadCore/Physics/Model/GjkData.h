@@ -0,0 +1,156 @@
+#pragma once
+
+#include <CRCpp/CRC.h>
+#include <EnTT/entt.hpp>
+
+#include "Simplex.h"
+#include "Math/FVectorFP.h"
+#include "Utilities/FrameType.h"
+#include "Utilities/Containers/FlexArray.h"
+
+// Max pairs each NarrowphaseCache remembers. Every entry is part of every rollback snapshot of every dynamic entity,
+// so only raise this if bodies routinely touch more pairs per frame than this (extra pairs merely start cold)
+#ifndef NOMAD_NARROWPHASE_CACHE_ENTRIES
+#define NOMAD_NARROWPHASE_CACHE_ENTRIES 4
+#endif
+
+namespace ProjectNomad {
+    /**
+    * Last frame's GJK result for a single pair of colliders, used to seed this frame's simplex.
+    * Only search directions are kept (not points) as both colliders will typically have moved since. Re-evaluating the
+    *   same directions against the moved colliders gives a simplex which is usually already at or next to the answer.
+    **/
+    struct GjkWarmStart {
+        FVectorFP directions[Simplex::kMaxVertices];
+        uint32_t directionCount = 0;
+
+        bool IsEmpty() const {
+            return directionCount == 0;
+        }
+
+        void Clear() {
+            directionCount = 0;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&directionCount, sizeof(directionCount), CRC::CRC_32(), resultThusFar);
+            for (uint32_t i = 0; i < directionCount; i++) {
+                directions[i].CalculateCRC32(resultThusFar);
+            }
+        }
+    };
+
+    /**
+    * Last fully calculated contact axis for a single pair of colliders.
+    * Projecting both colliders onto a single axis is far cheaper than a full narrowphase check, and gives the exact
+    *   overlap along that axis. Thus a cached axis can either prove separation outright (no overlap) or stand in for
+    *   the full result as long as colliders haven't moved sideways enough for a different axis to become shallower.
+    **/
+    struct CachedContact {
+        // Small members first, so they share a single 8 byte slot rather than each being padded out
+        bool isValid = false;
+        // True if axis is the penetration axis of a collision. Otherwise axis is a separating axis
+        bool wasColliding = false;
+        FrameType calculatedFrame = 0;
+        // Points from collider "A" towards collider "B", same as ImpactResult::penetrationDirection
+        FVectorFP axis = FVectorFP::Zero();
+        // Penetration depth along axis when fully calculated. Only relevant if colliding
+        fp depth = fp{0};
+        // Center of B minus center of A when fully calculated, for measuring relative movement since then
+        FVectorFP referenceOffset = FVectorFP::Zero();
+
+        void Clear() {
+            isValid = false;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&isValid, sizeof(isValid), CRC::CRC_32(), resultThusFar);
+            if (!isValid) {
+                return;
+            }
+            
+            resultThusFar = CRC::Calculate(&wasColliding, sizeof(wasColliding), CRC::CRC_32(), resultThusFar);
+            axis.CalculateCRC32(resultThusFar);
+            depth.CalculateCRC32(resultThusFar);
+            referenceOffset.CalculateCRC32(resultThusFar);
+            resultThusFar = CRC::Calculate(&calculatedFrame, sizeof(calculatedFrame), CRC::CRC_32(), resultThusFar);
+        }
+    };
+
+    struct NarrowphaseCacheEntry {
+        entt::entity otherEntity = entt::null;
+        FrameType lastUsedFrame = 0;
+        GjkWarmStart gjkWarmStart;
+        CachedContact contact;
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&otherEntity, sizeof(otherEntity), CRC::CRC_32(), resultThusFar);
+            resultThusFar = CRC::Calculate(&lastUsedFrame, sizeof(lastUsedFrame), CRC::CRC_32(), resultThusFar);
+            gjkWarmStart.CalculateCRC32(resultThusFar);
+            contact.CalculateCRC32(resultThusFar);
+        }
+    };
+
+    /// <summary>
+    /// Per-entity cache of narrowphase results against other entities, for temporal coherence between frames.
+    /// Lives in a component (see NarrowphaseCacheComponent) so that it's automatically part of rollback snapshots,
+    ///     as warm started results can differ from cold results in the last few fixed point bits.
+    /// Entries not used on the prior frame are cleared on lookup anyway, so capacity only needs to cover the pairs a
+    ///     single body touches within one frame (typically ground plus a wall or neighbour or two).
+    /// </summary>
+    class NarrowphaseCache {
+      public:
+        static constexpr uint32_t kMaxEntries = NOMAD_NARROWPHASE_CACHE_ENTRIES;
+
+        /**
+        * Retrieves cached data for pair with other entity, or creates an empty entry if none exists.
+        * When full, the least recently used entry is replaced (ties broken by lowest entity id for determinism).
+        * @param otherEntity - entity on other side of pair
+        * @param currentFrame - current sim frame. Entries not used on the prior frame are too stale to warm start from
+        **/
+        NarrowphaseCacheEntry& FindOrAdd(entt::entity otherEntity, FrameType currentFrame) {
+            for (uint32_t i = 0; i < mEntries.GetSize(); i++) {
+                NarrowphaseCacheEntry& entry = mEntries.Get(i);
+                if (entry.otherEntity == otherEntity) {
+                    if (currentFrame - entry.lastUsedFrame > 1) {
+                        entry.gjkWarmStart.Clear();
+                        entry.contact.Clear();
+                    }
+                    entry.lastUsedFrame = currentFrame;
+                    return entry;
+                }
+            }
+
+            NarrowphaseCacheEntry newEntry;
+            newEntry.otherEntity = otherEntity;
+            newEntry.lastUsedFrame = currentFrame;
+            if (mEntries.Add(newEntry)) {
+                return mEntries.Get(mEntries.GetSize() - 1);
+            }
+
+            uint32_t replaceIndex = 0;
+            for (uint32_t i = 1; i < mEntries.GetSize(); i++) {
+                const NarrowphaseCacheEntry& candidate = mEntries.Get(i);
+                const NarrowphaseCacheEntry& currentWorst = mEntries.Get(replaceIndex);
+                if (candidate.lastUsedFrame < currentWorst.lastUsedFrame
+                    || (candidate.lastUsedFrame == currentWorst.lastUsedFrame
+                        && candidate.otherEntity < currentWorst.otherEntity)) {
+                    replaceIndex = i;
+                }
+            }
+            mEntries.Get(replaceIndex) = newEntry;
+            return mEntries.Get(replaceIndex);
+        }
+
+        uint32_t GetSize() const {
+            return mEntries.GetSize();
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            mEntries.CalculateCRC32(resultThusFar);
+        }
+
+      private:
+        FlexArray<NarrowphaseCacheEntry, kMaxEntries> mEntries;
+    };
+}
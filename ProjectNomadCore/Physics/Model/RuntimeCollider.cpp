@@ -0,0 +1,74 @@
+#include "RuntimeCollider.h"
+
+#include "FCollider.h"
+
+namespace ProjectNomad {
+    RuntimeCollider::RuntimeCollider(const FCollider& collider) {
+        SyncFrom(collider);
+    }
+
+    void RuntimeCollider::SyncFrom(const FCollider& collider) {
+        colliderType = collider.colliderType;
+        center = collider.center;
+
+        // Rotated local axes are the columns of the rotation matrix, and thus the rows of its transpose (inverse)
+        localToWorld = collider.GetRotationMatrix();
+        worldToLocal = localToWorld.Transposed();
+
+        boxHalfSize = FVectorFP::Zero();
+        coreRadius = fp{0};
+        switch (colliderType) {
+            case ColliderType::Box:
+                boxHalfSize = collider.GetBoxHalfSize();
+                capsuleMedialSegment = Line(center, center);
+                break;
+            case ColliderType::Capsule:
+                coreRadius = collider.GetCapsuleRadius();
+                capsuleMedialSegment = collider.GetCapsuleMedialLineExtremes();
+                break;
+            case ColliderType::Sphere:
+                coreRadius = collider.GetSphereRadius();
+                capsuleMedialSegment = Line(center, center);
+                break;
+            case ColliderType::NotInitialized:
+            default:
+                capsuleMedialSegment = Line(center, center);
+                break;
+        }
+
+        // Same calculation as source collider so that broadphase results don't depend on which form is used
+        worldBounds = collider.GetWorldBounds();
+    }
+
+    void RuntimeCollider::SetCenter(const FVectorFP& newCenter) {
+        FVectorFP offset = newCenter - center;
+        center = newCenter;
+        capsuleMedialSegment = Line(capsuleMedialSegment.start + offset, capsuleMedialSegment.end + offset);
+        worldBounds = AABB(worldBounds.min + offset, worldBounds.max + offset);
+    }
+
+    FVectorFP RuntimeCollider::GetCoreFurthestPoint(const FVectorFP& direction) const {
+        switch (colliderType) {
+            case ColliderType::Box: {
+                // Sign of direction along each local axis picks the furthest vertex. Ties pick the positive side
+                FVectorFP result = center;
+                for (uint8_t axis = 0; axis < 3; axis++) {
+                    fp halfSize = worldToLocal.rows[axis].Dot(direction) >= fp{0} ? boxHalfSize[axis] : -boxHalfSize[axis];
+                    result += worldToLocal.rows[axis] * halfSize;
+                }
+                return result;
+            }
+
+            case ColliderType::Capsule: {
+                // Medial line endpoint which is furthest along direction. Ties pick the first endpoint
+                const Line& segment = capsuleMedialSegment;
+                return (segment.end - segment.start).Dot(direction) > fp{0} ? segment.end : segment.start;
+            }
+
+            case ColliderType::Sphere:
+            case ColliderType::NotInitialized:
+            default:
+                return center;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "AABB.h"
+#include "ColliderType.h"
+#include "Line.h"
+#include "Math/FixedPoint.h"
+#include "Math/FMatrix3FP.h"
+#include "Math/FVectorFP.h"
+
+struct FCollider;
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Derived, read-only form of an FCollider for narrowphase hot paths.
+    ///
+    /// FCollider is the authoring/snapshot format and recalculates everything from its quaternion on every call
+    ///     (eg, ToLocalSpaceFromWorld inverts then applies the quaternion each time). This instead precalculates once:
+    /// - Rotation as a 3x3 matrix plus its transpose, so local <-> world is just three dot products
+    /// - Capsule medial segment
+    /// - World bounds
+    /// Hottest data (type, core radius, center, world-to-local matrix, box half size) is laid out first so that support
+    ///     point queries on boxes only touch the first two cache lines. Note that fixed point values are 64 bit, so the
+    ///     whole struct can't fit within a single cache line.
+    ///
+    /// Not stored in components: Derived data should never be part of snapshots. Create (or SyncFrom) whenever the
+    ///     source collider may have changed, then pass around by reference.
+    /// </summary>
+    struct alignas(64) RuntimeCollider {
+        ColliderType colliderType = ColliderType::NotInitialized;
+        // Radius swept around the core shape (see ColliderHelpers::GetCoreFurthestPoint). 0 for boxes
+        fp coreRadius = fp{0};
+        FVectorFP center;
+        // Rows are the collider's local x/y/z axes in world space
+        FMatrix3FP worldToLocal;
+        FVectorFP boxHalfSize;
+
+        // Transpose of worldToLocal
+        FMatrix3FP localToWorld;
+        Line capsuleMedialSegment;
+        AABB worldBounds;
+
+        RuntimeCollider() = default;
+        explicit RuntimeCollider(const FCollider& collider);
+
+        void SyncFrom(const FCollider& collider);
+        // Only moves precalculated data along, as rotation is unaffected by translation
+        void SetCenter(const FVectorFP& newCenter);
+
+        bool IsNotInitialized() const {
+            return colliderType == ColliderType::NotInitialized;
+        }
+
+        FVectorFP ToLocalSpaceForOriginCenteredValue(const FVectorFP& value) const {
+            return worldToLocal * value;
+        }
+        FVectorFP ToLocalSpaceFromWorld(const FVectorFP& value) const {
+            return ToLocalSpaceForOriginCenteredValue(value - center);
+        }
+        FVectorFP ToWorldSpaceForOriginCenteredValue(const FVectorFP& value) const {
+            return localToWorld * value;
+        }
+        FVectorFP ToWorldSpaceFromLocal(const FVectorFP& value) const {
+            return ToWorldSpaceForOriginCenteredValue(value) + center;
+        }
+
+        // Same as ColliderHelpers::GetCoreFurthestPoint, without any quaternion math
+        FVectorFP GetCoreFurthestPoint(const FVectorFP& direction) const;
+    };
+}
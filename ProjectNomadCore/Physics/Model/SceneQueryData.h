@@ -0,0 +1,81 @@
+#pragma once
+
+#include <EnTT/entt.hpp>
+
+#include "CollisionData.h"
+#include "CollisionLayers.h"
+#include "Math/FixedPoint.h"
+#include "Math/FVectorFP.h"
+#include "Utilities/Containers/FlexArray.h"
+
+namespace ProjectNomad {
+    enum class SceneQueryMode : uint8_t {
+        ClosestHit, // Only the best hit is returned (ie, nearest unless sorting by angle). Ties broken by entity id
+        AnyHit,     // Stops at first confirmed hit. Cheapest option when only "is anything there?" matters
+        AllHits     // Every hit is returned, sorted best first then by entity id
+    };
+
+    enum class SceneQuerySortMode : uint8_t {
+        ByDistance, // Nearest first
+        ByAngle     // Smallest angle from query direction first. Only meaningful for conecasts
+    };
+
+    /**
+    * Describes which colliders a scene query should consider
+    **/
+    struct SceneQueryFilter {
+        bool includeStatic = true;
+        bool includeDynamic = true;
+        // Typically the querying entity itself (eg, don't want a character's line of sight check to hit themselves)
+        entt::entity ignoredEntity = entt::null;
+        // Only colliders on at least one of these layers are considered
+        CollisionLayerBits layerMask = CollisionLayers::kAll;
+
+        bool ShouldIgnore(entt::entity entity, bool isDynamic, const CollisionLayerFilter& layerFilter) const {
+            if (!layerFilter.IsVisibleTo(layerMask)) { // Checked first as cheapest and likely most common rejection
+                return true;
+            }
+            if (entity == ignoredEntity) {
+                return true;
+            }
+            return isDynamic ? !includeDynamic : !includeStatic;
+        }
+    };
+
+    struct SceneQueryHit {
+        entt::entity hitEntity = entt::null;
+        bool didHitDynamicEntity = false;
+        // Distance along ray or line for casts, from origin for conecasts, and between centers for overlap queries
+        fp distance = fp{0};
+        // Point of first intersection for ray/line casts. Collider center for all other queries
+        FVectorFP point = FVectorFP::Zero();
+        // Cosine of angle between query direction and hit. Only set by conecasts, where 1 means dead center
+        fp angleCos = fp{1};
+
+        CollisionResultWithHitEntity ToCollisionResult() const {
+            return CollisionResultWithHitEntity::WithCollision(hitEntity, didHitDynamicEntity);
+        }
+
+        // Deterministic ordering used for sorting results, as multiple hits may have the exact same distance
+        bool IsBefore(const SceneQueryHit& other) const {
+            if (distance != other.distance) {
+                return distance < other.distance;
+            }
+            return hitEntity < other.hitEntity;
+        }
+
+        bool IsBeforeByAngle(const SceneQueryHit& other) const {
+            if (angleCos != other.angleCos) {
+                return angleCos > other.angleCos;
+            }
+            return IsBefore(other);
+        }
+
+        bool IsBefore(const SceneQueryHit& other, SceneQuerySortMode sortMode) const {
+            return sortMode == SceneQuerySortMode::ByAngle ? IsBeforeByAngle(other) : IsBefore(other);
+        }
+    };
+
+    constexpr uint32_t kMaxSceneQueryHits = 64;
+    using SceneQueryHits = FlexArray<SceneQueryHit, kMaxSceneQueryHits>;
+}
@@ -3,46 +3,76 @@
 #include "Math/FVectorFP.h"
 
 namespace ProjectNomad {
-    // Simplex for GJK + EPA algorithm usage. Based on https://youtu.be/MDusDn8oTSE?t=277 
-    class Simplex {
-        static constexpr size_t MAX_POINTS = 4; // 4 supports a tetrahedron, which is the most complex simplex we'll need for 3D
-        
-        // Could use a vector, but logic is pretty simple so can easily use in-place array for quicker access
-        std::array<FVectorFP, MAX_POINTS> points;
-        size_t pointsSize = 0;
+    /**
+    * Single point of a GJK simplex, ie a point on the Minkowski difference (A - B) of two shapes.
+    * The search direction which produced the point is kept as well, so that the simplex can be rebuilt next frame
+    *   from the same directions (warm starting) even though both shapes will have moved by then.
+    **/
+    struct SimplexVertex {
+        FVectorFP point = FVectorFP::Zero();
+        FVectorFP direction = FVectorFP::Zero();
+    };
 
-    public:
-        Simplex() {}
+    // Simplex for GJK + EPA algorithm usage. Based on https://youtu.be/MDusDn8oTSE?t=277
+    class Simplex {
+      public:
+        static constexpr uint32_t kMaxVertices = 4; // 4 supports a tetrahedron, which is the most complex simplex we'll need for 3D
 
-        // Assignment operator from arbitrary list for easy Simplex creation from specific points
-        Simplex& operator=(std::initializer_list<FVectorFP> list) {
-            // TODO: Why this copy style...? Why std::distance?
-            for (auto v = list.begin(); v != list.end(); v++) {
-                points[std::distance(list.begin(), v)] = *v;
-            }
-            pointsSize = list.size();
+        uint32_t GetSize() const {
+            return mSize;
+        }
 
-            return *this;
+        bool IsFull() const {
+            return mSize == kMaxVertices;
         }
 
-        // Note that order of points matters in GJK algorithm (or at least with the relevant implementation used)
-        void pushFront(FVectorFP point) {
-            points = { point, points[0], points[1], points[2] };
-            pointsSize = std::min(pointsSize + 1, MAX_POINTS);
+        const SimplexVertex& Get(uint32_t index) const {
+            return mVertices[index];
         }
 
-        FVectorFP& operator[](uint32_t i) {
-            return points[i];
+        const FVectorFP& GetPoint(uint32_t index) const {
+            return mVertices[index].point;
         }
-        size_t size() const {
-            return pointsSize;
+
+        // Returns false if full or point is already part of simplex (which would only produce a degenerate simplex)
+        bool Add(const SimplexVertex& vertex) {
+            if (IsFull()) {
+                return false;
+            }
+            for (uint32_t i = 0; i < mSize; i++) {
+                if (mVertices[i].point == vertex.point) {
+                    return false;
+                }
+            }
+
+            mVertices[mSize] = vertex;
+            mSize++;
+            return true;
         }
 
-        auto begin() const {
-            return points.begin();
+        /**
+        * Removes all vertices that aren't needed to express the closest point to the origin.
+        * Order of remaining vertices is retained, which keeps GJK fully deterministic.
+        * @param isVertexUsed - one flag per current vertex. False means vertex will be removed
+        **/
+        void Reduce(const bool (&isVertexUsed)[kMaxVertices]) {
+            uint32_t newSize = 0;
+            for (uint32_t i = 0; i < mSize; i++) {
+                if (isVertexUsed[i]) {
+                    mVertices[newSize] = mVertices[i];
+                    newSize++;
+                }
+            }
+            mSize = newSize;
         }
-        auto end() const {
-            return points.end() - (MAX_POINTS - pointsSize);
+
+        void Clear() {
+            mSize = 0;
         }
+
+      private:
+        // Could use a vector, but logic is pretty simple so can easily use in-place array for quicker access
+        SimplexVertex mVertices[kMaxVertices];
+        uint32_t mSize = 0;
     };
 }
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <CRCpp/CRC.h>
+#include <EnTT/entt.hpp>
+
+#include "FCollider.h"
+#include "Utilities/Containers/FlexArray.h"
+
+namespace ProjectNomad {
+    enum class TriggerEventType : uint8_t {
+        Enter, // First frame that other entity overlaps trigger
+        Stay,  // Every following frame that other entity still overlaps trigger
+        Exit   // First frame that other entity no longer overlaps trigger (including if either entity was destroyed)
+    };
+
+    struct TriggerEvent {
+        TriggerEventType type = TriggerEventType::Enter;
+        entt::entity triggerEntity = entt::null;
+        entt::entity otherEntity = entt::null;
+    };
+
+    /**
+    * Single trigger vs dynamic collider pair whose bounds overlapped as of the last trigger update.
+    * Pairs which only overlap in the broadphase are kept as well, so that their (negative) narrowphase result can
+    *   also be reused until either side moves or rotates.
+    **/
+    struct TriggerOverlapPair {
+        entt::entity triggerEntity = entt::null;
+        entt::entity otherEntity = entt::null;
+        // Both colliders as of the last narrowphase test, which is only valid while both are exactly the same.
+        //      Bounds alone aren't enough, as eg boxes with mirrored rotations have identical bounds
+        FCollider triggerCollider;
+        FCollider otherCollider;
+        bool isOverlapping = false;
+
+        // Total order used to keep pair cache sorted, and thus both lookups and event order deterministic
+        bool IsBefore(const TriggerOverlapPair& other) const {
+            if (triggerEntity != other.triggerEntity) {
+                return triggerEntity < other.triggerEntity;
+            }
+            return otherEntity < other.otherEntity;
+        }
+
+        bool IsSamePair(const TriggerOverlapPair& other) const {
+            return triggerEntity == other.triggerEntity && otherEntity == other.otherEntity;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            resultThusFar = CRC::Calculate(&triggerEntity, sizeof(triggerEntity), CRC::CRC_32(), resultThusFar);
+            resultThusFar = CRC::Calculate(&otherEntity, sizeof(otherEntity), CRC::CRC_32(), resultThusFar);
+            triggerCollider.CalculateCRC32(resultThusFar);
+            otherCollider.CalculateCRC32(resultThusFar);
+            resultThusFar = CRC::Calculate(&isOverlapping, sizeof(isOverlapping), CRC::CRC_32(), resultThusFar);
+        }
+    };
+
+    constexpr uint32_t kMaxTriggerPairs = 256;
+    constexpr uint32_t kMaxTriggerEventsPerFrame = 256;
+    using TriggerEvents = FlexArray<TriggerEvent, kMaxTriggerEventsPerFrame>;
+
+    /// <summary>
+    /// Persistent overlap state of all trigger pairs, kept sorted by (trigger, other) entity ids.
+    /// This IS gameplay state (enter/exit events depend on it), so it must be included in rollback snapshots.
+    ///     No pointers are contained, so simply copying this struct is a full snapshot.
+    /// </summary>
+    struct TriggerPairCache {
+        FlexArray<TriggerOverlapPair, kMaxTriggerPairs> pairs;
+
+        // Binary search as pairs are always sorted. Returns nullptr if pair is not cached
+        const TriggerOverlapPair* Find(entt::entity triggerEntity, entt::entity otherEntity) const {
+            TriggerOverlapPair searchKey;
+            searchKey.triggerEntity = triggerEntity;
+            searchKey.otherEntity = otherEntity;
+
+            uint32_t low = 0;
+            uint32_t high = pairs.GetSize();
+            while (low < high) {
+                uint32_t mid = low + (high - low) / 2;
+                const TriggerOverlapPair& midPair = pairs.Get(mid);
+                if (midPair.IsBefore(searchKey)) {
+                    low = mid + 1;
+                }
+                else if (searchKey.IsBefore(midPair)) {
+                    high = mid;
+                }
+                else {
+                    return &midPair;
+                }
+            }
+
+            return nullptr;
+        }
+
+        bool IsOverlapping(entt::entity triggerEntity, entt::entity otherEntity) const {
+            const TriggerOverlapPair* pair = Find(triggerEntity, otherEntity);
+            return pair != nullptr && pair->isOverlapping;
+        }
+
+        void CalculateCRC32(uint32_t& resultThusFar) const {
+            pairs.CalculateCRC32(resultThusFar);
+        }
+    };
+}
@@ -0,0 +1,212 @@
+#include "NarrowphaseMemo.h"
+
+#include "ComplexCollisions.h"
+#include "Context/CoreContext.h"
+
+namespace ProjectNomad {
+    namespace {
+        /// <summary>
+        /// Cheap multiply and xorshift mix over raw integer state. Hash only needs to spread queries over memo sets, as
+        ///     every match is confirmed via exact comparison anyway, so a CRC over every byte is needlessly slow.
+        /// </summary>
+        class MemoHasher {
+          public:
+            void Add(uint64_t value) {
+                mHash = (mHash ^ value) * kMultiplier;
+                mHash ^= mHash >> 32;
+            }
+
+            void Add(fp value) {
+                Add(static_cast<uint64_t>(value.raw_value()));
+            }
+
+            void Add(const FVectorFP& value) {
+                Add(value.x);
+                Add(value.y);
+                Add(value.z);
+            }
+
+            // Final avalanche, so that low bits (used to pick the set) depend on every input bit
+            uint32_t Finish() const {
+                uint64_t result = mHash;
+                result ^= result >> 33;
+                result *= kFinalMultiplier;
+                result ^= result >> 33;
+                return static_cast<uint32_t>(result);
+            }
+
+          private:
+            // 2^64 / golden ratio and MurmurHash3's 64 bit finalizer constant
+            static constexpr uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+            static constexpr uint64_t kFinalMultiplier = 0xFF51AFD7ED558CCDull;
+
+            uint64_t mHash = 0;
+        };
+
+        // Same state as FCollider::IsSameShapeAndPose compares, so that equal colliders always hash the same
+        void AddCollider(MemoHasher& hasher, const FCollider& collider) {
+            hasher.Add(static_cast<uint64_t>(collider.colliderType));
+            hasher.Add(collider.center);
+            hasher.Add(collider.rotation.w);
+            hasher.Add(collider.rotation.v);
+
+            switch (collider.colliderType) {
+                case ColliderType::Box:
+                    hasher.Add(collider.boxHalfSizeX);
+                    hasher.Add(collider.boxHalfSizeY);
+                    hasher.Add(collider.boxHalfSizeZ);
+                    break;
+                case ColliderType::Capsule:
+                    hasher.Add(collider.capsuleHalfHeight);
+                    hasher.Add(collider.radius);
+                    break;
+                case ColliderType::Sphere:
+                    hasher.Add(collider.radius);
+                    break;
+                case ColliderType::NotInitialized:
+                default:
+                    break;
+            }
+        }
+    }
+
+    void NarrowphaseMemo::Enable(uint32_t slotCount) {
+        // Two slots per set and power of two set count, so set index is a simple mask of the hash
+        uint32_t roundedSlotCount = 2;
+        while (roundedSlotCount < slotCount) {
+            roundedSlotCount *= 2;
+        }
+
+        mSlots.clear();
+        mSlots.resize(roundedSlotCount);
+        mHitCount = 0;
+        mMissCount = 0;
+    }
+
+    void NarrowphaseMemo::Disable() {
+        mSlots.clear();
+        mSlots.shrink_to_fit();
+    }
+
+    void NarrowphaseMemo::Clear() {
+        for (MemoSlot& slot : mSlots) {
+            slot.isUsed = false;
+        }
+    }
+
+    ImpactResult NarrowphaseMemo::IsColliding(CoreContext& coreContext,
+                                              const FCollider& A,
+                                              const FCollider& B,
+                                              NarrowphaseCacheEntry& inOutCacheEntry) {
+        if (!IsEnabled()) {
+            return ComplexCollisions::IsColliding(coreContext, A, B, inOutCacheEntry);
+        }
+
+        uint32_t hash = CalculateHash(A, B, inOutCacheEntry);
+        uint32_t setCount = static_cast<uint32_t>(mSlots.size()) / 2;
+        uint32_t firstSlotIndex = (hash & (setCount - 1)) * 2;
+
+        for (uint32_t i = firstSlotIndex; i < firstSlotIndex + 2; i++) {
+            const MemoSlot& slot = mSlots[i];
+            if (IsMatch(slot, hash, A, B, inOutCacheEntry)) {
+                mHitCount++;
+                inOutCacheEntry = slot.cacheEntryAfter;
+                return slot.result;
+            }
+        }
+
+        mMissCount++;
+        NarrowphaseCacheEntry cacheEntryBefore = inOutCacheEntry;
+        ImpactResult result = ComplexCollisions::IsColliding(coreContext, A, B, inOutCacheEntry);
+
+        // Prefer empty slot, otherwise replace whichever was stored for the older frame
+        MemoSlot& firstSlot = mSlots[firstSlotIndex];
+        MemoSlot& secondSlot = mSlots[firstSlotIndex + 1];
+        MemoSlot* slotToReplace = &firstSlot;
+        if (firstSlot.isUsed
+            && (!secondSlot.isUsed
+                || secondSlot.cacheEntryAfter.lastUsedFrame < firstSlot.cacheEntryAfter.lastUsedFrame)) {
+            slotToReplace = &secondSlot;
+        }
+
+        slotToReplace->isUsed = true;
+        slotToReplace->hash = hash;
+        slotToReplace->A = A;
+        slotToReplace->B = B;
+        slotToReplace->cacheEntryBefore = cacheEntryBefore;
+        slotToReplace->result = result;
+        slotToReplace->cacheEntryAfter = inOutCacheEntry;
+
+        return result;
+    }
+
+    uint32_t NarrowphaseMemo::CalculateHash(const FCollider& A,
+                                            const FCollider& B,
+                                            const NarrowphaseCacheEntry& cacheEntry) {
+        MemoHasher hasher;
+        AddCollider(hasher, A);
+        AddCollider(hasher, B);
+
+        // Same state as IsSameCacheEntry compares
+        hasher.Add(static_cast<uint64_t>(entt::to_integral(cacheEntry.otherEntity)));
+        hasher.Add(static_cast<uint64_t>(cacheEntry.lastUsedFrame));
+        const GjkWarmStart& warmStart = cacheEntry.gjkWarmStart;
+        hasher.Add(static_cast<uint64_t>(warmStart.directionCount));
+        for (uint32_t i = 0; i < warmStart.directionCount; i++) {
+            hasher.Add(warmStart.directions[i]);
+        }
+
+        const CachedContact& contact = cacheEntry.contact;
+        hasher.Add(static_cast<uint64_t>(contact.isValid));
+        if (contact.isValid) {
+            hasher.Add((static_cast<uint64_t>(contact.wasColliding) << 32) | contact.calculatedFrame);
+            hasher.Add(contact.axis);
+            hasher.Add(contact.depth);
+            hasher.Add(contact.referenceOffset);
+        }
+
+        return hasher.Finish();
+    }
+
+    bool NarrowphaseMemo::IsMatch(const MemoSlot& slot,
+                                  uint32_t hash,
+                                  const FCollider& A,
+                                  const FCollider& B,
+                                  const NarrowphaseCacheEntry& cacheEntry) {
+        return slot.isUsed
+            && slot.hash == hash
+            && slot.A.IsSameShapeAndPose(A)
+            && slot.B.IsSameShapeAndPose(B)
+            && IsSameCacheEntry(slot.cacheEntryBefore, cacheEntry);
+    }
+
+    bool NarrowphaseMemo::IsSameCacheEntry(const NarrowphaseCacheEntry& A, const NarrowphaseCacheEntry& B) {
+        if (A.otherEntity != B.otherEntity || A.lastUsedFrame != B.lastUsedFrame) {
+            return false;
+        }
+
+        const GjkWarmStart& warmStartA = A.gjkWarmStart;
+        const GjkWarmStart& warmStartB = B.gjkWarmStart;
+        if (warmStartA.directionCount != warmStartB.directionCount) {
+            return false;
+        }
+        for (uint32_t i = 0; i < warmStartA.directionCount; i++) {
+            if (warmStartA.directions[i] != warmStartB.directions[i]) {
+                return false;
+            }
+        }
+
+        // Invalid contacts are never read, so remaining contact data doesn't matter in that case
+        const CachedContact& contactA = A.contact;
+        const CachedContact& contactB = B.contact;
+        if (contactA.isValid != contactB.isValid) {
+            return false;
+        }
+        return !contactA.isValid
+            || (contactA.wasColliding == contactB.wasColliding
+                && contactA.axis == contactB.axis
+                && contactA.depth == contactB.depth
+                && contactA.referenceOffset == contactB.referenceOffset
+                && contactA.calculatedFrame == contactB.calculatedFrame);
+    }
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <vector>
+
+#include "Model/CollisionData.h"
+#include "Model/FCollider.h"
+#include "Model/GjkData.h"
+#include "Utilities/FrameType.h"
+
+namespace ProjectNomad {
+    struct CoreContext;
+
+    /// <summary>
+    /// Opt-in memo of narrowphase results for re-simulating frames after a rollback.
+    ///
+    /// ComplexCollisions::IsColliding (cache entry version) is a pure function of both colliders and the pair's cache
+    ///     entry. During rollback re-simulation most pairs see exactly the same inputs as the first time the frame was
+    ///     processed, so the stored output (result plus updated cache entry) can be returned instead.
+    /// Entries are matched on exact fixed point state (not just hash), so a memo hit is always bit-identical to
+    ///     recalculating. Thus the memo is NOT part of any snapshot and survives snapshot restoration on purpose.
+    ///
+    /// Storage is a fixed size 2-way set associative table, where the slot used longest ago is replaced. Size it
+    ///     to hold roughly (narrowphase pairs per frame) * (max rollback frames) entries for best hit rate.
+    /// Not thread safe: Only use from a single thread at a time (eg, not from StepPhysicsIslandsSystem workers).
+    /// </summary>
+    class NarrowphaseMemo {
+      public:
+        static constexpr uint32_t kDefaultSlotCount = 4096;
+
+        bool IsEnabled() const {
+            return !mSlots.empty();
+        }
+
+        /**
+        * Allocates table and starts memoizing. Disabled by default so that there's no memory cost unless opted in.
+        * @param slotCount - total entries to store. Rounded up to a power of two
+        **/
+        void Enable(uint32_t slotCount = kDefaultSlotCount);
+        void Disable();
+        // Forgets all entries, such as when loading a new level where old results would only waste slots
+        void Clear();
+
+        /**
+        * Same as ComplexCollisions::IsColliding with a cache entry, but returns the memoized output if this exact
+        *   query was already calculated. Simply calculates directly if memo isn't enabled.
+        * Note that invalid collider errors are only logged on the first (non-memoized) calculation.
+        **/
+        ImpactResult IsColliding(CoreContext& coreContext,
+                                 const FCollider& A,
+                                 const FCollider& B,
+                                 NarrowphaseCacheEntry& inOutCacheEntry);
+
+        // Purely informational (eg, for profiling and tests)
+        uint32_t GetHitCount() const {
+            return mHitCount;
+        }
+        uint32_t GetMissCount() const {
+            return mMissCount;
+        }
+
+      private:
+        struct MemoSlot {
+            bool isUsed = false;
+            uint32_t hash = 0;
+
+            // Inputs
+            FCollider A;
+            FCollider B;
+            NarrowphaseCacheEntry cacheEntryBefore;
+
+            // Outputs
+            ImpactResult result = ImpactResult::noCollision();
+            NarrowphaseCacheEntry cacheEntryAfter;
+        };
+
+        static uint32_t CalculateHash(const FCollider& A, const FCollider& B, const NarrowphaseCacheEntry& cacheEntry);
+        static bool IsMatch(const MemoSlot& slot,
+                            uint32_t hash,
+                            const FCollider& A,
+                            const FCollider& B,
+                            const NarrowphaseCacheEntry& cacheEntry);
+
+        // Exact comparison of all cache state which can affect narrowphase output (colliders are compared via
+        //      FCollider::IsSameShapeAndPose). CalculateHash covers exactly the same state, so that equal queries
+        //      always land in the same set
+        static bool IsSameCacheEntry(const NarrowphaseCacheEntry& A, const NarrowphaseCacheEntry& B);
+
+        std::vector<MemoSlot> mSlots;
+        uint32_t mHitCount = 0;
+        uint32_t mMissCount = 0;
+    };
+}
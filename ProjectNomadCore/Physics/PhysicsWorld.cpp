@@ -0,0 +1,367 @@
+#include "PhysicsWorld.h"
+
+#include <algorithm>
+
+#include "Context/CoreContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Model/Cone.h"
+#include "Model/FCollider.h"
+#include "Model/Line.h"
+#include "Model/Ray.h"
+#include "SimpleCollisions.h"
+#include "CollisionHelpers.h"
+
+namespace ProjectNomad {
+    void PhysicsWorld::RebuildStaticBroadphase(CoreContext& coreContext) {
+        mStaticTree.Clear();
+
+        auto view = coreContext.registry.view<StaticColliderComponent>();
+        for (auto&& [entityId, colliderComp] : view.each()) {
+            // Slightly fatten bounds so fixed point rounding in narrowphase never disagrees with broadphase
+            mStaticTree.AddProxy(
+                colliderComp.collider.GetWorldBounds().Expanded(CollisionHelpers::getEpsilon()),
+                entityId,
+                false,
+                colliderComp.layerFilter
+            );
+        }
+
+        mStaticTree.Build();
+    }
+
+    void PhysicsWorld::RebuildDynamicBroadphase(CoreContext& coreContext) {
+        mDynamicTree.Clear();
+
+        auto view = coreContext.registry.view<DynamicColliderComponent>();
+        for (auto&& [entityId, colliderComp] : view.each()) {
+            mDynamicTree.AddProxy(
+                colliderComp.collider.GetWorldBounds().Expanded(CollisionHelpers::getEpsilon()),
+                entityId,
+                true,
+                colliderComp.layerFilter
+            );
+        }
+
+        mDynamicTree.Build();
+    }
+
+    void PhysicsWorld::RebuildBroadphase(CoreContext& coreContext) {
+        RebuildStaticBroadphase(coreContext);
+        RebuildDynamicBroadphase(coreContext);
+    }
+
+    bool PhysicsWorld::Raycast(CoreContext& coreContext,
+                               const Ray& ray,
+                               fp maxDistance,
+                               SceneQueryMode mode,
+                               const SceneQueryFilter& filter,
+                               SceneQueryHits& outHits) const {
+        if (maxDistance <= fp{0}) {
+            return false;
+        }
+
+        HitCollector collector(mode);
+        fp currentMaxDistance = maxDistance;
+        bool shouldContinue = true;
+
+        auto onCandidate = [&](const BroadphaseProxy& proxy, fp& traversalMaxDistance) {
+            if (filter.ShouldIgnore(proxy.entity, proxy.isDynamic, proxy.layerFilter)) {
+                return true;
+            }
+            const FCollider* collider = GetCollider(coreContext, proxy);
+            if (collider == nullptr) {
+                return true;
+            }
+
+            SceneQueryHit hit;
+            if (!RaycastCollider(coreContext, ray, traversalMaxDistance, *collider, hit.distance, hit.point)) {
+                return true;
+            }
+            hit.hitEntity = proxy.entity;
+            hit.didHitDynamicEntity = proxy.isDynamic;
+
+            // Nothing further than the closest hit can matter, so let the traversal cull accordingly
+            if (mode == SceneQueryMode::ClosestHit) {
+                traversalMaxDistance = hit.distance;
+                currentMaxDistance = hit.distance;
+            }
+
+            shouldContinue = collector.Add(hit);
+            return shouldContinue;
+        };
+
+        if (filter.includeStatic) {
+            mStaticTree.QueryRay(ray.origin, ray.direction, currentMaxDistance, onCandidate);
+        }
+        if (filter.includeDynamic && shouldContinue) {
+            mDynamicTree.QueryRay(ray.origin, ray.direction, currentMaxDistance, onCandidate);
+        }
+
+        return collector.WriteResults(coreContext, outHits);
+    }
+
+    bool PhysicsWorld::Linetest(CoreContext& coreContext,
+                                const Line& line,
+                                SceneQueryMode mode,
+                                const SceneQueryFilter& filter,
+                                SceneQueryHits& outHits) const {
+        fp lineLength = line.getLength();
+        if (lineLength == fp{0}) {
+            return false;
+        }
+
+        Ray ray(line.start, (line.end - line.start) / lineLength);
+        return Raycast(coreContext, ray, lineLength, mode, filter, outHits);
+    }
+
+    bool PhysicsWorld::Overlap(CoreContext& coreContext,
+                               const FCollider& shape,
+                               SceneQueryMode mode,
+                               const SceneQueryFilter& filter,
+                               SceneQueryHits& outHits) const {
+        if (!shape.IsValid()) {
+            coreContext.logger.LogErrorMessage("Overlap query shape is not valid: " + shape.ToString());
+            return false;
+        }
+
+        HitCollector collector(mode);
+        bool shouldContinue = true;
+        AABB queryBounds = shape.GetWorldBounds();
+
+        auto onCandidate = [&](const BroadphaseProxy& proxy) {
+            if (filter.ShouldIgnore(proxy.entity, proxy.isDynamic, proxy.layerFilter)) {
+                return true;
+            }
+            const FCollider* collider = GetCollider(coreContext, proxy);
+            if (collider == nullptr) {
+                return true;
+            }
+
+            if (!SimpleCollisions::IsColliding(coreContext, shape, *collider)) {
+                return true;
+            }
+
+            SceneQueryHit hit;
+            hit.hitEntity = proxy.entity;
+            hit.didHitDynamicEntity = proxy.isDynamic;
+            hit.distance = FVectorFP::Distance(shape.center, collider->center);
+            hit.point = collider->center;
+
+            shouldContinue = collector.Add(hit);
+            return shouldContinue;
+        };
+
+        if (filter.includeStatic) {
+            mStaticTree.QueryOverlap(queryBounds, onCandidate);
+        }
+        if (filter.includeDynamic && shouldContinue) {
+            mDynamicTree.QueryOverlap(queryBounds, onCandidate);
+        }
+
+        return collector.WriteResults(coreContext, outHits);
+    }
+
+    bool PhysicsWorld::OverlapSphere(CoreContext& coreContext,
+                                     const FVectorFP& center,
+                                     fp radius,
+                                     SceneQueryMode mode,
+                                     const SceneQueryFilter& filter,
+                                     SceneQueryHits& outHits) const {
+        FCollider sphere;
+        sphere.SetSphere(center, radius);
+        return Overlap(coreContext, sphere, mode, filter, outHits);
+    }
+
+    bool PhysicsWorld::OverlapBox(CoreContext& coreContext,
+                                  const FVectorFP& center,
+                                  const FQuatFP& rotation,
+                                  const FVectorFP& halfSize,
+                                  SceneQueryMode mode,
+                                  const SceneQueryFilter& filter,
+                                  SceneQueryHits& outHits) const {
+        FCollider box;
+        box.SetBox(center, rotation, halfSize);
+        return Overlap(coreContext, box, mode, filter, outHits);
+    }
+
+    bool PhysicsWorld::Conecast(CoreContext& coreContext,
+                                const Cone& cone,
+                                SceneQueryMode mode,
+                                SceneQuerySortMode sortMode,
+                                const SceneQueryFilter& filter,
+                                SceneQueryHits& outHits) const {
+        if (!cone.IsValid()) {
+            coreContext.logger.LogErrorMessage(
+                "Invalid cone. Half angle: " + cone.halfAngleDegrees.ToString()
+                + ", max distance: " + cone.maxDistance.ToString()
+            );
+            return false;
+        }
+
+        HitCollector collector(mode, sortMode);
+        bool shouldContinue = true;
+
+        auto onCandidate = [&](const BroadphaseProxy& proxy) {
+            if (filter.ShouldIgnore(proxy.entity, proxy.isDynamic, proxy.layerFilter)) {
+                return true;
+            }
+            const FCollider* collider = GetCollider(coreContext, proxy);
+            if (collider == nullptr) {
+                return true;
+            }
+
+            SceneQueryHit hit;
+            if (!SimpleCollisions::Conecast(coreContext, cone, *collider, hit.angleCos, hit.distance)) {
+                return true;
+            }
+            hit.hitEntity = proxy.entity;
+            hit.didHitDynamicEntity = proxy.isDynamic;
+            hit.point = collider->center;
+
+            shouldContinue = collector.Add(hit);
+            return shouldContinue;
+        };
+
+        AABB queryBounds = cone.GetBounds();
+        if (filter.includeStatic) {
+            mStaticTree.QueryOverlap(queryBounds, onCandidate);
+        }
+        if (filter.includeDynamic && shouldContinue) {
+            mDynamicTree.QueryOverlap(queryBounds, onCandidate);
+        }
+
+        return collector.WriteResults(coreContext, outHits);
+    }
+
+    bool PhysicsWorld::Conecast(CoreContext& coreContext,
+                                const FVectorFP& origin,
+                                const FVectorFP& direction,
+                                fp halfAngleDegrees,
+                                fp maxDistance,
+                                const SceneQueryFilter& filter,
+                                SceneQuerySortMode sortMode,
+                                SceneQueryHits& outHits) const {
+        Cone cone(origin, direction, halfAngleDegrees, maxDistance);
+        return Conecast(coreContext, cone, SceneQueryMode::AllHits, sortMode, filter, outHits);
+    }
+
+    CollisionResultWithHitEntity PhysicsWorld::RaycastClosest(CoreContext& coreContext,
+                                                              const Ray& ray,
+                                                              fp maxDistance,
+                                                              const SceneQueryFilter& filter) const {
+        SceneQueryHits hits;
+        if (!Raycast(coreContext, ray, maxDistance, SceneQueryMode::ClosestHit, filter, hits)) {
+            return CollisionResultWithHitEntity::NoCollision();
+        }
+        return hits.Get(0).ToCollisionResult();
+    }
+
+    CollisionResultWithHitEntity PhysicsWorld::LinetestClosest(CoreContext& coreContext,
+                                                               const Line& line,
+                                                               const SceneQueryFilter& filter) const {
+        SceneQueryHits hits;
+        if (!Linetest(coreContext, line, SceneQueryMode::ClosestHit, filter, hits)) {
+            return CollisionResultWithHitEntity::NoCollision();
+        }
+        return hits.Get(0).ToCollisionResult();
+    }
+
+    bool PhysicsWorld::HitCollector::Add(const SceneQueryHit& hit) {
+        switch (mode) {
+            case SceneQueryMode::ClosestHit:
+                if (hitCount == 0 || hit.IsBefore(hits[0], sortMode)) {
+                    hits[0] = hit;
+                    hitCount = 1;
+                }
+                return true;
+
+            case SceneQueryMode::AnyHit:
+                hits[0] = hit;
+                hitCount = 1;
+                return false;
+
+            case SceneQueryMode::AllHits:
+            default:
+                if (hitCount < kMaxSceneQueryHits) {
+                    hits[hitCount] = hit;
+                    hitCount++;
+                    return true;
+                }
+
+                // Out of space. Keep the best hits by replacing the worst one, if new hit is better
+                didOverflow = true;
+                uint32_t worstIndex = 0;
+                for (uint32_t i = 1; i < hitCount; i++) {
+                    if (hits[worstIndex].IsBefore(hits[i], sortMode)) {
+                        worstIndex = i;
+                    }
+                }
+                if (hit.IsBefore(hits[worstIndex], sortMode)) {
+                    hits[worstIndex] = hit;
+                }
+                return true;
+        }
+    }
+
+    bool PhysicsWorld::HitCollector::WriteResults(CoreContext& coreContext, SceneQueryHits& outHits) {
+        if (didOverflow) {
+            coreContext.logger.LogWarnMessage(
+                "Scene query found more hits than max of " + std::to_string(kMaxSceneQueryHits)
+                + ". Only best hits were kept"
+            );
+        }
+
+        // Traversal order differs from result order, so sort with a total order to keep results deterministic
+        std::sort(
+            hits,
+            hits + hitCount,
+            [this](const SceneQueryHit& a, const SceneQueryHit& b) { return a.IsBefore(b, sortMode); }
+        );
+
+        for (uint32_t i = 0; i < hitCount; i++) {
+            if (!outHits.Add(hits[i])) {
+                coreContext.logger.LogWarnMessage("Scene query results did not fit in output array");
+                break;
+            }
+        }
+
+        return hitCount > 0;
+    }
+
+    const FCollider* PhysicsWorld::GetCollider(CoreContext& coreContext, const BroadphaseProxy& proxy) {
+        if (!coreContext.registry.valid(proxy.entity)) {
+            return nullptr;
+        }
+
+        if (proxy.isDynamic) {
+            const auto* colliderComp = coreContext.registry.try_get<DynamicColliderComponent>(proxy.entity);
+            return colliderComp != nullptr ? &colliderComp->collider : nullptr;
+        }
+
+        const auto* colliderComp = coreContext.registry.try_get<StaticColliderComponent>(proxy.entity);
+        return colliderComp != nullptr ? &colliderComp->collider : nullptr;
+    }
+
+    bool PhysicsWorld::RaycastCollider(CoreContext& coreContext,
+                                       const Ray& ray,
+                                       fp maxDistance,
+                                       const FCollider& collider,
+                                       fp& outDistance,
+                                       FVectorFP& outPoint) {
+        if (collider.IsSphere()) {
+            bool didHit = SimpleCollisions::RaycastWithSphere(coreContext, ray, collider, outDistance, outPoint);
+            return didHit && outDistance <= maxDistance;
+        }
+        if (collider.IsBox()) {
+            bool didHit = SimpleCollisions::RaycastWithBox(coreContext, ray, collider, outDistance, outPoint);
+            return didHit && outDistance >= fp{0} && outDistance <= maxDistance;
+        }
+        if (collider.IsCapsule()) {
+            bool didHit = SimpleCollisions::RaycastWithCapsule(coreContext, ray, collider, outDistance, outPoint);
+            return didHit && outDistance <= maxDistance;
+        }
+
+        coreContext.logger.LogErrorMessage("Unexpected collider type for raycast: " + collider.GetTypeAsString());
+        return false;
+    }
+}
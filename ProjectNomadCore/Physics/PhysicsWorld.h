@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Broadphase/BoundingVolumeHierarchy.h"
+#include "Math/FixedPoint.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+#include "Model/CollisionData.h"
+#include "Model/SceneQueryData.h"
+
+struct FCollider;
+
+namespace ProjectNomad {
+    class Cone;
+    class Line;
+    class Ray;
+    struct CoreContext;
+
+    /// <summary>
+    /// World-level scene queries against all Static and Dynamic collider components in the registry.
+    /// Candidates are culled via one BVH per collider category before any narrowphase (SimpleCollisions) work occurs.
+    ///
+    /// Broadphase state is purely derived from the registry and thus is NOT part of any snapshot. Expected usage:
+    /// - RebuildStaticBroadphase after level load (or whenever static colliders are added/removed/moved)
+    /// - RebuildDynamicBroadphase once per frame after movement, and after any snapshot restoration
+    /// Queries always test against the *current* collider component, so entities destroyed since last rebuild are
+    ///     simply skipped. Entities moved since last rebuild may however be missed until next rebuild.
+    /// </summary>
+    class PhysicsWorld {
+      public:
+        void RebuildStaticBroadphase(CoreContext& coreContext);
+        void RebuildDynamicBroadphase(CoreContext& coreContext);
+        void RebuildBroadphase(CoreContext& coreContext);
+
+        /**
+        * Casts a ray against all colliders in the world.
+        * @param ray - ray to cast. Direction is expected to already be normalized (as Ray's constructor does)
+        * @param maxDistance - max distance along the ray to consider
+        * @param mode - whether to find closest hit, any hit, or all hits
+        * @param filter - determines which colliders are considered at all
+        * @param outHits - hits are appended here. Distance is distance along ray to first intersection
+        * @returns true if anything was hit
+        **/
+        bool Raycast(CoreContext& coreContext,
+                     const Ray& ray,
+                     fp maxDistance,
+                     SceneQueryMode mode,
+                     const SceneQueryFilter& filter,
+                     SceneQueryHits& outHits) const;
+
+        /**
+        * Identical to Raycast, with distance limited to length of the line
+        **/
+        bool Linetest(CoreContext& coreContext,
+                      const Line& line,
+                      SceneQueryMode mode,
+                      const SceneQueryFilter& filter,
+                      SceneQueryHits& outHits) const;
+
+        /**
+        * Finds all colliders which overlap the given shape.
+        * Note that hit distance for overlap queries is distance between query shape and hit collider centers.
+        * @param shape - any valid collider to test against the world
+        * @returns true if anything overlaps
+        **/
+        bool Overlap(CoreContext& coreContext,
+                     const FCollider& shape,
+                     SceneQueryMode mode,
+                     const SceneQueryFilter& filter,
+                     SceneQueryHits& outHits) const;
+        bool OverlapSphere(CoreContext& coreContext,
+                           const FVectorFP& center,
+                           fp radius,
+                           SceneQueryMode mode,
+                           const SceneQueryFilter& filter,
+                           SceneQueryHits& outHits) const;
+        bool OverlapBox(CoreContext& coreContext,
+                        const FVectorFP& center,
+                        const FQuatFP& rotation,
+                        const FVectorFP& halfSize,
+                        SceneQueryMode mode,
+                        const SceneQueryFilter& filter,
+                        SceneQueryHits& outHits) const;
+
+        /**
+        * Finds all colliders which are at least partially within a cone, such as for grapple point searching.
+        * @param cone - cone to test with. Half angle must be within (0, 90) degrees
+        * @param mode - whether to find best hit (per sort mode), any hit, or all hits
+        * @param sortMode - whether hits are ordered by distance from cone origin or by angle from cone direction
+        * @param outHits - hits are appended here. Point is the collider center
+        * @returns true if anything was found within the cone
+        **/
+        bool Conecast(CoreContext& coreContext,
+                      const Cone& cone,
+                      SceneQueryMode mode,
+                      SceneQuerySortMode sortMode,
+                      const SceneQueryFilter& filter,
+                      SceneQueryHits& outHits) const;
+        bool Conecast(CoreContext& coreContext,
+                      const FVectorFP& origin,
+                      const FVectorFP& direction,
+                      fp halfAngleDegrees,
+                      fp maxDistance,
+                      const SceneQueryFilter& filter,
+                      SceneQuerySortMode sortMode,
+                      SceneQueryHits& outHits) const;
+
+        // Single result versions for the common "what did this hit?" gameplay case
+        CollisionResultWithHitEntity RaycastClosest(CoreContext& coreContext,
+                                                    const Ray& ray,
+                                                    fp maxDistance,
+                                                    const SceneQueryFilter& filter = {}) const;
+        CollisionResultWithHitEntity LinetestClosest(CoreContext& coreContext,
+                                                     const Line& line,
+                                                     const SceneQueryFilter& filter = {}) const;
+
+      private:
+        /**
+        * Fixed size hit gathering shared by all query types, which handles mode-specific behavior and final ordering
+        **/
+        struct HitCollector {
+            SceneQueryMode mode;
+            SceneQuerySortMode sortMode;
+            SceneQueryHit hits[kMaxSceneQueryHits];
+            uint32_t hitCount = 0;
+            bool didOverflow = false;
+
+            explicit HitCollector(SceneQueryMode mode, SceneQuerySortMode sortMode = SceneQuerySortMode::ByDistance)
+            : mode(mode), sortMode(sortMode) {}
+
+            // Returns false if query should stop (ie, for any-hit queries)
+            bool Add(const SceneQueryHit& hit);
+            // Returns true if any hits were written
+            bool WriteResults(CoreContext& coreContext, SceneQueryHits& outHits);
+        };
+
+        static const FCollider* GetCollider(CoreContext& coreContext, const BroadphaseProxy& proxy);
+
+        static bool RaycastCollider(CoreContext& coreContext,
+                                    const Ray& ray,
+                                    fp maxDistance,
+                                    const FCollider& collider,
+                                    fp& outDistance,
+                                    FVectorFP& outPoint);
+
+        BoundingVolumeHierarchy mStaticTree;
+        BoundingVolumeHierarchy mDynamicTree;
+    };
+}
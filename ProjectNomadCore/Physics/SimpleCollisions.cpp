@@ -2,6 +2,8 @@
 
 #include "Context/CoreContext.h"
 #include "CollisionHelpers.h"
+#include "Model/AABB.h"
+#include "Model/Cone.h"
 #include "Model/Line.h"
 #include "Model/Ray.h"
 #include "Model/FCollider.h"
@@ -89,10 +91,10 @@ namespace ProjectNomad {
         // TODO: Use the Real-Time Collision Detection algorithm, which is far more efficient but still a bit over my head
 
         // Create necessary data used for SAT tests
-        std::vector<FVectorFP> aNormals = boxA.GetBoxNormalsInWorldCoordinates();
-        std::vector<FVectorFP> bNormals = boxB.GetBoxNormalsInWorldCoordinates();
-        std::vector<FVectorFP> aVertices = boxA.GetBoxVerticesInWorldCoordinates();
-        std::vector<FVectorFP> bVertices = boxB.GetBoxVerticesInWorldCoordinates();
+        BoxNormals aNormals = boxA.GetBoxNormalsInWorldCoordinates();
+        BoxNormals bNormals = boxB.GetBoxNormalsInWorldCoordinates();
+        BoxVertices aVertices = boxA.GetBoxVerticesInWorldCoordinates();
+        BoxVertices bVertices = boxB.GetBoxVerticesInWorldCoordinates();
 
         // Estimate penetration depth by keeping track of shortest penetration axis
         fp smallestPenDepth = fp{-1};
@@ -115,55 +117,55 @@ namespace ProjectNomad {
         // Now check for axes based on cross products with each combination of normals
         // FUTURE: Probs could do the deal-with-square-at-end trick instead of full normalizations
         FVectorFP testAxis;
-        testAxis = aNormals.at(0).Cross(bNormals.at(0)).Normalized(); // Normalize to fix pen depth calculations
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(0)).Normalized(); // Normalize to fix pen depth calculations
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(0).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(1)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(0).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(0).Cross(bNormals.Get(2)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(0)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(0)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(1)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(1).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(1).Cross(bNormals.Get(2)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(0)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(0)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(1)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(1)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
         }
 
-        testAxis = aNormals.at(2).Cross(bNormals.at(2)).Normalized();
+        testAxis = aNormals.Get(2).Cross(bNormals.Get(2)).Normalized();
         if (!isIntersectingAlongAxisAndUpdatePenDepthVars(aVertices, bVertices, testAxis, smallestPenDepth,
                                                           penDepthAxis)) {
             return false;
@@ -489,15 +491,15 @@ namespace ProjectNomad {
         //  from the last step.The sides of this triangle are radius, b, and f. We work with
         //  squared units
         fp bSq = distBetweenCentersSq - a * a; // TODO: Rename vars
-        fp f = FPMath::sqrt(radiusSq - bSq);
 
         // Compare the length of the squared radius against the hypotenuse of the triangle from 
         //  the last step
 
-        // Case: No collision has happened
-        if (radiusSq - (distBetweenCentersSq - a * a) < fp{0}) {
+        // Case: No collision has happened. Checked before sqrt as a miss would otherwise take sqrt of a negative
+        if (radiusSq - bSq < fp{0}) {
             return false; // -1 = no intersection
         }
+        fp f = FPMath::sqrt(radiusSq - bSq);
         // Case: Ray starts inside the sphere
         if (distBetweenCentersSq < radiusSq) {
             timeOfIntersection = a + f;
@@ -550,7 +552,33 @@ namespace ProjectNomad {
         return didIntersect;
     }
 
-    // TODO: Raycast capsule
+    /// <summary>
+    /// Checks if and when a ray and capsule intersect
+    /// </summary>
+    /// <param name="ray">Starting point and direction to check for intersection with</param>
+    /// <param name="capsule">Capsule to check for intersection with</param>
+    /// <param name="timeOfIntersection">
+    /// If intersection occurs, this will be distance along ray where it first enters the capsule.
+    /// Note that if ray origin is within capsule, then this will be 0.
+    /// </param>
+    /// <param name="pointOfIntersection">Location where intersection occurs</param>
+    /// <returns>True if intersection occurs, false otherwise</returns>
+    bool SimpleCollisions::RaycastWithCapsule(CoreContext& coreContext,
+                                              const Ray& ray,
+                                              const FCollider& capsule,
+                                              fp& timeOfIntersection,
+                                              FVectorFP& pointOfIntersection) {
+        if (!capsule.IsCapsule()) {
+            coreContext.logger.LogErrorMessage(
+                "CollisionsSimple::raycast",
+                "Provided collider was not a capsule but instead a " + capsule.GetTypeAsString()
+            );
+            return false;
+        }
+
+        return raycastForCapsule(ray, capsule.GetCapsuleMedialLineExtremes(), capsule.GetCapsuleRadius(),
+                                 timeOfIntersection, pointOfIntersection);
+    }
 
     /// <summary>
     /// Checks if a line and OBB intersect
@@ -611,97 +639,439 @@ namespace ProjectNomad {
     }
 
     /// <summary>
-    /// TODO
+    /// Checks if and when a line and capsule intersect. Exact, as done as a raycast limited to length of line
     /// </summary>
-    /// <param name="line">TODO</param>
+    /// <param name="line">Line to check if intersects against capsule</param>
     /// <param name="capsuleMedianLine">Median line of capsule. Note that this is NOT top and bottom, but rather "A" and "B" in relevant diagrams</param>
-    /// <param name="capsuleRadius">TODO</param>
+    /// <param name="capsuleRadius">Radius of capsule around its median line</param>
     /// <param name="timeOfIntersection">Time of intersection with respect to line. Between fp{0} and 1 when there is an intersection</param>
     /// <param name="pointOfIntersection">Point of intersection along line, if there is an intersection</param>
     /// <returns>True if intersection occurs, false otherwise</returns>
-    bool SimpleCollisions::LinetestWithCapsule(CoreContext& coreContext,
+    bool SimpleCollisions::LinetestWithCapsule([[maybe_unused]] CoreContext& coreContext,
                                                const Line& line,
                                                const Line& capsuleMedianLine,
                                                const fp& capsuleRadius,
                                                fp& timeOfIntersection,
                                                FVectorFP& pointOfIntersection) {
-        // Reuse capsule vs capsule logic (or at least the theory behind it)
-        // Comparing line vs capsule is just like comparing two capsules with one of fp{0} radius
-        // IN SHORT, if line gets within capsule's radius of the capsule's center line, then we know there's an intersection
+        fp lineLength = line.getLength();
 
-        // Find distance (squared) between the test line and the median line of the capsule
-        fp timeOfIntersectionForCapsuleLine;
-        FVectorFP closestPointForCapsuleLine;
-        fp distSquared = CollisionHelpers::getClosestPtsBetweenTwoSegments(
-            line, capsuleMedianLine,
-            timeOfIntersection, timeOfIntersectionForCapsuleLine,
-            pointOfIntersection, closestPointForCapsuleLine
-        );
+        // Degenerate line is just a point, so simply check if that point is within the capsule
+        if (lineLength <= CollisionHelpers::getEpsilon()) {
+            fp unusedTime;
+            FVectorFP closestMedialPoint;
+            CollisionHelpers::getClosestPtBetweenPtAndSegment(capsuleMedianLine, line.start, unusedTime, closestMedialPoint);
 
-        // If (squared) distance smaller than (squared) radius, the line and capsule collide
-        bool isColliding = distSquared <= capsuleRadius * capsuleRadius;
-        if (!isColliding) {
-            return false;
-        }
-
-        /// Need to correct time of intersection and point of intersection as this was a test with only lines thus far
-        // Case 1: Linetest segment overlaps with capsule medial line
-        if (FPMath::isNear(distSquared, fp{0}, fp{0.01f})) {
-            // Easy case! Capsule point is really the center of a sphere (due to definition of a capsule + medial line)
-            // Thus the real intersection point is capsuleRadius away from the given point
-            // TODO: Further optimize this, as feels like a waste with sqrt and division
-            fp lineLength = line.getLength();
-            fp adjustmentLengthChange = capsuleRadius / lineLength;
-            // Eg, if capsule radius is 1 and length is 10, then we need to move 10% along length of line
-            timeOfIntersection = timeOfIntersection - adjustmentLengthChange;
-
-            // Edge case: If radius is massive then test line may actually be inside the capsule itself
-            if (timeOfIntersection < fp{0}) {
-                // For this case, default to intersection happening at beginning of test line as it's within the capsule itself
-                timeOfIntersection = fp{0};
-                pointOfIntersection = line.start;
-            } else {
-                // Can either recalculate intersection via going along line OR via adjusting from current point of intersection
-                // Either way should work equally well, so decided to work backwards from given point of intersection
-                FVectorFP linetestReverseDir = FVectorFP::DirectionNotNormalized(line.end, line.start) / lineLength;
-                pointOfIntersection = pointOfIntersection + linetestReverseDir * capsuleRadius;
-            }
-        } else {
-            // Approach: Given we confirmed a collision but test line is NOT intersecting capsule median line,
-            //              then it must be intersecting the capsule at some "sphere" point.
-            //          ie, the test line is intersecting with some sphere centered on the median line, and we
-            //              already know that point as it's closestPointForCapsuleLine!
-            //          Thus we can simply do a linetest against the relevant sphere to get exact hit data
-
-            // Create capsule-based sphere that we're confident the line is actually hitting
-            FCollider capsuleSphereAtClosestPoint;
-            capsuleSphereAtClosestPoint.SetSphere(closestPointForCapsuleLine, capsuleRadius);
-
-            // Do actual raycast check. Note that not checking bool result as this SHOULD intersect no matter what
-            fp lineLength = line.getLength();
-            FVectorFP testlineDir = FVectorFP::DirectionNotNormalized(line.start, line.end) / lineLength;
-            Ray testRay(line.start, testlineDir);
-            RaycastWithSphere(
-                coreContext, testRay, capsuleSphereAtClosestPoint, timeOfIntersection, pointOfIntersection
+            timeOfIntersection = fp{0};
+            pointOfIntersection = line.start;
+            return FVectorFP::DistanceSq(line.start, closestMedialPoint) <= capsuleRadius * capsuleRadius;
+        }
+
+        Ray ray(line.start, (line.end - line.start) / lineLength);
+        bool didRaycastHit = raycastForCapsule(ray, capsuleMedianLine, capsuleRadius,
+                                               timeOfIntersection, pointOfIntersection);
+
+        // Raycast time is distance along line, so convert into linetest definition of time
+        timeOfIntersection = timeOfIntersection / lineLength;
+        return didRaycastHit && timeOfIntersection <= fp{1};
+    }
+
+    /// <summary>
+    /// Checks if and when a moving sphere first touches a capsule. Exact, as sphere vs capsule is the same as sphere's
+    ///     center vs a capsule grown by the sphere's radius
+    /// </summary>
+    /// <param name="sphere">Sphere at start of sweep</param>
+    /// <param name="displacement">Full movement of sphere for this sweep</param>
+    /// <param name="capsule">Capsule to check against. Expected to not move during sweep</param>
+    /// <param name="timeOfImpact">Fraction of displacement (0 to 1) where sphere first touches capsule</param>
+    /// <param name="pointOfImpact">Contact point on capsule's surface at time of impact</param>
+    /// <returns>True if sphere touches capsule at any point during sweep, false otherwise</returns>
+    bool SimpleCollisions::SweepSphereWithCapsule(CoreContext& coreContext,
+                                                  const FCollider& sphere,
+                                                  const FVectorFP& displacement,
+                                                  const FCollider& capsule,
+                                                  fp& timeOfImpact,
+                                                  FVectorFP& pointOfImpact) {
+        if (!sphere.IsSphere()) {
+            coreContext.logger.LogErrorMessage(
+                "CollisionsSimple::sweep",
+                "Provided collider was not a sphere but instead a " + sphere.GetTypeAsString()
             );
+            return false;
+        }
+        if (!capsule.IsCapsule()) {
+            coreContext.logger.LogErrorMessage(
+                "CollisionsSimple::sweep",
+                "Provided collider was not a capsule but instead a " + capsule.GetTypeAsString()
+            );
+            return false;
+        }
+
+        Line capsuleMedialLine = capsule.GetCapsuleMedialLineExtremes();
+        fp capsuleRadius = capsule.GetCapsuleRadius();
+        fp combinedRadius = capsuleRadius + sphere.GetSphereRadius();
+
+        Line centerPath(sphere.GetCenter(), sphere.GetCenter() + displacement);
+        FVectorFP centerAtImpact;
+        if (!LinetestWithCapsule(coreContext, centerPath, capsuleMedialLine, combinedRadius,
+                                 timeOfImpact, centerAtImpact)) {
+            return false;
+        }
 
-            // Currently "time" represents distance along line that collision occurred. Need to convert distance to
-            //      linetest definition of time
-            timeOfIntersection = timeOfIntersection / lineLength;
-            // Edge case: If intersection time is outside normal percentage range (0 <= t <= 1) then line is within
-            //              capsule + doesn't intersect with medial line + doesn't intersect outer edges of capsule
-            if (timeOfIntersection < fp{0} || timeOfIntersection > fp{1}) {
-                // For this case, default to intersection happening at beginning of test line as it's within the capsule itself
-                timeOfIntersection = fp{0};
-                pointOfIntersection = line.start;
+        // Contact point is where the line from nearest medial point to sphere's center crosses capsule's surface
+        fp unusedTime;
+        FVectorFP closestMedialPoint;
+        CollisionHelpers::getClosestPtBetweenPtAndSegment(capsuleMedialLine, centerAtImpact, unusedTime, closestMedialPoint);
+        pointOfImpact = closestMedialPoint + (centerAtImpact - closestMedialPoint) * (capsuleRadius / combinedRadius);
+        return true;
+    }
+
+    /// <summary>
+    /// Checks if and when a moving capsule first touches an OBB. Done in box local space, where first contact is the
+    ///     earliest of following feature pairs:
+    ///     1. Either end sphere of the capsule vs the box (ie, a sphere sweep against the box rounded by capsule radius)
+    ///     2. Any box corner vs the capsule (ie, a reverse raycast from the corner against the capsule)
+    ///     3. Any box edge vs the interior of the capsule's medial segment
+    /// A box face can only touch the medial segment's interior when parallel to it, in which case an end touches too.
+    /// </summary>
+    /// <param name="capsule">Capsule at start of sweep</param>
+    /// <param name="displacement">Full movement of capsule for this sweep</param>
+    /// <param name="box">Box to check against. Expected to not move during sweep</param>
+    /// <param name="timeOfImpact">Fraction of displacement (0 to 1) where capsule first touches box</param>
+    /// <param name="pointOfImpact">Contact point on box's surface at time of impact</param>
+    /// <returns>True if capsule touches box at any point during sweep, false otherwise</returns>
+    bool SimpleCollisions::SweepCapsuleWithBox(CoreContext& coreContext,
+                                               const FCollider& capsule,
+                                               const FVectorFP& displacement,
+                                               const FCollider& box,
+                                               fp& timeOfImpact,
+                                               FVectorFP& pointOfImpact) {
+        if (!capsule.IsCapsule()) {
+            coreContext.logger.LogErrorMessage(
+                "CollisionsSimple::sweep",
+                "Provided collider was not a capsule but instead a " + capsule.GetTypeAsString()
+            );
+            return false;
+        }
+        if (!box.IsBox()) {
+            coreContext.logger.LogErrorMessage(
+                "CollisionsSimple::sweep",
+                "Provided collider was not a box but instead a " + box.GetTypeAsString()
+            );
+            return false;
+        }
+
+        Line worldMedialLine = capsule.GetCapsuleMedialLineExtremes();
+        Line medialLine(box.ToLocalSpaceFromWorld(worldMedialLine.start), box.ToLocalSpaceFromWorld(worldMedialLine.end));
+        FVectorFP localDisplacement = box.ToLocalSpaceForOriginCenteredValue(displacement);
+        FVectorFP boxHalfSize = box.GetBoxHalfSize();
+        fp radius = capsule.GetCapsuleRadius();
+
+        // Already touching at start of sweep
+        fp unusedTime;
+        FVectorFP unusedSegmentPoint, startBoxPoint;
+        fp startDistSq = CollisionHelpers::getClosestPtsBetweenSegmentAndAABB(
+            medialLine, boxHalfSize, unusedTime, unusedSegmentPoint, startBoxPoint
+        );
+        if (startDistSq <= radius * radius) {
+            timeOfImpact = fp{0};
+            pointOfImpact = box.ToWorldSpaceFromLocal(startBoxPoint);
+            return true;
+        }
+
+        fp sweepLength = localDisplacement.GetLength();
+        if (sweepLength <= CollisionHelpers::getEpsilon()) {
+            return false;
+        }
+        FVectorFP sweepDir = localDisplacement / sweepLength;
+
+        // All checks below are done in terms of distance along sweep direction
+        bool didHit = false;
+        fp earliestDistance = sweepLength;
+        FVectorFP earliestBoxPoint;
+
+        // 1. Capsule end spheres vs box
+        for (const FVectorFP& endCenter : {medialLine.start, medialLine.end}) {
+            fp distance;
+            FVectorFP boxPoint;
+            if (raycastSphereForAABB(Ray(endCenter, sweepDir), boxHalfSize, radius, distance, boxPoint)
+                && distance <= earliestDistance) {
+                didHit = true;
+                earliestDistance = distance;
+                earliestBoxPoint = boxPoint;
+            }
+        }
+
+        // 2. Box corners vs capsule, ie corners moving opposite to sweep direction into the (now static) capsule.
+        //      Medial segment sweeps out a flat parallelogram, so corners further than radius from its plane are skipped
+        FVectorFP medialDir = medialLine.end - medialLine.start;
+        FVectorFP sweepPlaneNormal = medialDir.Cross(sweepDir);
+        bool canCullCorners = sweepPlaneNormal.GetLengthSquared() >= CollisionHelpers::getEpsilon();
+        if (canCullCorners) {
+            sweepPlaneNormal = sweepPlaneNormal.Normalized();
+        }
+        for (uint32_t cornerIndex = 0; cornerIndex < 8; cornerIndex++) {
+            FVectorFP corner = getCorner(-boxHalfSize, boxHalfSize, cornerIndex);
+            if (canCullCorners && FPMath::abs(sweepPlaneNormal.Dot(corner - medialLine.start)) > radius) {
+                continue;
+            }
+
+            fp distance;
+            FVectorFP unusedPoint;
+            if (raycastForCapsule(Ray(corner, -sweepDir), medialLine, radius, distance, unusedPoint)
+                && distance <= earliestDistance) {
+                didHit = true;
+                earliestDistance = distance;
+                earliestBoxPoint = corner;
             }
         }
 
+        // 3. Box edges vs interior of medial segment. Interiors first touch when the signed distance between both
+        //      (infinite) lines along their common normal reaches capsule radius
+        for (uint32_t edgeAxis = 0; edgeAxis < 3; edgeAxis++) {
+            uint32_t edgeAxisBit = 1u << edgeAxis;
+            FVectorFP edgeDir = getCorner(FVectorFP::Zero(), FVectorFP(fp{1}), edgeAxisBit);
+            FVectorFP commonNormal = medialDir.Cross(edgeDir);
+            // Parallel lines only touch at segment ends, which are already covered above
+            if (commonNormal.GetLengthSquared() < CollisionHelpers::getEpsilon()) {
+                continue;
+            }
+            commonNormal = commonNormal.Normalized();
+            fp closingSpeed = commonNormal.Dot(sweepDir);
+
+            for (uint32_t cornerIndex = 0; cornerIndex < 8; cornerIndex++) {
+                if (cornerIndex & edgeAxisBit) { // Each edge starts at the corner with min extent along edge axis
+                    continue;
+                }
+                Line edge(getCorner(-boxHalfSize, boxHalfSize, cornerIndex),
+                          getCorner(-boxHalfSize, boxHalfSize, cornerIndex | edgeAxisBit));
+
+                // Only approaching if moving towards edge's line, and lines already within radius are covered above
+                fp separation = commonNormal.Dot(medialLine.start - edge.start);
+                if (separation * closingSpeed >= fp{0}) {
+                    continue;
+                }
+                fp distance = (FPMath::abs(separation) - radius) / FPMath::abs(closingSpeed);
+                if (distance < fp{0} || distance > earliestDistance) {
+                    continue;
+                }
+
+                // Only a hit between interiors if closest points at that time are within both segments
+                Line movedMedialLine(medialLine.start + sweepDir * distance, medialLine.end + sweepDir * distance);
+                fp medialTime, edgeTime;
+                FVectorFP medialPoint, edgePoint;
+                CollisionHelpers::getClosestPtsBetweenTwoSegments(movedMedialLine, edge, medialTime, edgeTime,
+                                                                  medialPoint, edgePoint);
+                if (medialTime > fp{0} && medialTime < fp{1} && edgeTime > fp{0} && edgeTime < fp{1}) {
+                    didHit = true;
+                    earliestDistance = distance;
+                    earliestBoxPoint = edgePoint;
+                }
+            }
+        }
+
+        if (!didHit) {
+            return false;
+        }
+
+        timeOfImpact = earliestDistance / sweepLength;
+        pointOfImpact = box.ToWorldSpaceFromLocal(earliestBoxPoint);
         return true;
     }
 
+    bool SimpleCollisions::Conecast(CoreContext& coreContext,
+                                    const Cone& cone,
+                                    const FCollider& collider,
+                                    fp& angleCos,
+                                    fp& distance) {
+        if (collider.IsSphere()) {
+            return ConecastWithSphere(coreContext, cone, collider, angleCos, distance);
+        }
+        if (collider.IsCapsule()) {
+            return ConecastWithCapsule(coreContext, cone, collider, angleCos, distance);
+        }
+        if (collider.IsBox()) {
+            return ConecastWithBox(coreContext, cone, collider, angleCos, distance);
+        }
+
+        coreContext.logger.LogErrorMessage("Unexpected collider type for conecast: " + collider.GetTypeAsString());
+        return false;
+    }
+
+    bool SimpleCollisions::ConecastWithSphere(CoreContext& coreContext,
+                                              const Cone& cone,
+                                              const FCollider& sphere,
+                                              fp& angleCos,
+                                              fp& distance) {
+        if (!sphere.IsSphere()) {
+            coreContext.logger.LogErrorMessage(
+                "Provided collider was not a sphere but instead a " + sphere.GetTypeAsString()
+            );
+            return false;
+        }
+
+        return conecastForSphereShape(cone, sphere.GetCenter(), sphere.GetSphereRadius(), angleCos, distance);
+    }
+
+    bool SimpleCollisions::ConecastWithCapsule(CoreContext& coreContext,
+                                               const Cone& cone,
+                                               const FCollider& capsule,
+                                               fp& angleCos,
+                                               fp& distance) {
+        if (!capsule.IsCapsule()) {
+            coreContext.logger.LogErrorMessage(
+                "Provided collider was not a capsule but instead a " + capsule.GetTypeAsString()
+            );
+            return false;
+        }
+
+        // Capsule is just a sphere swept along its medial segment. Sphere vs cone is equivalent to sphere center vs
+        //      cone with apex pushed back by radius / sin(halfAngle), so the medial point with smallest angle from
+        //      that shifted apex is the one most likely to be within the cone
+        Line medialSegment = capsule.GetCapsuleMedialLineExtremes();
+        fp radius = capsule.GetCapsuleRadius();
+        FVectorFP shiftedApex = cone.origin - cone.direction * (radius / cone.sinHalfAngle);
+
+        fp bestTime;
+        CollisionHelpers::getMaxAngleCosAlongSegment(shiftedApex, cone.direction, medialSegment, bestTime);
+        FVectorFP bestPoint = medialSegment.start + (medialSegment.end - medialSegment.start) * bestTime;
+        if (conecastForSphereShape(cone, bestPoint, radius, angleCos, distance)) {
+            return true;
+        }
+
+        // Best angle point may be out of range while a nearer part of capsule is still within the cone
+        fp nearestTime;
+        FVectorFP nearestPoint;
+        CollisionHelpers::getClosestPtBetweenPtAndSegment(medialSegment, cone.origin, nearestTime, nearestPoint);
+        return conecastForSphereShape(cone, nearestPoint, radius, angleCos, distance);
+    }
+
+    bool SimpleCollisions::ConecastWithBox(CoreContext& coreContext,
+                                           const Cone& cone,
+                                           const FCollider& box,
+                                           fp& angleCos,
+                                           fp& distance) {
+        if (!box.IsBox()) {
+            coreContext.logger.LogErrorMessage(
+                "Provided collider was not a box but instead a " + box.GetTypeAsString()
+            );
+            return false;
+        }
+
+        // Work in box local space so box is just an AABB centered on origin. Rotation preserves angles and distances
+        //      so no need to recompute cone trig
+        Cone localCone = cone;
+        localCone.origin = box.ToLocalSpaceFromWorld(cone.origin);
+        localCone.direction = box.ToLocalSpaceForOriginCenteredValue(cone.direction);
+        FVectorFP maxExtents = box.GetBoxHalfSize();
+        FVectorFP minExtents = -maxExtents;
+
+        // 1. Apex inside box
+        if (box.IsLocalSpacePtWithinBoxIncludingOnSurface(localCone.origin)) {
+            angleCos = fp{1};
+            distance = fp{0};
+            return true;
+        }
+
+        // 2. Nearest box point to apex, as early out since nothing can be in range if this isn't
+        FVectorFP nearestBoxPoint(
+            FPMath::clamp(localCone.origin.x, minExtents.x, maxExtents.x),
+            FPMath::clamp(localCone.origin.y, minExtents.y, maxExtents.y),
+            FPMath::clamp(localCone.origin.z, minExtents.z, maxExtents.z)
+        );
+        if (FVectorFP::DistanceSq(localCone.origin, nearestBoxPoint) > cone.maxDistance * cone.maxDistance) {
+            return false;
+        }
+
+        // 3. Cone axis hits box. Best possible angle so no need to check further
+        fp axisEntryDistance;
+        AABB localBounds(minExtents, maxExtents);
+        if (localBounds.IntersectsRay(localCone.origin, localCone.direction, cone.maxDistance, axisEntryDistance)) {
+            angleCos = fp{1};
+            distance = axisEntryDistance;
+            return true;
+        }
+
+        // Otherwise best angle within the in-range part of box is on its boundary. Angle has no local minimum on a plane,
+        //      line or sphere other than where the axis passes through (already checked above), so the only other
+        //      candidates are: best point along each edge clipped to range, and best point where range sphere cuts
+        //      each face. Candidates are within range by construction, so only angle needs checking
+        bool didFindAny = false;
+        fp bestCos = fp{-2};
+        fp bestDistance = fp{0};
+        auto considerCandidate = [&](const FVectorFP& point) {
+            FVectorFP toPoint = point - localCone.origin;
+            fp pointDistance = toPoint.GetLength();
+            if (pointDistance == fp{0}) {
+                return;
+            }
+
+            fp pointCos = toPoint.Dot(localCone.direction) / pointDistance;
+            if (pointCos >= cone.cosHalfAngle && pointCos > bestCos) {
+                didFindAny = true;
+                bestCos = pointCos;
+                bestDistance = pointDistance;
+            }
+        };
+
+        // 4. Edges (and thus vertices, as ends of edges). Angle along a line has a single extreme, so best point of
+        //      the in-range portion is either that extreme or one of the clipped ends
+        for (uint32_t n = 0; n < 8; n++) {
+            FVectorFP corner = getCorner(minExtents, maxExtents, n);
+
+            // Each edge is only visited once by walking from corner n along each axis bit which isn't set
+            for (uint32_t axisBit = 1; axisBit <= 4; axisBit <<= 1) {
+                if (n & axisBit) {
+                    continue;
+                }
+
+                Line edge(corner, getCorner(minExtents, maxExtents, n | axisBit));
+                fp entryTime, exitTime;
+                if (!CollisionHelpers::clipSegmentToSphere(edge, localCone.origin, cone.maxDistance, entryTime, exitTime)) {
+                    continue;
+                }
+
+                FVectorFP edgeDir = edge.end - edge.start;
+                Line inRangeEdge(edge.start + edgeDir * entryTime, edge.start + edgeDir * exitTime);
+                fp edgeTime;
+                CollisionHelpers::getMaxAngleCosAlongSegment(localCone.origin, localCone.direction, inRangeEdge, edgeTime);
+                considerCandidate(inRangeEdge.start + (inRangeEdge.end - inRangeEdge.start) * edgeTime);
+            }
+        }
+
+        // 5. Face interiors. Range sphere cuts each face plane in a circle, and every point on that circle is at max
+        //      distance. Thus best point on the circle is simply the one furthest along the axis's in-plane direction
+        for (int axis = 0; axis < 3; axis++) {
+            FVectorFP faceNormal(fp{axis == 0 ? 1 : 0}, fp{axis == 1 ? 1 : 0}, fp{axis == 2 ? 1 : 0});
+            FVectorFP inPlaneDirection = localCone.direction - faceNormal * localCone.direction[axis];
+            if (inPlaneDirection.IsZero()) {
+                continue; // Axis along face normal, so best face point is axis hit or on an edge (both checked above)
+            }
+            inPlaneDirection.Normalize();
+
+            for (fp faceOffset : {-maxExtents[axis], maxExtents[axis]}) {
+                fp apexToPlane = faceOffset - localCone.origin[axis];
+                if (FPMath::abs(apexToPlane) > cone.maxDistance) {
+                    continue;
+                }
+
+                fp circleRadius = FPMath::sqrt(cone.maxDistance * cone.maxDistance - apexToPlane * apexToPlane);
+                FVectorFP circlePoint = localCone.origin + faceNormal * apexToPlane + inPlaneDirection * circleRadius;
+                // Outside of face means best in-range face point is on an edge instead
+                if (box.IsLocalSpacePtWithinBoxIncludingOnSurface(circlePoint)) {
+                    considerCandidate(circlePoint);
+                }
+            }
+        }
+
+        if (didFindAny) {
+            angleCos = bestCos;
+            distance = bestDistance;
+        }
+        return didFindAny;
+    }
+
     bool SimpleCollisions::isIntersectingAlongAxisAndUpdatePenDepthVars(
-        const std::vector<FVectorFP>& boxAVertices, const std::vector<FVectorFP>& boxBVertices,
+        std::span<const FVectorFP> boxAVertices, std::span<const FVectorFP> boxBVertices,
         const FVectorFP& testAxis,
         fp& smallestPenDepth, FVectorFP& penDepthAxis) {
         // Edge case when two normals are parallel. For now, just continue with other SAT tests
@@ -737,6 +1107,46 @@ namespace ProjectNomad {
         return result;
     }
 
+    bool SimpleCollisions::conecastForSphereShape(const Cone& cone,
+                                                  const FVectorFP& center,
+                                                  const fp& radius,
+                                                  fp& angleCos,
+                                                  fp& distance) {
+        FVectorFP apexToCenter = center - cone.origin;
+        fp apexToCenterDistSq = apexToCenter.GetLengthSquared();
+
+        // Range check. Sphere is out of range if nearest point on it is further than cone's max distance
+        fp maxReach = cone.maxDistance + radius;
+        if (apexToCenterDistSq > maxReach * maxReach) {
+            return false;
+        }
+
+        // Is sphere center within the cone that has been pushed backwards by radius / sin(halfAngle)?
+        // This is the Minkowski sum of the cone and sphere, except for the region behind the real apex
+        FVectorFP shiftedApex = cone.origin - cone.direction * (radius / cone.sinHalfAngle);
+        FVectorFP shiftedApexToCenter = center - shiftedApex;
+        fp projectedDist = cone.direction.Dot(shiftedApexToCenter);
+        fp cosSq = cone.cosHalfAngle * cone.cosHalfAngle;
+        if (projectedDist <= fp{0} || projectedDist * projectedDist < shiftedApexToCenter.GetLengthSquared() * cosSq) {
+            return false;
+        }
+
+        // Region behind the real apex: only intersecting if sphere actually contains the apex
+        fp behindApexDist = -cone.direction.Dot(apexToCenter);
+        fp sinSq = cone.sinHalfAngle * cone.sinHalfAngle;
+        if (behindApexDist > fp{0} && behindApexDist * behindApexDist >= apexToCenterDistSq * sinSq) {
+            if (apexToCenterDistSq > radius * radius) {
+                return false;
+            }
+        }
+
+        // Confirmed intersection, so calculate scoring info
+        fp apexToCenterDist = FPMath::sqrt(apexToCenterDistSq);
+        angleCos = apexToCenterDist == fp{0} ? fp{1} : cone.direction.Dot(apexToCenter) / apexToCenterDist;
+        distance = FPMath::max(fp{0}, apexToCenterDist - radius);
+        return true;
+    }
+
     /// <summary>
     /// Checks if and when a ray intersects an AABB (which is effectively local space check against OBB).
     /// Note: Based on Real-Time Collision Detection, Section 5.3.3
@@ -838,8 +1248,8 @@ namespace ProjectNomad {
             FVectorFP finalPointOfIntersection = relativeRay.direction * timeOfLatestHitSoFar + relativeRay.origin;
 
             // Get faces that each point touches (if any)
-            std::vector<FVectorFP> initialPointFaces;
-            std::vector<FVectorFP> finalPointFaces;
+            BoxFaces initialPointFaces;
+            BoxFaces finalPointFaces;
             box.GetFacesThatLocalSpacePointTouches(initialPointOfIntersection, initialPointFaces);
             box.GetFacesThatLocalSpacePointTouches(finalPointOfIntersection, finalPointFaces);
 
@@ -862,4 +1272,156 @@ namespace ProjectNomad {
         pointOfIntersection = relativeRay.origin + relativeRay.direction * timeOfIntersection;
         return true;
     }
+
+    bool SimpleCollisions::raycastForCapsule(const Ray& ray,
+                                             const Line& capsuleMedialLine,
+                                             const fp& capsuleRadius,
+                                             fp& timeOfIntersection,
+                                             FVectorFP& pointOfIntersection) {
+        fp radiusSq = capsuleRadius * capsuleRadius;
+
+        // Ray starting within capsule is treated as an immediate hit
+        fp unusedTime;
+        FVectorFP closestMedialPoint;
+        CollisionHelpers::getClosestPtBetweenPtAndSegment(capsuleMedialLine, ray.origin, unusedTime, closestMedialPoint);
+        if (FVectorFP::DistanceSq(ray.origin, closestMedialPoint) <= radiusSq) {
+            timeOfIntersection = fp{0};
+            pointOfIntersection = ray.origin;
+            return true;
+        }
+
+        // Otherwise capsule is the union of a cylinder and two end spheres, so first hit is earliest hit on any of them
+        bool didHit = false;
+        timeOfIntersection = FPMath::maxLimit();
+
+        // 1. Cylinder side, only counting hits between the end caps. Uses components perpendicular to medial axis,
+        //      so ray vs infinite cylinder becomes ray vs circle: a * t^2 + 2 * b * t + c = 0.
+        //      Discriminant b^2 - a * c is rewritten via Lagrange's identity to keep precision for grazing hits
+        FVectorFP medialDir = capsuleMedialLine.end - capsuleMedialLine.start;
+        fp medialLength = medialDir.GetLength();
+        if (medialLength > CollisionHelpers::getEpsilon()) {
+            FVectorFP medialAxis = medialDir / medialLength;
+            FVectorFP startToOrigin = ray.origin - capsuleMedialLine.start;
+            fp originAlongAxis = startToOrigin.Dot(medialAxis);
+            fp directionAlongAxis = ray.direction.Dot(medialAxis);
+            FVectorFP perpendicularOrigin = startToOrigin - medialAxis * originAlongAxis;
+            FVectorFP perpendicularDirection = ray.direction - medialAxis * directionAlongAxis;
+
+            fp a = perpendicularDirection.GetLengthSquared();
+            fp b = perpendicularOrigin.Dot(perpendicularDirection);
+            fp discriminant = a * radiusSq - perpendicularOrigin.Cross(perpendicularDirection).GetLengthSquared();
+            if (a > fp{0} && discriminant >= fp{0}) {
+                fp time = (-b - FPMath::sqrt(discriminant)) / a;
+                fp hitAlongAxis = originAlongAxis + directionAlongAxis * time;
+                if (time >= fp{0} && hitAlongAxis >= fp{0} && hitAlongAxis <= medialLength) {
+                    didHit = true;
+                    timeOfIntersection = time;
+                }
+            }
+        }
+
+        // 2. End spheres. Origin is known to be outside both, so simpler than RaycastWithSphere.
+        //      Discriminant uses squared distance from sphere center to ray's line rather than b^2 - c, as that keeps
+        //      far more precision for grazing hits
+        for (const FVectorFP& sphereCenter : {capsuleMedialLine.start, capsuleMedialLine.end}) {
+            FVectorFP centerToOrigin = ray.origin - sphereCenter;
+            fp b = centerToOrigin.Dot(ray.direction);
+            fp discriminant = radiusSq - (centerToOrigin - ray.direction * b).GetLengthSquared();
+            // No hit if pointing away from sphere or passing by it
+            if (b > fp{0} || discriminant < fp{0}) {
+                continue;
+            }
+
+            fp time = -b - FPMath::sqrt(discriminant);
+            if (time < timeOfIntersection) {
+                didHit = true;
+                timeOfIntersection = time;
+            }
+        }
+
+        if (didHit) {
+            pointOfIntersection = ray.origin + ray.direction * timeOfIntersection;
+        }
+        return didHit;
+    }
+
+    bool SimpleCollisions::raycastSphereForAABB(const Ray& relativeRay,
+                                                const FVectorFP& boxHalfSize,
+                                                const fp& sphereRadius,
+                                                fp& timeOfIntersection,
+                                                FVectorFP& pointOnBox) {
+        // Based on Real-Time Collision Detection, Section 5.5.7 (IntersectMovingSphereAABB)
+        // Sphere center needs to hit box rounded by sphere radius, which is within box simply expanded by radius
+        FVectorFP expandedHalfSize = boxHalfSize + FVectorFP(sphereRadius);
+        fp timeOfEarliestHit = fp{0};
+        fp timeOfLatestHit = FPMath::maxLimit();
+        for (int i = 0; i < 3; i++) {
+            if (relativeRay.direction[i] == fp{0}) {
+                if (FPMath::abs(relativeRay.origin[i]) > expandedHalfSize[i]) {
+                    return false;
+                }
+                continue;
+            }
+
+            fp timeOfNearPlane = (-expandedHalfSize[i] - relativeRay.origin[i]) / relativeRay.direction[i];
+            fp timeOfFarPlane = (expandedHalfSize[i] - relativeRay.origin[i]) / relativeRay.direction[i];
+            if (timeOfNearPlane > timeOfFarPlane) {
+                FPMath::swap(timeOfNearPlane, timeOfFarPlane);
+            }
+            timeOfEarliestHit = FPMath::max(timeOfEarliestHit, timeOfNearPlane);
+            timeOfLatestHit = FPMath::min(timeOfLatestHit, timeOfFarPlane);
+            if (timeOfEarliestHit > timeOfLatestHit) {
+                return false;
+            }
+        }
+
+        // If hit point is only outside the actual box along at most one axis, then it's on a (flat) face region
+        FVectorFP expandedHitPoint = relativeRay.origin + relativeRay.direction * timeOfEarliestHit;
+        uint32_t outsideAxisCount = 0;
+        uint32_t hitCornerIndex = 0; // Nearest corner to hit point, matching getCorner's format
+        for (int i = 0; i < 3; i++) {
+            if (FPMath::abs(expandedHitPoint[i]) > boxHalfSize[i]) {
+                outsideAxisCount++;
+            }
+            if (expandedHitPoint[i] >= fp{0}) {
+                hitCornerIndex |= 1u << i;
+            }
+        }
+        if (outsideAxisCount <= 1) {
+            timeOfIntersection = timeOfEarliestHit;
+            pointOnBox = FVectorFP(
+                FPMath::clamp(expandedHitPoint.x, -boxHalfSize.x, boxHalfSize.x),
+                FPMath::clamp(expandedHitPoint.y, -boxHalfSize.y, boxHalfSize.y),
+                FPMath::clamp(expandedHitPoint.z, -boxHalfSize.z, boxHalfSize.z)
+            );
+            return true;
+        }
+
+        // Otherwise actual hit (if any) is on the rounded edges: the single edge next to an edge region, or any of the
+        //      three edges meeting at the corner for a corner region
+        bool didHit = false;
+        timeOfIntersection = FPMath::maxLimit();
+        for (int edgeAxis = 0; edgeAxis < 3; edgeAxis++) {
+            bool isWithinAlongEdgeAxis = FPMath::abs(expandedHitPoint[edgeAxis]) <= boxHalfSize[edgeAxis];
+            if (outsideAxisCount == 2 && !isWithinAlongEdgeAxis) {
+                continue;
+            }
+
+            uint32_t edgeAxisBit = 1u << edgeAxis;
+            Line edge(getCorner(-boxHalfSize, boxHalfSize, hitCornerIndex & ~edgeAxisBit),
+                      getCorner(-boxHalfSize, boxHalfSize, hitCornerIndex | edgeAxisBit));
+            fp edgeTimeOfIntersection;
+            FVectorFP sphereCenterAtHit;
+            if (raycastForCapsule(relativeRay, edge, sphereRadius, edgeTimeOfIntersection, sphereCenterAtHit)
+                && edgeTimeOfIntersection < timeOfIntersection) {
+                didHit = true;
+                timeOfIntersection = edgeTimeOfIntersection;
+
+                fp unusedTime;
+                CollisionHelpers::getClosestPtBetweenPtAndSegment(edge, sphereCenterAtHit, unusedTime, pointOnBox);
+            }
+        }
+
+        return didHit;
+    }
 }
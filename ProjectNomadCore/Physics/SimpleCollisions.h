@@ -1,11 +1,14 @@
 #pragma once
 
+#include <span>
+
 #include "Math/FixedPoint.h"
 #include "Math/FVectorFP.h"
 
 struct FCollider;
 
 namespace ProjectNomad {
+    class Cone;
     class Line;
     class Ray;
     struct CoreContext;
@@ -60,7 +63,22 @@ namespace ProjectNomad {
                                    fp& timeOfIntersection,
                                    FVectorFP& pointOfIntersection);
 
-        // TODO: Raycast capsule
+        /// <summary>
+        /// Checks if and when a ray and capsule intersect. Exact, as capsule is treated as a cylinder plus two spheres
+        /// </summary>
+        /// <param name="ray">Starting point and direction to check for intersection with</param>
+        /// <param name="capsule">Capsule to check for intersection with</param>
+        /// <param name="timeOfIntersection">
+        /// If intersection occurs, this will be distance along ray where it first enters the capsule.
+        /// Note that if ray origin is within capsule, then this will be 0.
+        /// </param>
+        /// <param name="pointOfIntersection">Location where intersection occurs</param>
+        /// <returns>True if intersection occurs, false otherwise</returns>
+        static bool RaycastWithCapsule(CoreContext& coreContext,
+                                       const Ray& ray,
+                                       const FCollider& capsule,
+                                       fp& timeOfIntersection,
+                                       FVectorFP& pointOfIntersection);
 
         /// <summary>
         /// Checks if a line and OBB intersect
@@ -87,11 +105,11 @@ namespace ProjectNomad {
                                         FVectorFP& pointOfIntersection);
 
         /// <summary>
-        /// TODO
+        /// Checks if and when a line and capsule intersect. Exact, as done as a raycast limited to length of line
         /// </summary>
-        /// <param name="line">TODO</param>
+        /// <param name="line">Line to check if intersects against capsule</param>
         /// <param name="capsuleMedianLine">Median line of capsule. Note that this is NOT top and bottom, but rather "A" and "B" in relevant diagrams</param>
-        /// <param name="capsuleRadius">TODO</param>
+        /// <param name="capsuleRadius">Radius of capsule around its median line</param>
         /// <param name="timeOfIntersection">Time of intersection with respect to line. Between fp{0} and 1 when there is an intersection</param>
         /// <param name="pointOfIntersection">Point of intersection along line, if there is an intersection</param>
         /// <returns>True if intersection occurs, false otherwise</returns>
@@ -102,12 +120,93 @@ namespace ProjectNomad {
                                         fp& timeOfIntersection,
                                         FVectorFP& pointOfIntersection);
 
+        /// <summary>
+        /// Checks if and when a moving sphere first touches a capsule. Exact, as sphere vs capsule is the same as
+        ///     sphere's center vs a capsule grown by the sphere's radius
+        /// </summary>
+        /// <param name="sphere">Sphere at start of sweep</param>
+        /// <param name="displacement">Full movement of sphere for this sweep</param>
+        /// <param name="capsule">Capsule to check against. Expected to not move during sweep</param>
+        /// <param name="timeOfImpact">Fraction of displacement (0 to 1) where sphere first touches capsule</param>
+        /// <param name="pointOfImpact">Contact point on capsule's surface at time of impact</param>
+        /// <returns>True if sphere touches capsule at any point during sweep, false otherwise</returns>
+        static bool SweepSphereWithCapsule(CoreContext& coreContext,
+                                           const FCollider& sphere,
+                                           const FVectorFP& displacement,
+                                           const FCollider& capsule,
+                                           fp& timeOfImpact,
+                                           FVectorFP& pointOfImpact);
+
+        /// <summary>
+        /// Checks if and when a moving capsule first touches an OBB. Exact, via checking each feature pair which can
+        ///     make first contact in box local space (capsule ends vs box, box corners vs capsule, box edges vs capsule)
+        /// </summary>
+        /// <param name="capsule">Capsule at start of sweep</param>
+        /// <param name="displacement">Full movement of capsule for this sweep</param>
+        /// <param name="box">Box to check against. Expected to not move during sweep</param>
+        /// <param name="timeOfImpact">Fraction of displacement (0 to 1) where capsule first touches box</param>
+        /// <param name="pointOfImpact">Contact point on box's surface at time of impact</param>
+        /// <returns>True if capsule touches box at any point during sweep, false otherwise</returns>
+        static bool SweepCapsuleWithBox(CoreContext& coreContext,
+                                        const FCollider& capsule,
+                                        const FVectorFP& displacement,
+                                        const FCollider& box,
+                                        fp& timeOfImpact,
+                                        FVectorFP& pointOfImpact);
+
+        /// <summary>
+        /// Checks if any part of a collider lies within a cone. Dispatches to the relevant shape-specific function
+        /// </summary>
+        /// <param name="cone">Cone to test with. Expected to be valid (see Cone::IsValid)</param>
+        /// <param name="collider">Collider to test against</param>
+        /// <param name="angleCos">
+        /// If intersecting, cosine of angle between cone direction and best intersecting point. 1 = dead center
+        /// </param>
+        /// <param name="distance">If intersecting, distance from cone origin to best intersecting point</param>
+        /// <returns>True if collider is at least partially within cone, false otherwise</returns>
+        static bool Conecast(CoreContext& coreContext,
+                             const Cone& cone,
+                             const FCollider& collider,
+                             fp& angleCos,
+                             fp& distance);
+
+        /// <summary>
+        /// Checks if sphere is at least partially within a cone.
+        /// Infinite cone portion is based on Eberly's "Intersection of a Sphere and a Cone", which checks sphere
+        ///     center against cone with apex pushed back by radius / sin(halfAngle) and then handles region behind apex
+        /// </summary>
+        static bool ConecastWithSphere(CoreContext& coreContext,
+                                       const Cone& cone,
+                                       const FCollider& sphere,
+                                       fp& angleCos,
+                                       fp& distance);
+
+        /// <summary>
+        /// Checks if capsule is at least partially within a cone.
+        /// Finds the medial segment point with smallest angle from the radius-shifted apex, then reuses sphere logic
+        /// </summary>
+        static bool ConecastWithCapsule(CoreContext& coreContext,
+                                        const Cone& cone,
+                                        const FCollider& capsule,
+                                        fp& angleCos,
+                                        fp& distance);
+
+        /// <summary>
+        /// Checks if OBB is at least partially within a cone. Done in box local space via the following checks:
+        /// cone apex within box, cone axis hits box, then best angle point of each edge clipped to cone range and of
+        /// each face where the range sphere cuts it.
+        /// </summary>
+        static bool ConecastWithBox(CoreContext& coreContext,
+                                    const Cone& cone,
+                                    const FCollider& box,
+                                    fp& angleCos,
+                                    fp& distance);
 
         
 #pragma region Collision Helpers (ie, should be private but not cuz ComplexCollisions usage)
 
-        static bool isIntersectingAlongAxisAndUpdatePenDepthVars(const std::vector<FVectorFP>& boxAVertices,
-                                                                 const std::vector<FVectorFP>& boxBVertices,
+        static bool isIntersectingAlongAxisAndUpdatePenDepthVars(std::span<const FVectorFP> boxAVertices,
+                                                                 std::span<const FVectorFP> boxBVertices,
                                                                  const FVectorFP& testAxis,
                                                                  fp& smallestPenDepth, FVectorFP& penDepthAxis);
 
@@ -136,6 +235,52 @@ namespace ProjectNomad {
                             fp& timeOfIntersection,
                             FVectorFP& pointOfIntersection);
 
+        /// <summary>
+        /// Checks if and when a ray intersects a capsule defined by its medial line and radius
+        /// </summary>
+        /// <param name="ray">Ray to test with</param>
+        /// <param name="capsuleMedialLine">Medial line of capsule</param>
+        /// <param name="capsuleRadius">Radius of capsule around its medial line</param>
+        /// <param name="timeOfIntersection">Distance along ray of first hit. 0 if ray origin is within capsule</param>
+        /// <param name="pointOfIntersection">Location where intersection occurs</param>
+        /// <returns>True if intersection occurs, false otherwise</returns>
+        static bool raycastForCapsule(const Ray& ray,
+                                      const Line& capsuleMedialLine,
+                                      const fp& capsuleRadius,
+                                      fp& timeOfIntersection,
+                                      FVectorFP& pointOfIntersection);
+
+        /// <summary>
+        /// Checks if and when a sphere moving along a ray first touches an AABB (ie, ray vs AABB rounded by radius).
+        /// Note: Based on Real-Time Collision Detection, Section 5.5.7
+        /// </summary>
+        /// <param name="relativeRay">Path of sphere center, already in AABB's local space</param>
+        /// <param name="boxHalfSize">Positive half extents of AABB</param>
+        /// <param name="sphereRadius">Radius of moving sphere</param>
+        /// <param name="timeOfIntersection">Distance along ray of first contact. 0 if sphere starts touching AABB</param>
+        /// <param name="pointOnBox">Contact point on AABB's surface</param>
+        /// <returns>True if sphere touches AABB at any point along ray, false otherwise</returns>
+        static bool raycastSphereForAABB(const Ray& relativeRay,
+                                         const FVectorFP& boxHalfSize,
+                                         const fp& sphereRadius,
+                                         fp& timeOfIntersection,
+                                         FVectorFP& pointOnBox);
+
+        /// <summary>
+        /// Shared logic for sphere-like shapes (spheres and individual capsule points) vs cone
+        /// </summary>
+        /// <param name="cone">Cone to test with</param>
+        /// <param name="center">Center of sphere</param>
+        /// <param name="radius">Radius of sphere</param>
+        /// <param name="angleCos">Cosine of angle between cone direction and direction to sphere center</param>
+        /// <param name="distance">Distance from cone origin to nearest point on sphere</param>
+        /// <returns>True if sphere is at least partially within cone, false otherwise</returns>
+        static bool conecastForSphereShape(const Cone& cone,
+                                           const FVectorFP& center,
+                                           const fp& radius,
+                                           fp& angleCos,
+                                           fp& distance);
+
 #pragma endregion 
     };
 }
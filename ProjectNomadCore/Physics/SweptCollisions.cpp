@@ -0,0 +1,105 @@
+#include "SweptCollisions.h"
+
+#include "GjkEpa.h"
+#include "Context/CoreContext.h"
+#include "Model/FCollider.h"
+
+namespace ProjectNomad {
+    TimeOfImpactResult SweptCollisions::CalculateTimeOfImpact(CoreContext& coreContext,
+                                                              const RuntimeCollider& movingCollider,
+                                                              const FVectorFP& displacement,
+                                                              const RuntimeCollider& otherCollider,
+                                                              GjkWarmStart& inOutWarmStart) {
+        if (movingCollider.IsNotInitialized() || otherCollider.IsNotInitialized()) {
+            coreContext.logger.LogErrorMessage("Collider was not initialized");
+            return TimeOfImpactResult::NoHit();
+        }
+
+        fp radiusSum = movingCollider.coreRadius + otherCollider.coreRadius;
+        // Only translating, so precalculated rotation data is reused across every iteration
+        RuntimeCollider colliderAtTime = movingCollider;
+        fp time = fp{0};
+        fp lastSeparatedTime = fp{0};
+
+        TimeOfImpactResult result;
+        for (uint32_t i = 0; i < kMaxTimeOfImpactIterations; i++) {
+            colliderAtTime.SetCenter(movingCollider.center + displacement * time);
+            GjkDistanceResult distanceResult = GjkEpa::CalculateCoreDistance(
+                colliderAtTime, otherCollider, inOutWarmStart
+            );
+            result.iterations++;
+
+            fp distance = distanceResult.coreDistance - radiusSum;
+            if (distanceResult.areCoresOverlapping || distance <= fp{0}) {
+                if (i == 0) {
+                    result.isHit = true;
+                    result.wasInitiallyOverlapping = true;
+                    result.timeOfImpact = fp{0};
+                    return result;
+                }
+
+                // Rounding overshot contact slightly, so prior direction is the best normal available
+                break;
+            }
+
+            lastSeparatedTime = time;
+            result.contactNormal = distanceResult.directionAToB;
+            fp distanceToContactOffset = distance - kContactOffset;
+
+            // Distance is shrinking at this rate at current time. As distance is convex over time for pure translation,
+            //      this linear estimate is a lower bound: advancing by distance / rate can never step past contact
+            fp closingSpeed = displacement.Dot(distanceResult.directionAToB);
+            if (closingSpeed <= fp{0}) {
+                return TimeOfImpactResult::NoHit(); // Moving apart now means never getting closer later either
+            }
+
+            // Rest of sweep never gets meaningfully closer than contact offset, eg when sliding along a surface
+            fp remainingApproach = closingSpeed * (fp{1} - time);
+            if (remainingApproach <= distanceToContactOffset + kContactTolerance) {
+                return TimeOfImpactResult::NoHit();
+            }
+
+            if (distanceToContactOffset <= kContactTolerance) {
+                result.isHit = true;
+                result.timeOfImpact = time;
+                return result;
+            }
+
+            time += distanceToContactOffset / closingSpeed;
+            if (time >= fp{1}) {
+                return TimeOfImpactResult::NoHit();
+            }
+        }
+
+        // Out of iterations (or overshot), so conservatively stop at furthest time known to not be touching
+        result.isHit = true;
+        result.timeOfImpact = lastSeparatedTime;
+        return result;
+    }
+
+    TimeOfImpactResult SweptCollisions::CalculateTimeOfImpact(CoreContext& coreContext,
+                                                              const FCollider& movingCollider,
+                                                              const FVectorFP& displacement,
+                                                              const FCollider& otherCollider,
+                                                              GjkWarmStart& inOutWarmStart) {
+        if (movingCollider.IsNotInitialized() || otherCollider.IsNotInitialized()) {
+            coreContext.logger.LogErrorMessage(
+                "Collider was not initialized. Moving: " + movingCollider.GetTypeAsString()
+                + ", other: " + otherCollider.GetTypeAsString()
+            );
+            return TimeOfImpactResult::NoHit();
+        }
+
+        return CalculateTimeOfImpact(
+            coreContext, RuntimeCollider(movingCollider), displacement, RuntimeCollider(otherCollider), inOutWarmStart
+        );
+    }
+
+    TimeOfImpactResult SweptCollisions::CalculateTimeOfImpact(CoreContext& coreContext,
+                                                              const FCollider& movingCollider,
+                                                              const FVectorFP& displacement,
+                                                              const FCollider& otherCollider) {
+        GjkWarmStart coldStart;
+        return CalculateTimeOfImpact(coreContext, movingCollider, displacement, otherCollider, coldStart);
+    }
+}
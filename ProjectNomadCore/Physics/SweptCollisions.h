@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Math/FixedPoint.h"
+#include "Math/FVectorFP.h"
+#include "Model/CollisionData.h"
+#include "Model/GjkData.h"
+#include "Model/RuntimeCollider.h"
+
+struct FCollider;
+
+namespace ProjectNomad {
+    struct CoreContext;
+
+    /// <summary>
+    /// Continuous (swept) collision checks for a translating collider against another collider, ie finds how far a
+    ///     collider can move before first contact rather than only checking the final position.
+    ///
+    /// Uses conservative advancement on top of GJK core distances, so any collider pair (swept sphere, capsule, or OBB)
+    ///     is supported. For pure translation the distance over time is convex, so advancing by distance / closing
+    ///     speed never steps past first contact and converges within a handful of GJK queries.
+    /// </summary>
+    class SweptCollisions {
+      public:
+        SweptCollisions() = delete;
+
+        static constexpr uint32_t kMaxTimeOfImpactIterations = 16;
+        // Gap left between colliders at time of impact, so that resulting position is reliably not touching
+        static constexpr fp kContactOffset = fp{0.05f};
+        // Close enough to contact offset to consider first contact as found
+        static constexpr fp kContactTolerance = fp{0.01f};
+
+        /**
+        * Calculates time of first contact for a collider moving by the given displacement against a static collider.
+        * @param movingCollider - collider at start of sweep
+        * @param displacement - full movement of moving collider for this sweep
+        * @param otherCollider - collider to check against. Expected to not move during sweep
+        * @param inOutWarmStart - GJK warm start for this pair (may be empty). Updated with last query's result
+        **/
+        static TimeOfImpactResult CalculateTimeOfImpact(CoreContext& coreContext,
+                                                        const RuntimeCollider& movingCollider,
+                                                        const FVectorFP& displacement,
+                                                        const RuntimeCollider& otherCollider,
+                                                        GjkWarmStart& inOutWarmStart);
+        static TimeOfImpactResult CalculateTimeOfImpact(CoreContext& coreContext,
+                                                        const FCollider& movingCollider,
+                                                        const FVectorFP& displacement,
+                                                        const FCollider& otherCollider,
+                                                        GjkWarmStart& inOutWarmStart);
+        static TimeOfImpactResult CalculateTimeOfImpact(CoreContext& coreContext,
+                                                        const FCollider& movingCollider,
+                                                        const FVectorFP& displacement,
+                                                        const FCollider& otherCollider);
+    };
+}
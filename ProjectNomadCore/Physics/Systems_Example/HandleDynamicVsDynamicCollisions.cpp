@@ -54,7 +54,10 @@ namespace ProjectNomad {
     void HandleDynamicVsDynamicCollisions::Update(SimContext& simContext) {
         MEASURE_SYSTEM_FUNCTION("HandleDynamicVsDynamicCollisions", STAT_SYSTEM_HandleDynamicVsDynamicCollisions);
 
-        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>();
+        // Only awake entities need to look for collisions. Sleeping entities are still collided *against* below
+        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>(
+            entt::exclude<SleepingFlagComponent>
+        );
         for (auto&& [entityId, physicsComp, transformComp, colliderComp] : view.each()) {
             OnUpdate(simContext, entityId, physicsComp, transformComp, colliderComp);
         }
@@ -82,20 +85,40 @@ namespace ProjectNomad {
                                                                         PhysicsComponent& movingPhysicsComp) {
         bool wasCollisionEverFound = false;
 
+        // Per-pair narrowphase data from prior frames, so resting contacts can skip most of the narrowphase work
+        NarrowphaseCache& narrowphaseCache =
+            simContext.registry.get_or_emplace<NarrowphaseCacheComponent>(movingEntityId).cache;
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+
         // Check if new desired position is colliding with any dynamic objects
         auto view = simContext.registry.view<DynamicColliderComponent, PhysicsComponent, TransformComponent>();
         for (auto&& [otherEntityId, otherColliderComp, otherPhysicsComp, otherTransformComp] : view.each()) {
             if (otherEntityId == movingEntityId) {
                 continue;
             }
+            // Reject unwanted pairs (eg, camera vs characters) before any narrowphase work
+            if (!movingColliderComp.layerFilter.CanCollideWith(otherColliderComp.layerFilter)) {
+                continue;
+            }
             
+            // Cheap bounds check first, which also keeps far away entities from churning through the pair cache
+            if (!movingColliderComp.collider.GetWorldBounds().Overlaps(otherColliderComp.collider.GetWorldBounds())) {
+                continue;
+            }
+
+            NarrowphaseCacheEntry& cacheEntry = narrowphaseCache.FindOrAdd(otherEntityId, currentFrame);
             bool collisionFound = CheckAndResolveIndividualCollision(
-                simContext, movingTransformComp, movingColliderComp, movingPhysicsComp,
+                simContext, true, cacheEntry, movingTransformComp, movingColliderComp, movingPhysicsComp,
                 otherTransformComp, otherColliderComp, otherPhysicsComp
             );
             
             if (collisionFound) {
                 wasCollisionEverFound = true;
+
+                // Other entity was just pushed, so it can no longer be left out of physics updates
+                if (simContext.registry.all_of<SleepingFlagComponent>(otherEntityId)) {
+                    PhysicsUpdateHelpers::WakeUp(simContext.registry, otherEntityId);
+                }
             }
         }
 
@@ -104,15 +127,19 @@ namespace ProjectNomad {
 
     bool HandleDynamicVsDynamicCollisions::CheckAndResolveIndividualCollision(
                                                                         SimContext& simContext,
+                                                                        bool canUseNarrowphaseMemo,
+                                                                        NarrowphaseCacheEntry& cacheEntry,
                                                                         TransformComponent& firstTransformComp,
                                                                         DynamicColliderComponent& firstColliderComp,
                                                                         PhysicsComponent& firstPhysicsComp,
                                                                         TransformComponent& secondTransformComp,
                                                                         DynamicColliderComponent& secondColliderComp,
                                                                         PhysicsComponent& secondPhysicsComp) {
-        ImpactResult collisionResultFromFirstObjectPerspective = ComplexCollisions::IsColliding(
-            simContext, firstColliderComp.collider, secondColliderComp.collider
-        );
+        const FCollider& firstCollider = firstColliderComp.collider;
+        const FCollider& secondCollider = secondColliderComp.collider;
+        ImpactResult collisionResultFromFirstObjectPerspective = canUseNarrowphaseMemo
+            ? simContext.narrowphaseMemo.IsColliding(simContext, firstCollider, secondCollider, cacheEntry)
+            : ComplexCollisions::IsColliding(simContext, firstCollider, secondCollider, cacheEntry);
 
         if (!collisionResultFromFirstObjectPerspective.isColliding) {
             return false; // No collision found
@@ -30,6 +30,21 @@ namespace ProjectNomad {
         
         static void Update(SimContext& simContext);
 
+        /**
+         * Checks for and resolves a single collision
+         * @param canUseNarrowphaseMemo - false if called from a worker thread, as memo isn't thread safe
+         * @return true if any collision found
+         */
+        static bool CheckAndResolveIndividualCollision(SimContext& simContext,
+                                                       bool canUseNarrowphaseMemo,
+                                                       NarrowphaseCacheEntry& cacheEntry,
+                                                       TransformComponent& firstTransformComp,
+                                                       DynamicColliderComponent& firstColliderComp,
+                                                       PhysicsComponent& firstPhysicsComp,
+                                                       TransformComponent& secondTransformComp,
+                                                       DynamicColliderComponent& secondColliderComp,
+                                                       PhysicsComponent& secondPhysicsComp);
+
       private:
         static void OnUpdate(SimContext& simContext,
                              entt::entity selfId,
@@ -47,18 +62,6 @@ namespace ProjectNomad {
                                                                DynamicColliderComponent& movingColliderComp,
                                                                PhysicsComponent& movingPhysicsComp);
 
-        /**
-         * Checks for and resolves a single collision
-         * @return true if any collision found
-         */
-        static bool CheckAndResolveIndividualCollision(SimContext& simContext,
-                                                       TransformComponent& firstTransformComp,
-                                                       DynamicColliderComponent& firstColliderComp,
-                                                       PhysicsComponent& firstPhysicsComp,
-                                                       TransformComponent& secondTransformComp,
-                                                       DynamicColliderComponent& secondColliderComp,
-                                                       PhysicsComponent& secondPhysicsComp);
-
         static void ResolveCollisionBetweenDifferentWeights(SimContext& simContext,
                                                             fp massRatioWithHeavierObjectAsNumerator,
                                                             TransformComponent& heavierObjectTransform,
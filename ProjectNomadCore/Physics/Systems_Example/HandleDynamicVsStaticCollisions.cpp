@@ -5,7 +5,10 @@
 #include "Helpers/PhysicsUpdateHelpers.h"
 #include "Physics/ComplexCollisions.h"
 #include "Physics/Model/CollisionData.h"
+#include "Physics/SweptCollisions.h"
+#include "Physics/Model/AABB.h"
 #include "Physics/Model/FCollider.h"
+#include "Physics/Model/RuntimeCollider.h"
 #include "Physics/Utility/CollisionResolutionHelper.h"
 #include "Utilities/Profiling.h"
 
@@ -19,6 +22,11 @@ namespace ProjectNomad {
                                                                                 bool& wasMaxCollisionPassesReached) {
         const auto& gameplayConstants = simContext.GetStaticGameplayData().gameplayConstants; // For readability
 
+        // Sweep first so that movement stops at (and slides along) first contact rather than tunnelling through
+        SweepTowardsLocation(simContext, selfId, colliderComp, physicsComp, newIntendedPos);
+
+        // Discrete passes remain as a fallback for any overlaps which sweeping doesn't handle (eg, spawning inside a
+        //      static collider). Typically finds nothing after sweeping, so only costs a single pass.
         // Intention: Collision resolution with one object may result in colliding with another object
         // Thus, keep retrying collision resolution until no collision (or until hit limit).
         uint8_t totalCollisionPasses = 0;
@@ -36,10 +44,114 @@ namespace ProjectNomad {
         wasMaxCollisionPassesReached = totalCollisionPasses >= gameplayConstants.maxCollisionResolutionsPerFrame;
     }
     
+    void HandleDynamicVsStaticCollisions::SweepTowardsLocation(SimContext& simContext,
+                                                               entt::entity selfId,
+                                                               const DynamicColliderComponent& colliderComp,
+                                                               PhysicsComponent& physicsComp,
+                                                               FVectorFP& inOutTargetPos) {
+        FVectorFP currentPos = colliderComp.collider.center;
+        FVectorFP remainingDisplacement = inOutTargetPos - currentPos;
+
+        for (uint8_t sweepCount = 0; sweepCount < kMaxSweepsPerMove; sweepCount++) {
+            if (remainingDisplacement.IsZero()) {
+                break;
+            }
+
+            FCollider sweepStartCollider = colliderComp.collider.CopyWithNewCenter(currentPos);
+            TimeOfImpactResult impact = FindEarliestStaticImpact(
+                simContext, selfId, colliderComp, sweepStartCollider, remainingDisplacement
+            );
+            if (!impact.isHit) {
+                currentPos += remainingDisplacement;
+                remainingDisplacement = FVectorFP::Zero();
+                break;
+            }
+
+            MoveToImpactAndSlide(impact, currentPos, remainingDisplacement, physicsComp);
+        }
+
+        // Any movement left after max sweeps is dropped, as moving without a sweep could tunnel
+        inOutTargetPos = currentPos;
+    }
+
+    void HandleDynamicVsStaticCollisions::MoveToImpactAndSlide(const TimeOfImpactResult& impact,
+                                                               FVectorFP& inOutPos,
+                                                               FVectorFP& inOutRemainingDisplacement,
+                                                               PhysicsComponent& physicsComp) {
+        // Move up to first contact, then slide along contact surface with whatever movement is left
+        inOutPos += inOutRemainingDisplacement * impact.timeOfImpact;
+        inOutRemainingDisplacement = inOutRemainingDisplacement * (fp{1} - impact.timeOfImpact);
+
+        const FVectorFP& contactNormal = impact.contactNormal;
+        fp displacementIntoSurface = inOutRemainingDisplacement.Dot(contactNormal);
+        if (displacementIntoSurface > fp{0}) {
+            inOutRemainingDisplacement -= contactNormal * displacementIntoSurface;
+        }
+        fp velocityIntoSurface = physicsComp.velocity.Dot(contactNormal);
+        if (velocityIntoSurface > fp{0}) {
+            physicsComp.velocity -= contactNormal * velocityIntoSurface;
+        }
+    }
+
+    TimeOfImpactResult HandleDynamicVsStaticCollisions::FindEarliestStaticImpact(
+                                                                        SimContext& simContext,
+                                                                        entt::entity selfId,
+                                                                        const DynamicColliderComponent& colliderComp,
+                                                                        const FCollider& sweepStartCollider,
+                                                                        const FVectorFP& displacement) {
+        NarrowphaseCache& narrowphaseCache = simContext.registry.get_or_emplace<NarrowphaseCacheComponent>(selfId).cache;
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+
+        // Cheap rejection of anything not even near the swept path
+        AABB sweptBounds = AABB::Merge(
+            sweepStartCollider.GetWorldBounds(),
+            sweepStartCollider.CopyWithNewCenter(sweepStartCollider.center + displacement).GetWorldBounds()
+        ).Expanded(SweptCollisions::kContactOffset);
+
+        // Moving collider is checked against every nearby static, so only precalculate its rotation data once
+        RuntimeCollider runtimeSweepStartCollider(sweepStartCollider);
+
+        TimeOfImpactResult earliestImpact = TimeOfImpactResult::NoHit();
+        entt::entity earliestImpactEntity = entt::null;
+        auto view = simContext.registry.view<StaticColliderComponent>();
+        for (auto&& [entityId, staticColliderComp] : view.each()) {
+            if (!colliderComp.layerFilter.CanCollideWith(staticColliderComp.layerFilter)) {
+                continue;
+            }
+            if (!sweptBounds.Overlaps(staticColliderComp.collider.GetWorldBounds())) {
+                continue;
+            }
+
+            GjkWarmStart& warmStart = narrowphaseCache.FindOrAdd(entityId, currentFrame).gjkWarmStart;
+            RuntimeCollider runtimeStaticCollider(staticColliderComp.collider);
+            TimeOfImpactResult impact = SweptCollisions::CalculateTimeOfImpact(
+                simContext, runtimeSweepStartCollider, displacement, runtimeStaticCollider, warmStart
+            );
+            // Pre-existing overlaps have no meaningful contact normal, so leave those to discrete resolution
+            if (!impact.isHit || impact.wasInitiallyOverlapping) {
+                continue;
+            }
+
+            // Ties broken by entity id so that result is independent of view iteration order
+            bool isEarliest = !earliestImpact.isHit
+                              || impact.timeOfImpact < earliestImpact.timeOfImpact
+                              || (impact.timeOfImpact == earliestImpact.timeOfImpact && entityId < earliestImpactEntity);
+            if (isEarliest) {
+                earliestImpact = impact;
+                earliestImpactEntity = entityId;
+            }
+        }
+
+        return earliestImpact;
+    }
+    
     void HandleDynamicVsStaticCollisions::Update(SimContext& simContext) {
         MEASURE_SYSTEM_FUNCTION("HandleDynamicVsStaticCollisions", STAT_SYSTEM_HandleDynamicVsStaticCollisions);
 
-        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>();
+        // Sleeping entities can't have moved into static geometry, so skip them entirely
+        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>(
+            entt::exclude<SleepingFlagComponent>
+        );
         for (auto&& [entityId, physicsComp, transformComp, colliderComp] : view.each()) {
             OnUpdate(simContext, entityId, physicsComp, transformComp, colliderComp);
         }
@@ -80,11 +192,26 @@ namespace ProjectNomad {
         FCollider futureBoundingShape = colliderComp.collider.CopyWithNewCenter(newIntendedPos);
         bool wasCollisionEverFound = false;
 
+        // Per-pair narrowphase data from prior frames, so resting contacts can skip most of the narrowphase work
+        NarrowphaseCache& narrowphaseCache = simContext.registry.get_or_emplace<NarrowphaseCacheComponent>(selfId).cache;
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+
         // Check if new desired position is colliding with any static objects
         auto view = simContext.registry.view<StaticColliderComponent>();
-        for (auto&& [entityId, colliderComp] : view.each()) {
+        for (auto&& [entityId, staticColliderComp] : view.each()) {
+            // Reject unwanted pairs (eg, camera vs invisible walls) before any narrowphase work
+            if (!colliderComp.layerFilter.CanCollideWith(staticColliderComp.layerFilter)) {
+                continue;
+            }
+
+            // Cheap bounds check first, which also keeps far away entities from churning through the pair cache
+            if (!futureBoundingShape.GetWorldBounds().Overlaps(staticColliderComp.collider.GetWorldBounds())) {
+                continue;
+            }
+
+            NarrowphaseCacheEntry& cacheEntry = narrowphaseCache.FindOrAdd(entityId, currentFrame);
             bool collisionFound = CheckAndResolveIndividualCollision(
-                simContext, futureBoundingShape, colliderComp.collider, physicsComp
+                simContext, true, futureBoundingShape, staticColliderComp.collider, cacheEntry, physicsComp
             );
             
             if (collisionFound) {
@@ -97,10 +224,14 @@ namespace ProjectNomad {
     }
 
     bool HandleDynamicVsStaticCollisions::CheckAndResolveIndividualCollision(SimContext& simContext,
+                                                                             bool canUseNarrowphaseMemo,
                                                                              FCollider& futureCollider,
                                                                              const FCollider& checkAgainstCollider,
+                                                                             NarrowphaseCacheEntry& cacheEntry,
                                                                              PhysicsComponent& physicsComp) {
-        ImpactResult collisionResult = ComplexCollisions::IsColliding(simContext, futureCollider, checkAgainstCollider);
+        ImpactResult collisionResult = canUseNarrowphaseMemo
+            ? simContext.narrowphaseMemo.IsColliding(simContext, futureCollider, checkAgainstCollider, cacheEntry)
+            : ComplexCollisions::IsColliding(simContext, futureCollider, checkAgainstCollider, cacheEntry);
         
         if (collisionResult.isColliding) {
             FVectorFP postCollisionPosition;
@@ -4,6 +4,7 @@
 
 #include "GameCore/CoreComponents.h"
 #include "Math/FVectorFP.h"
+#include "Physics/Model/CollisionData.h"
 
 struct FCollider;
 
@@ -27,9 +28,59 @@ namespace ProjectNomad {
                                                              FVectorFP& newIntendedPos,
                                                              bool& wasMaxCollisionPassesReached);
         
+        /**
+         * Sweeps collider from its current position towards target position against all static colliders. Movement
+         *      stops at first contact then slides along the contact surface with the remaining movement, so fast movers
+         *      can't tunnel through thin geometry. Velocity into any contacted surface is removed as well.
+         * Pre-existing overlaps are ignored here and left to discrete collision resolution.
+         * @param inOutTargetPos - intended position. Set to furthest reachable position along the way
+         */
+        static void SweepTowardsLocation(SimContext& simContext,
+                                         entt::entity selfId,
+                                         const DynamicColliderComponent& colliderComp,
+                                         PhysicsComponent& physicsComp,
+                                         FVectorFP& inOutTargetPos);
+        
         static void Update(SimContext& simContext);
 
+        // Building blocks for running the same logic outside of this system (eg, StepPhysicsIslandsSystem) ---------
+
+        // First contact plus sliding along up to two more surfaces (eg, into a corner) before giving up on the rest
+        static constexpr uint8_t kMaxSweepsPerMove = 3;
+
+        /**
+         * Moves up to the given first contact, then removes remaining movement and velocity going into contact surface
+         * @param inOutPos - position at start of sweep. Set to position at time of impact
+         * @param inOutRemainingDisplacement - full sweep displacement. Set to movement left over for sliding
+         */
+        static void MoveToImpactAndSlide(const TimeOfImpactResult& impact,
+                                         FVectorFP& inOutPos,
+                                         FVectorFP& inOutRemainingDisplacement,
+                                         PhysicsComponent& physicsComp);
+
+        /**
+         * Checks for and resolves a single collision
+         * @param canUseNarrowphaseMemo - false if called from a worker thread, as memo isn't thread safe
+         * @return true if any collision found
+         */
+        static bool CheckAndResolveIndividualCollision(SimContext& simContext,
+                                                       bool canUseNarrowphaseMemo,
+                                                       FCollider& futureCollider,
+                                                       const FCollider& checkAgainstCollider,
+                                                       NarrowphaseCacheEntry& cacheEntry,
+                                                       PhysicsComponent& physicsComp);
+
       private:
+        /**
+         * Finds earliest contact across all static colliders for a single sweep
+         * @return time of impact info for earliest hit, if any
+         */
+        static TimeOfImpactResult FindEarliestStaticImpact(SimContext& simContext,
+                                                           entt::entity selfId,
+                                                           const DynamicColliderComponent& colliderComp,
+                                                           const FCollider& sweepStartCollider,
+                                                           const FVectorFP& displacement);
+
         static void OnUpdate(SimContext& simContext,
                              entt::entity selfId,
                              PhysicsComponent& physicsComp,
@@ -45,14 +96,5 @@ namespace ProjectNomad {
                                                                const DynamicColliderComponent& colliderComp,
                                                                PhysicsComponent& physicsComp,
                                                                FVectorFP& newIntendedPos);
-
-        /**
-         * Checks for and resolves a single collision
-         * @return true if any collision found
-         */
-        static bool CheckAndResolveIndividualCollision(SimContext& simContext,
-                                                       FCollider& futureCollider,
-                                                       const FCollider& checkAgainstCollider,
-                                                       PhysicsComponent& physicsComp);
     };
 }
@@ -10,4 +10,24 @@ namespace ProjectNomad {
         transformComp.location = newLocation;
         colliderComp.collider.SetCenter(newLocation);
     }
+
+    void PhysicsUpdateHelpers::WakeUp(entt::registry& registry, entt::entity entity) {
+        registry.remove<SleepingFlagComponent>(entity);
+
+        // Reset rest counter so entity stays awake for at least a full rest period before sleeping again
+        if (PhysicsComponent* physicsComp = registry.try_get<PhysicsComponent>(entity)) {
+            physicsComp->framesAtRest = 0;
+        }
+    }
+
+    void PhysicsUpdateHelpers::WakeUpEntitiesWithVelocity(entt::registry& registry) {
+        // EnTT allows removing components of the entity currently being iterated, so no need to collect entities first
+        //      (which would allocate every frame). Removals also happen in the same order either way
+        auto view = registry.view<PhysicsComponent, SleepingFlagComponent>();
+        for (auto&& [entityId, physicsComp, sleepingComp] : view.each()) {
+            if (physicsComp.HasAnyVelocity()) {
+                WakeUp(registry, entityId);
+            }
+        }
+    }
 }
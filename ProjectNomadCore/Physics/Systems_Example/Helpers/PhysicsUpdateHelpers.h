@@ -1,5 +1,7 @@
 #pragma once
 
+#include <EnTT/entt.hpp>
+
 struct FVectorFP;
 
 namespace ProjectNomad {
@@ -15,5 +17,12 @@ namespace ProjectNomad {
         static void SetNewLocation(TransformComponent& transformComp,
                                    DynamicColliderComponent& colliderComp,
                                    const FVectorFP& newLocation);
+
+        // Sleeping entities are skipped by all physics systems, so wake up after anything which should make entity
+        //      move or be pushed again (eg, teleporting or applying an impulse). Safe to call on awake entities
+        static void WakeUp(entt::registry& registry, entt::entity entity);
+
+        // Safety net for gameplay code which sets velocity of a sleeping entity without explicitly waking it up
+        static void WakeUpEntitiesWithVelocity(entt::registry& registry);
     };
 }
@@ -0,0 +1,460 @@
+#include "StepPhysicsIslandsSystem.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "HandleDynamicVsDynamicCollisions.h"
+#include "HandleDynamicVsStaticCollisions.h"
+#include "Context/FrameRate.h"
+#include "Context/SimContext.h"
+#include "Helpers/PhysicsUpdateHelpers.h"
+#include "Physics/SweptCollisions.h"
+#include "Physics/Model/CollisionData.h"
+#include "Utilities/Profiling.h"
+#include "Utilities/WorkerPool.h"
+
+namespace ProjectNomad {
+    void StepPhysicsIslandsSystem::Update(SimContext& simContext, WorkerPool& workerPool) {
+        MEASURE_SYSTEM_FUNCTION("StepPhysicsIslandsSystem", STAT_SYSTEM_StepPhysicsIslandsSystem);
+
+        // Same as UpdatePositionFromVelocitySystem: Gameplay may have given a sleeping entity velocity since last frame
+        PhysicsUpdateHelpers::WakeUpEntitiesWithVelocity(simContext.registry);
+
+        GatherIslandBodies(simContext);
+        if (mBodies.empty()) {
+            return;
+        }
+
+        BuildIslands(simContext);
+        if (mIslands.empty()) { // Everything asleep
+            return;
+        }
+
+        GatherStaticBodies(simContext);
+
+        // Each task only touches bodies within its own island, and all inputs are gathered up front. Thus which thread
+        //      steps which island (and when) can't affect the results
+        workerPool.ParallelFor(static_cast<uint32_t>(mIslands.size()), [this, &simContext](uint32_t islandIndex) {
+            StepIsland(simContext, mIslands[islandIndex]);
+        });
+
+        // Escaped body may have touched another island, in which case order across islands matters. Registry hasn't
+        //      been written to yet, so just redo the whole frame exactly as the individual systems would
+        bool didAnyIslandEscape = std::any_of(mIslands.begin(), mIslands.end(), [](const Island& island) {
+            return island.didEscape;
+        });
+        if (UNLIKELY(didAnyIslandEscape)) {
+            GatherIslandBodies(simContext);
+            BuildSingleIsland(simContext);
+            StepIsland(simContext, mIslands[0]);
+        }
+
+        CommitResults(simContext);
+    }
+
+    void StepPhysicsIslandsSystem::GatherStaticBodies(SimContext& simContext) {
+        // Kept in view order, as discrete resolution against each static in turn depends on order
+        mStaticBodies.clear();
+        auto view = simContext.registry.view<StaticColliderComponent>();
+        for (auto&& [entityId, staticColliderComp] : view.each()) {
+            StaticBody& staticBody = mStaticBodies.emplace_back();
+            staticBody.entity = entityId;
+            staticBody.collider = staticColliderComp.collider;
+            staticBody.runtimeCollider.SyncFrom(staticColliderComp.collider);
+            staticBody.layerFilter = staticColliderComp.layerFilter;
+        }
+    }
+
+    void StepPhysicsIslandsSystem::GatherIslandBodies(SimContext& simContext) {
+        // Same view as UpdatePositionFromVelocitySystem (minus the sleeping exclusion), so same processing order
+        mBodies.clear();
+        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>();
+        for (auto&& [entityId, physicsComp, transformComp, colliderComp] : view.each()) {
+            uint32_t bodyIndex = static_cast<uint32_t>(mBodies.size());
+            IslandBody& body = mBodies.emplace_back();
+            body.entity = entityId;
+            body.wasSleeping = simContext.registry.all_of<SleepingFlagComponent>(entityId);
+            body.isSleeping = body.wasSleeping;
+            body.islandParent = bodyIndex;
+            if (!body.isSleeping) { // Sleeping bodies are only loaded if an island actually reaches them
+                LoadBodyComponents(simContext, body);
+            }
+
+            // Cover everywhere the entity intends to reach this frame. Anything further (eg, sliding along a wall or
+            //      being pushed) is caught by IsWithinSweptBounds instead
+            const FCollider& collider = colliderComp.collider;
+            body.sweptBounds = collider.GetWorldBounds();
+            if (!body.isSleeping) {
+                FVectorFP targetPos = transformComp.location;
+                if (!body.isHitstopped) {
+                    targetPos += physicsComp.velocity * FrameRate::TimePerFrameInSec();
+                }
+                body.sweptBounds = AABB::Merge(body.sweptBounds, collider.CopyWithNewCenter(targetPos).GetWorldBounds());
+            }
+            body.sweptBounds = body.sweptBounds.Expanded(kIslandMargin);
+
+            uint32_t entityIndex = entt::to_entity(entityId);
+            if (entityIndex >= mEntityToBodyIndex.size()) {
+                mEntityToBodyIndex.resize(entityIndex + 1);
+            }
+            mEntityToBodyIndex[entityIndex] = bodyIndex;
+        }
+
+        // HandleDynamicVsDynamicCollisions collides against others via a view with a different leading pool, which
+        //      may well iterate in a different order
+        mOtherBodyOrder.clear();
+        auto otherView = simContext.registry.view<DynamicColliderComponent, PhysicsComponent, TransformComponent>();
+        for (auto&& [entityId, colliderComp, physicsComp, transformComp] : otherView.each()) {
+            mOtherBodyOrder.push_back(mEntityToBodyIndex[entt::to_entity(entityId)]);
+        }
+    }
+
+    void StepPhysicsIslandsSystem::LoadBodyComponents(SimContext& simContext, IslandBody& body) {
+        entt::entity entity = body.entity;
+        body.transformComp = simContext.registry.get<TransformComponent>(entity);
+        body.physicsComp = simContext.registry.get<PhysicsComponent>(entity);
+        body.colliderComp = simContext.registry.get<DynamicColliderComponent>(entity);
+        if (const NarrowphaseCacheComponent* cacheComp = simContext.registry.try_get<NarrowphaseCacheComponent>(entity)) {
+            body.narrowphaseCache = cacheComp->cache;
+        }
+        body.isHitstopped = simContext.registry.any_of<HitstopComponent>(entity);
+        body.isInIsland = true;
+    }
+
+    void StepPhysicsIslandsSystem::BuildIslands(SimContext& simContext) {
+        mSweptBoundsTree.Clear();
+        for (const IslandBody& body : mBodies) {
+            mSweptBoundsTree.AddProxy(body.sweptBounds, body.entity, true, {});
+        }
+        mSweptBoundsTree.Build();
+
+        // Flood out from awake bodies only. Sleeping pairs are still linked once reached, as a woken entity collides
+        //      with everything it touches this same frame. Untouched sleeping areas are never queried at all
+        mReachedBodyQueue.clear();
+        for (uint32_t i = 0; i < mBodies.size(); i++) {
+            if (mBodies[i].isInIsland) {
+                mReachedBodyQueue.push_back(i);
+            }
+        }
+        for (uint32_t queueIndex = 0; queueIndex < mReachedBodyQueue.size(); queueIndex++) {
+            uint32_t bodyIndex = mReachedBodyQueue[queueIndex];
+            mSweptBoundsTree.QueryOverlap(mBodies[bodyIndex].sweptBounds, [&](const BroadphaseProxy& proxy) {
+                uint32_t otherIndex = mEntityToBodyIndex[entt::to_entity(proxy.entity)];
+                if (otherIndex == bodyIndex) {
+                    return true;
+                }
+                if (!mBodies[otherIndex].isInIsland) {
+                    LoadBodyComponents(simContext, mBodies[otherIndex]);
+                    mReachedBodyQueue.push_back(otherIndex);
+                }
+
+                uint32_t rootA = FindIslandRoot(bodyIndex);
+                uint32_t rootB = FindIslandRoot(otherIndex);
+                if (rootA != rootB) {
+                    // Always attach to lower index so that resulting roots are independent of pair visiting order
+                    mBodies[std::max(rootA, rootB)].islandParent = std::min(rootA, rootB);
+                }
+                return true;
+            });
+        }
+
+        // Islands ordered by their first body in processing order. Every island has an awake body by construction
+        uint32_t bodyCount = static_cast<uint32_t>(mBodies.size());
+        mIslands.clear();
+        mRootToIslandIndex.assign(bodyCount, UINT32_MAX);
+        for (uint32_t i = 0; i < bodyCount; i++) {
+            if (!mBodies[i].isInIsland) {
+                continue;
+            }
+
+            uint32_t root = FindIslandRoot(i);
+            if (mRootToIslandIndex[root] == UINT32_MAX) {
+                mRootToIslandIndex[root] = static_cast<uint32_t>(mIslands.size());
+                mIslands.emplace_back();
+            }
+            mIslands[mRootToIslandIndex[root]].bodyCount++;
+        }
+
+        uint32_t nextFirstIndex = 0;
+        for (Island& island : mIslands) {
+            island.firstIndex = nextFirstIndex;
+            nextFirstIndex += island.bodyCount;
+        }
+
+        // Bucket both body orders per island, keeping relative order within each island
+        uint32_t islandBodyCount = static_cast<uint32_t>(mReachedBodyQueue.size());
+        mIslandBodyIndices.resize(islandBodyCount);
+        mIslandFillCounts.assign(mIslands.size(), 0);
+        for (uint32_t i = 0; i < bodyCount; i++) {
+            if (mBodies[i].isInIsland) {
+                uint32_t islandIndex = mRootToIslandIndex[FindIslandRoot(i)];
+                mIslandBodyIndices[mIslands[islandIndex].firstIndex + mIslandFillCounts[islandIndex]++] = i;
+            }
+        }
+        mIslandOtherBodyIndices.resize(islandBodyCount);
+        mIslandFillCounts.assign(mIslands.size(), 0);
+        for (uint32_t bodyIndex : mOtherBodyOrder) {
+            if (mBodies[bodyIndex].isInIsland) {
+                uint32_t islandIndex = mRootToIslandIndex[FindIslandRoot(bodyIndex)];
+                mIslandOtherBodyIndices[mIslands[islandIndex].firstIndex + mIslandFillCounts[islandIndex]++] = bodyIndex;
+            }
+        }
+    }
+
+    void StepPhysicsIslandsSystem::BuildSingleIsland(SimContext& simContext) {
+        for (IslandBody& body : mBodies) {
+            if (!body.isInIsland) {
+                LoadBodyComponents(simContext, body);
+            }
+        }
+
+        uint32_t bodyCount = static_cast<uint32_t>(mBodies.size());
+        mIslands.clear();
+        mIslands.emplace_back().bodyCount = bodyCount;
+
+        mIslandBodyIndices.resize(bodyCount);
+        std::iota(mIslandBodyIndices.begin(), mIslandBodyIndices.end(), 0);
+        mIslandOtherBodyIndices.assign(mOtherBodyOrder.begin(), mOtherBodyOrder.end());
+    }
+
+    void StepPhysicsIslandsSystem::StepIsland(SimContext& simContext, Island& island) {
+        // Mirrors running the three individual systems back to back (restricted to this island)
+        uint32_t endIndex = island.firstIndex + island.bodyCount;
+        for (uint32_t i = island.firstIndex; i < endIndex; i++) {
+            IslandBody& body = mBodies[mIslandBodyIndices[i]];
+            if (!body.isSleeping) {
+                MoveFromVelocity(simContext, body);
+            }
+        }
+        for (uint32_t i = island.firstIndex; i < endIndex; i++) {
+            IslandBody& body = mBodies[mIslandBodyIndices[i]];
+            if (!body.isSleeping) {
+                ResolveStaticCollisions(simContext, body);
+                island.didEscape |= !IsWithinSweptBounds(body);
+            }
+        }
+
+        // Sleeping state is checked as each body's turn comes up, so bodies woken by an earlier body are processed too
+        for (uint32_t i = island.firstIndex; i < endIndex; i++) {
+            uint32_t bodyIndex = mIslandBodyIndices[i];
+            if (!mBodies[bodyIndex].isSleeping) {
+                ResolveDynamicCollisions(simContext, island, bodyIndex);
+            }
+        }
+    }
+
+    void StepPhysicsIslandsSystem::MoveFromVelocity(SimContext& simContext, IslandBody& body) {
+        // Same as UpdatePositionFromVelocitySystem, except sweeping against gathered statics instead of the registry
+        if (UNLIKELY(body.isHitstopped)) {
+            return;
+        }
+
+        FVectorFP newLocation = body.transformComp.location + body.physicsComp.velocity * FrameRate::TimePerFrameInSec();
+        SweepTowardsLocation(simContext, body, newLocation);
+        PhysicsUpdateHelpers::SetNewLocation(body.transformComp, body.colliderComp, newLocation);
+    }
+
+    void StepPhysicsIslandsSystem::ResolveStaticCollisions(SimContext& simContext, IslandBody& body) {
+        // Same as HandleDynamicVsStaticCollisions::ProcessStaticCollisionsUntilLimitReached
+        const auto& gameplayConstants = simContext.GetStaticGameplayData().gameplayConstants; // For readability
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+        body.wasProcessed = true;
+
+        FVectorFP intendedPos = body.transformComp.location;
+        SweepTowardsLocation(simContext, body, intendedPos);
+        FCollider futureCollider = body.colliderComp.collider.CopyWithNewCenter(intendedPos);
+
+        uint8_t totalCollisionPasses = 0;
+        while (totalCollisionPasses < gameplayConstants.maxCollisionResolutionsPerFrame) {
+            bool wasCollisionFound = false;
+            for (const StaticBody& staticBody : mStaticBodies) {
+                if (!body.colliderComp.layerFilter.CanCollideWith(staticBody.layerFilter)) {
+                    continue;
+                }
+                if (!futureCollider.GetWorldBounds().Overlaps(staticBody.runtimeCollider.worldBounds)) {
+                    continue;
+                }
+
+                // Islands run on worker threads, so can't use the (single threaded) narrowphase memo
+                NarrowphaseCacheEntry& cacheEntry = body.narrowphaseCache.FindOrAdd(staticBody.entity, currentFrame);
+                if (HandleDynamicVsStaticCollisions::CheckAndResolveIndividualCollision(
+                        simContext, false, futureCollider, staticBody.collider, cacheEntry, body.physicsComp)) {
+                    wasCollisionFound = true;
+                }
+            }
+            if (!wasCollisionFound) {
+                break;
+            }
+
+            totalCollisionPasses++;
+        }
+
+        body.wasStaticCollisionPassLimitReached = totalCollisionPasses >= gameplayConstants.maxCollisionResolutionsPerFrame;
+        PhysicsUpdateHelpers::SetNewLocation(body.transformComp, body.colliderComp, futureCollider.center);
+    }
+
+    void StepPhysicsIslandsSystem::SweepTowardsLocation(SimContext& simContext,
+                                                        IslandBody& body,
+                                                        FVectorFP& inOutTargetPos) {
+        // Same as HandleDynamicVsStaticCollisions::SweepTowardsLocation
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+        FVectorFP currentPos = body.colliderComp.collider.center;
+        FVectorFP remainingDisplacement = inOutTargetPos - currentPos;
+        if (remainingDisplacement.IsZero()) {
+            return;
+        }
+
+        // Rotation doesn't change while sweeping, so runtime form only needs to be moved along between sweeps
+        RuntimeCollider sweepStartCollider(body.colliderComp.collider);
+        for (uint8_t sweepCount = 0; sweepCount < HandleDynamicVsStaticCollisions::kMaxSweepsPerMove; sweepCount++) {
+            if (remainingDisplacement.IsZero()) {
+                break;
+            }
+
+            sweepStartCollider.SetCenter(currentPos);
+            AABB sweptBounds = sweepStartCollider.worldBounds;
+            sweptBounds = AABB::Merge(
+                sweptBounds,
+                AABB(sweptBounds.min + remainingDisplacement, sweptBounds.max + remainingDisplacement)
+            ).Expanded(SweptCollisions::kContactOffset);
+
+            TimeOfImpactResult earliestImpact = TimeOfImpactResult::NoHit();
+            entt::entity earliestImpactEntity = entt::null;
+            for (const StaticBody& staticBody : mStaticBodies) {
+                if (!body.colliderComp.layerFilter.CanCollideWith(staticBody.layerFilter)) {
+                    continue;
+                }
+                if (!sweptBounds.Overlaps(staticBody.runtimeCollider.worldBounds)) {
+                    continue;
+                }
+
+                GjkWarmStart& warmStart = body.narrowphaseCache.FindOrAdd(staticBody.entity, currentFrame).gjkWarmStart;
+                TimeOfImpactResult impact = SweptCollisions::CalculateTimeOfImpact(
+                    simContext, sweepStartCollider, remainingDisplacement, staticBody.runtimeCollider, warmStart
+                );
+                if (!impact.isHit || impact.wasInitiallyOverlapping) {
+                    continue;
+                }
+
+                // Same entity id tie-break as HandleDynamicVsStaticCollisions::FindEarliestStaticImpact
+                bool isEarliest = !earliestImpact.isHit
+                                  || impact.timeOfImpact < earliestImpact.timeOfImpact
+                                  || (impact.timeOfImpact == earliestImpact.timeOfImpact
+                                      && staticBody.entity < earliestImpactEntity);
+                if (isEarliest) {
+                    earliestImpact = impact;
+                    earliestImpactEntity = staticBody.entity;
+                }
+            }
+
+            if (!earliestImpact.isHit) {
+                currentPos += remainingDisplacement;
+                break;
+            }
+            HandleDynamicVsStaticCollisions::MoveToImpactAndSlide(
+                earliestImpact, currentPos, remainingDisplacement, body.physicsComp
+            );
+        }
+
+        inOutTargetPos = currentPos;
+    }
+
+    void StepPhysicsIslandsSystem::ResolveDynamicCollisions(SimContext& simContext,
+                                                            Island& island,
+                                                            uint32_t movingBodyIndex) {
+        // Same as HandleDynamicVsDynamicCollisions, except only against entities within the same island
+        const auto& gameplayConstants = simContext.GetStaticGameplayData().gameplayConstants; // For readability
+        FrameType currentFrame = simContext.simFrame.GetCurrentFrameCount();
+        IslandBody& movingBody = mBodies[movingBodyIndex];
+        movingBody.wasProcessed = true;
+
+        // HandleDynamicVsDynamicCollisions::OnUpdate "moves" to current location first, which matters for bodies that
+        //      were asleep until this step (and thus skipped by the earlier passes)
+        PhysicsUpdateHelpers::SetNewLocation(
+            movingBody.transformComp, movingBody.colliderComp, movingBody.transformComp.location
+        );
+        island.didEscape |= !IsWithinSweptBounds(movingBody);
+
+        uint32_t endIndex = island.firstIndex + island.bodyCount;
+        uint8_t totalCollisionPasses = 0;
+        while (totalCollisionPasses < gameplayConstants.maxCollisionResolutionsPerFrame) {
+            bool wasCollisionFound = false;
+            for (uint32_t i = island.firstIndex; i < endIndex; i++) {
+                uint32_t otherBodyIndex = mIslandOtherBodyIndices[i];
+                if (otherBodyIndex == movingBodyIndex) {
+                    continue;
+                }
+                IslandBody& otherBody = mBodies[otherBodyIndex];
+                if (!movingBody.colliderComp.layerFilter.CanCollideWith(otherBody.colliderComp.layerFilter)) {
+                    continue;
+                }
+                if (!movingBody.colliderComp.collider.GetWorldBounds().Overlaps(otherBody.colliderComp.collider.GetWorldBounds())) {
+                    continue;
+                }
+
+                NarrowphaseCacheEntry& cacheEntry = movingBody.narrowphaseCache.FindOrAdd(otherBody.entity, currentFrame);
+                bool collisionFound = HandleDynamicVsDynamicCollisions::CheckAndResolveIndividualCollision(
+                    simContext, false, cacheEntry,
+                    movingBody.transformComp, movingBody.colliderComp, movingBody.physicsComp,
+                    otherBody.transformComp, otherBody.colliderComp, otherBody.physicsComp
+                );
+                if (collisionFound) {
+                    wasCollisionFound = true;
+                    island.didEscape |= !IsWithinSweptBounds(movingBody) || !IsWithinSweptBounds(otherBody);
+
+                    // Same as PhysicsUpdateHelpers::WakeUp, which has to wait for registry access to remove the flag
+                    if (otherBody.isSleeping) {
+                        otherBody.isSleeping = false;
+                        otherBody.wasWoken = true;
+                        otherBody.physicsComp.framesAtRest = 0;
+                    }
+                }
+            }
+            if (!wasCollisionFound) {
+                break;
+            }
+
+            totalCollisionPasses++;
+        }
+    }
+
+    void StepPhysicsIslandsSystem::CommitResults(SimContext& simContext) {
+        for (const IslandBody& body : mBodies) {
+            // Untouched sleeping entities (including those no island reached) have nothing to write back
+            if (body.wasSleeping && !body.wasWoken) {
+                continue;
+            }
+
+            entt::entity entity = body.entity;
+            simContext.registry.get<TransformComponent>(entity) = body.transformComp;
+            simContext.registry.get<PhysicsComponent>(entity) = body.physicsComp;
+            simContext.registry.get<DynamicColliderComponent>(entity) = body.colliderComp;
+
+            if (body.wasWoken) {
+                PhysicsUpdateHelpers::WakeUp(simContext.registry, entity);
+            }
+            if (body.wasProcessed) {
+                simContext.registry.get_or_emplace<NarrowphaseCacheComponent>(entity).cache = body.narrowphaseCache;
+            }
+
+            // Hitting the max limit of collision passes should *not* be the norm
+            if (UNLIKELY(body.wasStaticCollisionPassLimitReached)) {
+                simContext.logger.LogWarnMessage("FYI: Hit max static collisions per frame");
+            }
+        }
+    }
+
+    uint32_t StepPhysicsIslandsSystem::FindIslandRoot(uint32_t index) {
+        while (mBodies[index].islandParent != index) {
+            // Path halving keeps trees flat without needing recursion
+            mBodies[index].islandParent = mBodies[mBodies[index].islandParent].islandParent;
+            index = mBodies[index].islandParent;
+        }
+        return index;
+    }
+
+    bool StepPhysicsIslandsSystem::IsWithinSweptBounds(const IslandBody& body) {
+        AABB bounds = body.colliderComp.collider.GetWorldBounds();
+        return body.sweptBounds.Contains(bounds.min) && body.sweptBounds.Contains(bounds.max);
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <vector>
+#include <EnTT/entt.hpp>
+
+#include "GameCore/CoreComponents.h"
+#include "Math/FixedPoint.h"
+#include "Physics/Broadphase/BoundingVolumeHierarchy.h"
+#include "Physics/Model/AABB.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/RuntimeCollider.h"
+
+namespace ProjectNomad {
+    struct SimContext;
+    class WorkerPool;
+
+    /// <summary>
+    /// Runs the same per-frame physics update as UpdatePositionFromVelocitySystem, HandleDynamicVsStaticCollisions and
+    ///     HandleDynamicVsDynamicCollisions (in that order), but split into independent contact islands which are
+    ///     stepped in parallel on a worker pool. Use *instead* of those three systems, not alongside them.
+    ///
+    /// Output is bit-identical to running those three systems, regardless of worker thread count:
+    /// - Islands are built from each entity's bounds swept over this frame's movement plus a margin. Entities in
+    ///     different islands thus can't touch as long as every entity stays within its own swept bounds.
+    ///     Touching bounds are found via a BVH, starting from awake entities only. Sleeping entities only join (and
+    ///     are only copied) once reached, so fully asleep areas cost little more than their bounds.
+    /// - Every island is stepped on copies of its entities' components, visiting entities in the same view orders as
+    ///     the individual systems do. Entities woken mid-step are processed in the same frame, same as those systems.
+    /// - If any entity leaves its swept bounds (eg, pushed further than the margin), then the whole frame is instead
+    ///     redone as a single island on the calling thread. Slower, but never wrong.
+    /// - Results are written back to the registry on the calling thread, once all islands are done.
+    /// Shared sim state (registry, logger) is only used from the calling thread, apart from narrowphase error logging
+    ///     which only triggers for invalid collider setups. Thus the narrowphase memo (CoreContext) isn't used here.
+    ///
+    /// Holds on to its working buffers between frames, so that a steady state frame doesn't allocate at all.
+    /// </summary>
+    class StepPhysicsIslandsSystem {
+      public:
+        // Entities whose swept bounds are within this distance are put in the same island
+        static constexpr fp kIslandMargin = fp{1};
+
+        void Update(SimContext& simContext, WorkerPool& workerPool);
+
+      private:
+        struct StaticBody {
+            entt::entity entity = entt::null;
+            FCollider collider;
+            RuntimeCollider runtimeCollider; // Statics don't move during step, so only calculated once per frame
+            CollisionLayerFilter layerFilter;
+        };
+
+        struct IslandBody {
+            entt::entity entity = entt::null;
+
+            // Working copies, only written back to registry once all islands are done
+            TransformComponent transformComp;
+            PhysicsComponent physicsComp;
+            DynamicColliderComponent colliderComp;
+            NarrowphaseCache narrowphaseCache;
+
+            AABB sweptBounds;
+            bool isInIsland = false; // Awake, or reached from an awake body through touching swept bounds
+            bool wasSleeping = false; // As of start of step
+            bool isSleeping = false;
+            bool isHitstopped = false;
+            bool wasWoken = false;
+            bool wasProcessed = false; // ie, whether the individual systems would have touched its narrowphase cache
+            bool wasStaticCollisionPassLimitReached = false;
+            uint32_t islandParent = 0; // Index into bodies for union-find
+        };
+
+        // Range of an island's bodies within both mIslandBodyIndices and mIslandOtherBodyIndices
+        struct Island {
+            uint32_t firstIndex = 0;
+            uint32_t bodyCount = 0;
+            bool didEscape = false; // Some body left its swept bounds, so result can't be used
+        };
+
+        void GatherStaticBodies(SimContext& simContext);
+        void GatherIslandBodies(SimContext& simContext);
+        void LoadBodyComponents(SimContext& simContext, IslandBody& body);
+        void BuildIslands(SimContext& simContext);
+        void BuildSingleIsland(SimContext& simContext);
+
+        void StepIsland(SimContext& simContext, Island& island);
+        void MoveFromVelocity(SimContext& simContext, IslandBody& body);
+        void ResolveStaticCollisions(SimContext& simContext, IslandBody& body);
+        void SweepTowardsLocation(SimContext& simContext, IslandBody& body, FVectorFP& inOutTargetPos);
+        void ResolveDynamicCollisions(SimContext& simContext, Island& island, uint32_t movingBodyIndex);
+
+        void CommitResults(SimContext& simContext);
+
+        uint32_t FindIslandRoot(uint32_t index);
+        static bool IsWithinSweptBounds(const IslandBody& body);
+
+        std::vector<StaticBody> mStaticBodies; // In static view order, same as the individual systems
+        std::vector<IslandBody> mBodies; // In UpdatePositionFromVelocitySystem's view order
+        std::vector<uint32_t> mOtherBodyOrder; // Indices into mBodies in HandleDynamicVsDynamicCollisions' inner view order
+        std::vector<uint32_t> mEntityToBodyIndex; // By entity index, only valid for entities within mBodies
+
+        BoundingVolumeHierarchy mSweptBoundsTree;
+        std::vector<uint32_t> mReachedBodyQueue; // Bodies in island, whose touching bodies are yet to be joined
+        std::vector<Island> mIslands;
+        std::vector<uint32_t> mIslandBodyIndices; // Bodies of each island in processing order
+        std::vector<uint32_t> mIslandOtherBodyIndices; // Bodies of each island in the order they're collided against
+        std::vector<uint32_t> mRootToIslandIndex;
+        std::vector<uint32_t> mIslandFillCounts;
+    };
+}
@@ -1,5 +1,6 @@
 #include "UpdatePositionFromVelocitySystem.h"
 
+#include "HandleDynamicVsStaticCollisions.h"
 #include "Helpers/PhysicsUpdateHelpers.h"
 #include "Context/FrameRate.h"
 #include "Context/SimContext.h"
@@ -10,7 +11,12 @@ namespace ProjectNomad {
     void UpdatePositionFromVelocitySystem::Update(SimContext& simContext) {
         MEASURE_SYSTEM_FUNCTION("UpdatePositionFromVelocitySystem", STAT_SYSTEM_UpdatePositionFromVelocitySystem);
 
-        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>();
+        // Gameplay may have given a sleeping entity velocity since last frame, in which case it should move this frame
+        PhysicsUpdateHelpers::WakeUpEntitiesWithVelocity(simContext.registry);
+
+        auto view = simContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>(
+            entt::exclude<SleepingFlagComponent>
+        );
         for (auto &&[entityId, physicsComp, transformComp, colliderComp] : view.each()) {
             OnUpdate(simContext, entityId, physicsComp, transformComp, colliderComp);
         }
@@ -18,7 +24,7 @@ namespace ProjectNomad {
 
     void UpdatePositionFromVelocitySystem::OnUpdate(SimContext& simContext,
                                                     entt::entity selfId,
-                                                    const PhysicsComponent& physicsComp,
+                                                    PhysicsComponent& physicsComp,
                                                     TransformComponent& transformComp,
                                                     DynamicColliderComponent& colliderComp) {
         // If in hitstop, then don't want any movement (for that neat juicy freeze effect)
@@ -27,6 +33,9 @@ namespace ProjectNomad {
         }
 
         FVectorFP newLocation = transformComp.location + physicsComp.velocity * FrameRate::TimePerFrameInSec();
+
+        // Stop at first contact with static geometry along the way, as fast movers (eg, dashes) could tunnel otherwise
+        HandleDynamicVsStaticCollisions::SweepTowardsLocation(simContext, selfId, colliderComp, physicsComp, newLocation);
         PhysicsUpdateHelpers::SetNewLocation(transformComp, colliderComp, newLocation);
     }
 }
@@ -17,7 +17,7 @@ namespace ProjectNomad {
       private:
         static void OnUpdate(SimContext& simContext,
                              entt::entity selfId,
-                             const PhysicsComponent& physicsComp,
+                             PhysicsComponent& physicsComp,
                              TransformComponent& transformComp,
                              DynamicColliderComponent& colliderComp);
     };
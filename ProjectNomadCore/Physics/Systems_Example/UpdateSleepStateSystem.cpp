@@ -0,0 +1,153 @@
+#include "UpdateSleepStateSystem.h"
+
+#include <algorithm>
+
+#include "Context/SimContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Helpers/PhysicsUpdateHelpers.h"
+#include "Physics/Model/FCollider.h"
+#include "Utilities/Profiling.h"
+
+namespace ProjectNomad {
+    void UpdateSleepStateSystem::Update(SimContext& simContext) {
+        MEASURE_SYSTEM_FUNCTION("UpdateSleepStateSystem", STAT_SYSTEM_UpdateSleepStateSystem);
+
+        GatherAwakeBodies(simContext);
+        if (mAwakeBodies.empty()) { // Everything already asleep, so nothing can change without outside interference
+            return;
+        }
+
+        BuildIslands();
+        WakeSleepingBodiesTouchingMovingBodies(simContext);
+        PutRestingIslandsToSleep(simContext);
+    }
+
+    void UpdateSleepStateSystem::GatherAwakeBodies(SimContext& simContext) {
+        static constexpr fp kRestSpeedThresholdSquared = kRestSpeedThreshold * kRestSpeedThreshold;
+
+        mAwakeBodies.clear();
+        mHasMovingBody = false;
+        auto view = simContext.registry.view<PhysicsComponent, DynamicColliderComponent>(
+            entt::exclude<SleepingFlagComponent>
+        );
+        for (auto&& [entityId, physicsComp, colliderComp] : view.each()) {
+            bool isAtRest = physicsComp.velocity.GetLengthSquared() <= kRestSpeedThresholdSquared;
+            if (isAtRest) {
+                // Saturate rather than overflow, as long idle periods would otherwise wrap back to "just moved"
+                if (physicsComp.framesAtRest < kFramesAtRestBeforeSleep) {
+                    physicsComp.framesAtRest++;
+                }
+            }
+            else {
+                physicsComp.framesAtRest = 0;
+            }
+
+            AwakeBody body;
+            body.entity = entityId;
+            body.bounds = colliderComp.collider.GetWorldBounds().Expanded(kIslandContactMargin);
+            body.isReadyToSleep = physicsComp.framesAtRest >= kFramesAtRestBeforeSleep;
+            body.isMoving = !isAtRest;
+            mAwakeBodies.push_back(body);
+            mHasMovingBody |= body.isMoving;
+        }
+
+        // View order isn't something to rely on (eg, after snapshot restoration), so normalize order
+        std::sort(
+            mAwakeBodies.begin(),
+            mAwakeBodies.end(),
+            [](const AwakeBody& a, const AwakeBody& b) { return a.entity < b.entity; }
+        );
+        for (uint32_t i = 0; i < mAwakeBodies.size(); i++) {
+            mAwakeBodies[i].islandParent = i;
+        }
+    }
+
+    void UpdateSleepStateSystem::BuildIslands() {
+        mAwakeTree.Clear();
+        for (const AwakeBody& body : mAwakeBodies) {
+            mAwakeTree.AddProxy(body.bounds, body.entity, true, {});
+        }
+        mAwakeTree.Build();
+
+        for (uint32_t i = 0; i < mAwakeBodies.size(); i++) {
+            mAwakeTree.QueryOverlap(mAwakeBodies[i].bounds, [&](const BroadphaseProxy& proxy) {
+                uint32_t otherIndex = FindAwakeBodyIndex(proxy.entity);
+                if (otherIndex <= i) { // Each pair only needs to be joined once (and never with itself)
+                    return true;
+                }
+
+                uint32_t rootA = FindIslandRoot(i);
+                uint32_t rootB = FindIslandRoot(otherIndex);
+                if (rootA != rootB) {
+                    // Always attach to lower index so that resulting roots are independent of pair visiting order
+                    mAwakeBodies[std::max(rootA, rootB)].islandParent = std::min(rootA, rootB);
+                }
+                return true;
+            });
+        }
+    }
+
+    void UpdateSleepStateSystem::WakeSleepingBodiesTouchingMovingBodies(SimContext& simContext) {
+        if (!mHasMovingBody) { // Resting bodies never wake anything, so no need to even look at sleeping bodies
+            return;
+        }
+
+        mEntitiesToWake.clear();
+        auto view = simContext.registry.view<DynamicColliderComponent, SleepingFlagComponent>();
+        for (auto&& [entityId, colliderComp, sleepingComp] : view.each()) {
+            bool isTouchingMovingBody = false;
+            mAwakeTree.QueryOverlap(colliderComp.collider.GetWorldBounds(), [&](const BroadphaseProxy& proxy) {
+                isTouchingMovingBody = mAwakeBodies[FindAwakeBodyIndex(proxy.entity)].isMoving;
+                return !isTouchingMovingBody;
+            });
+
+            if (isTouchingMovingBody) {
+                mEntitiesToWake.push_back(entityId);
+            }
+        }
+
+        // Woken entities then form islands with their neighbors again from next frame onwards
+        for (entt::entity entity : mEntitiesToWake) {
+            PhysicsUpdateHelpers::WakeUp(simContext.registry, entity);
+        }
+    }
+
+    void UpdateSleepStateSystem::PutRestingIslandsToSleep(SimContext& simContext) {
+        // Any single entity not ready to sleep keeps its entire island awake
+        for (uint32_t i = 0; i < mAwakeBodies.size(); i++) {
+            if (!mAwakeBodies[i].isReadyToSleep) {
+                mAwakeBodies[FindIslandRoot(i)].isIslandReadyToSleep = false;
+            }
+        }
+
+        for (uint32_t i = 0; i < mAwakeBodies.size(); i++) {
+            if (!mAwakeBodies[FindIslandRoot(i)].isIslandReadyToSleep) {
+                continue;
+            }
+
+            entt::entity entity = mAwakeBodies[i].entity;
+            simContext.registry.get<PhysicsComponent>(entity).velocity = FVectorFP::Zero(); // Clear leftover jitter
+            simContext.registry.emplace<SleepingFlagComponent>(entity);
+        }
+    }
+
+    uint32_t UpdateSleepStateSystem::FindIslandRoot(uint32_t index) {
+        while (mAwakeBodies[index].islandParent != index) {
+            // Path halving keeps trees flat without needing recursion
+            mAwakeBodies[index].islandParent = mAwakeBodies[mAwakeBodies[index].islandParent].islandParent;
+            index = mAwakeBodies[index].islandParent;
+        }
+        return index;
+    }
+
+    uint32_t UpdateSleepStateSystem::FindAwakeBodyIndex(entt::entity entity) const {
+        // Awake bodies are sorted by entity, and every proxy in the awake tree is an awake body
+        auto it = std::lower_bound(
+            mAwakeBodies.begin(),
+            mAwakeBodies.end(),
+            entity,
+            [](const AwakeBody& body, entt::entity value) { return body.entity < value; }
+        );
+        return static_cast<uint32_t>(it - mAwakeBodies.begin());
+    }
+}
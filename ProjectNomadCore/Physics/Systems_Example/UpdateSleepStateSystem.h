@@ -0,0 +1,64 @@
+#pragma once
+
+#include <vector>
+#include <EnTT/entt.hpp>
+
+#include "Math/FixedPoint.h"
+#include "Physics/Broadphase/BoundingVolumeHierarchy.h"
+#include "Physics/Model/AABB.h"
+
+namespace ProjectNomad {
+    struct SimContext;
+
+    /// <summary>
+    /// Puts dynamic entities to sleep once they've been at rest for long enough, so that idle props and NPCs cost
+    ///     (almost) nothing in UpdatePositionFromVelocitySystem and the collision handling systems.
+    ///
+    /// Entities are grouped into contact islands (entities whose bounds touch, directly or through other entities).
+    ///     An island only sleeps once *every* entity in it has been at rest long enough, so that eg a stack of crates
+    ///     never has its bottom crate fall asleep while the top crate is still settling.
+    /// Sleeping entities are woken by:
+    /// - Contact with a moving awake entity (checked here and in HandleDynamicVsDynamicCollisions)
+    /// - Gaining velocity (checked at start of UpdatePositionFromVelocitySystem)
+    /// - Explicit PhysicsUpdateHelpers::WakeUp calls from gameplay code
+    ///
+    /// All sleep state lives in components (PhysicsComponent::framesAtRest and SleepingFlagComponent), so it's
+    ///     included in snapshots like any other gameplay state. Touching bodies are found via a BVH over awake bodies,
+    ///     so cost scales with awake bodies and a fully asleep scene is skipped right after the awake body gather.
+    /// Expected to run once per frame after all other physics systems.
+    /// </summary>
+    class UpdateSleepStateSystem {
+      public:
+        static constexpr uint16_t kFramesAtRestBeforeSleep = 30;
+        // Max speed (units per second) still considered "at rest". Non-zero so that tiny resolution jitter is ignored
+        static constexpr fp kRestSpeedThreshold = fp{1};
+        // Entities whose bounds are within this distance are treated as touching for island purposes
+        static constexpr fp kIslandContactMargin = fp{1};
+
+        void Update(SimContext& simContext);
+
+      private:
+        struct AwakeBody {
+            entt::entity entity = entt::null;
+            AABB bounds;
+            bool isReadyToSleep = false;
+            bool isMoving = false;
+            bool isIslandReadyToSleep = true; // Only meaningful for island roots
+            uint32_t islandParent = 0; // Index into awake bodies for union-find
+        };
+
+        void GatherAwakeBodies(SimContext& simContext);
+        void BuildIslands();
+        void WakeSleepingBodiesTouchingMovingBodies(SimContext& simContext);
+        void PutRestingIslandsToSleep(SimContext& simContext);
+
+        uint32_t FindIslandRoot(uint32_t index);
+        uint32_t FindAwakeBodyIndex(entt::entity entity) const;
+
+        // Only kept between frames so that their memory is reused. No state carries over from one update to the next
+        std::vector<AwakeBody> mAwakeBodies;
+        BoundingVolumeHierarchy mAwakeTree;
+        std::vector<entt::entity> mEntitiesToWake;
+        bool mHasMovingBody = false;
+    };
+}
@@ -0,0 +1,160 @@
+#include "TriggerSystem.h"
+
+#include <algorithm>
+
+#include "Context/CoreContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Model/FCollider.h"
+#include "SimpleCollisions.h"
+#include "CollisionHelpers.h"
+
+namespace ProjectNomad {
+    void TriggerSystem::Update(CoreContext& coreContext) {
+        mFrameEvents.Clear();
+        mNarrowphaseTestCount = 0;
+
+        if (!GatherCandidatePairs(coreContext)) {
+            coreContext.logger.LogWarnMessage(
+                "Trigger pairs exceeded max of " + std::to_string(kMaxTriggerPairs) + ". Some overlaps were dropped"
+            );
+        }
+        ResolveCandidateOverlaps(coreContext);
+        if (!GenerateEvents()) {
+            coreContext.logger.LogWarnMessage(
+                "Trigger events exceeded max of " + std::to_string(kMaxTriggerEventsPerFrame)
+                + ". Some events were dropped"
+            );
+        }
+
+        // Candidates are now the latest overlap state
+        mPairCache.pairs.Clear();
+        for (uint32_t i = 0; i < mCandidateCount; i++) {
+            mPairCache.pairs.Add(mCandidates[i]);
+        }
+    }
+
+    bool TriggerSystem::GatherCandidatePairs(CoreContext& coreContext) {
+        mCandidateCount = 0;
+
+        // Tree is rebuilt every update as only the narrowphase results are worth persisting
+        mTriggerTree.Clear();
+        auto triggerView = coreContext.registry.view<TriggerColliderComponent>();
+        for (auto&& [entityId, triggerComp] : triggerView.each()) {
+            mTriggerTree.AddProxy(
+                triggerComp.collider.GetWorldBounds().Expanded(CollisionHelpers::getEpsilon()),
+                entityId,
+                false,
+                triggerComp.layerFilter
+            );
+        }
+        mTriggerTree.Build();
+        if (mTriggerTree.IsEmpty()) {
+            return true;
+        }
+
+        bool didOverflow = false;
+        auto dynamicView = coreContext.registry.view<DynamicColliderComponent>();
+        for (auto&& [entityId, colliderComp] : dynamicView.each()) {
+            AABB otherBounds = colliderComp.collider.GetWorldBounds().Expanded(CollisionHelpers::getEpsilon());
+
+            mTriggerTree.QueryOverlap(otherBounds, [&](const BroadphaseProxy& proxy) {
+                if (!proxy.layerFilter.CanCollideWith(colliderComp.layerFilter)) {
+                    return true;
+                }
+                if (proxy.entity == entityId) { // Entity which is both a trigger and dynamic shouldn't trigger itself
+                    return true;
+                }
+                if (mCandidateCount >= kMaxTriggerPairs) {
+                    didOverflow = true;
+                    return false;
+                }
+
+                TriggerOverlapPair& candidate = mCandidates[mCandidateCount++];
+                candidate.triggerEntity = proxy.entity;
+                candidate.otherEntity = entityId;
+                candidate.triggerCollider = coreContext.registry.get<TriggerColliderComponent>(proxy.entity).collider;
+                candidate.otherCollider = colliderComp.collider;
+                candidate.isOverlapping = false;
+                return true;
+            });
+        }
+
+        // Registry view order is not something to rely on (eg, after snapshot restoration), so apply a total order
+        std::sort(
+            mCandidates,
+            mCandidates + mCandidateCount,
+            [](const TriggerOverlapPair& a, const TriggerOverlapPair& b) { return a.IsBefore(b); }
+        );
+
+        return !didOverflow;
+    }
+
+    void TriggerSystem::ResolveCandidateOverlaps(CoreContext& coreContext) {
+        for (uint32_t i = 0; i < mCandidateCount; i++) {
+            TriggerOverlapPair& candidate = mCandidates[i];
+
+            // If neither side moved, rotated or changed shape since last test, then result can't have changed either
+            const TriggerOverlapPair* cachedPair = mPairCache.Find(candidate.triggerEntity, candidate.otherEntity);
+            if (cachedPair != nullptr
+                && cachedPair->triggerCollider.IsSameShapeAndPose(candidate.triggerCollider)
+                && cachedPair->otherCollider.IsSameShapeAndPose(candidate.otherCollider)) {
+                candidate.isOverlapping = cachedPair->isOverlapping;
+                continue;
+            }
+
+            candidate.isOverlapping =
+                SimpleCollisions::IsColliding(coreContext, candidate.triggerCollider, candidate.otherCollider);
+            mNarrowphaseTestCount++;
+        }
+    }
+
+    bool TriggerSystem::GenerateEvents() {
+        bool didOverflow = false;
+
+        // Both prior pairs and candidates are sorted by the same order, so walk both simultaneously like a merge
+        uint32_t priorIndex = 0;
+        uint32_t candidateIndex = 0;
+        while (priorIndex < mPairCache.pairs.GetSize() || candidateIndex < mCandidateCount) {
+            bool hasPrior = priorIndex < mPairCache.pairs.GetSize();
+            bool hasCandidate = candidateIndex < mCandidateCount;
+
+            // Pair no longer even overlaps in the broadphase (or either entity is gone)
+            if (hasPrior && (!hasCandidate || mPairCache.pairs.Get(priorIndex).IsBefore(mCandidates[candidateIndex]))) {
+                const TriggerOverlapPair& priorPair = mPairCache.pairs.Get(priorIndex);
+                if (priorPair.isOverlapping) {
+                    AddEvent(TriggerEventType::Exit, priorPair, didOverflow);
+                }
+                priorIndex++;
+                continue;
+            }
+
+            const TriggerOverlapPair& candidate = mCandidates[candidateIndex];
+            bool wasOverlapping = false;
+            if (hasPrior && mPairCache.pairs.Get(priorIndex).IsSamePair(candidate)) {
+                wasOverlapping = mPairCache.pairs.Get(priorIndex).isOverlapping;
+                priorIndex++;
+            }
+            candidateIndex++;
+
+            if (candidate.isOverlapping) {
+                AddEvent(wasOverlapping ? TriggerEventType::Stay : TriggerEventType::Enter, candidate, didOverflow);
+            }
+            else if (wasOverlapping) {
+                AddEvent(TriggerEventType::Exit, candidate, didOverflow);
+            }
+        }
+
+        return !didOverflow;
+    }
+
+    void TriggerSystem::AddEvent(TriggerEventType type, const TriggerOverlapPair& pair, bool& didOverflow) {
+        TriggerEvent event;
+        event.type = type;
+        event.triggerEntity = pair.triggerEntity;
+        event.otherEntity = pair.otherEntity;
+
+        if (!mFrameEvents.Add(event)) {
+            didOverflow = true;
+        }
+    }
+}
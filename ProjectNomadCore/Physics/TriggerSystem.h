@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Broadphase/BoundingVolumeHierarchy.h"
+#include "Model/TriggerData.h"
+
+namespace ProjectNomad {
+    struct CoreContext;
+
+    /// <summary>
+    /// Tracks overlaps between TriggerColliderComponents and DynamicColliderComponents, and reports changes as
+    ///     enter/stay/exit events. Replaces per-frame brute force overlap checks in level scripting.
+    ///
+    /// Overlap state lives in a persistent pair cache. Each update, candidate pairs are found via a BVH over trigger
+    ///     bounds, and narrowphase is only re-run for pairs where either side's bounds changed since the last test.
+    ///
+    /// Expected usage:
+    /// - Call Update once per frame after all movement and collision resolution
+    /// - Consume GetFrameEvents() afterwards. Events are only valid until the next Update
+    /// - Include GetPairCache() in rollback snapshots and RestorePairCache on snapshot restoration
+    /// </summary>
+    class TriggerSystem {
+      public:
+        void Update(CoreContext& coreContext);
+
+        // Events generated by last Update, ordered by (trigger, other) entity ids
+        const TriggerEvents& GetFrameEvents() const {
+            return mFrameEvents;
+        }
+
+        const TriggerPairCache& GetPairCache() const {
+            return mPairCache;
+        }
+
+        // Frame events are also cleared, as they belonged to the frame being rolled back from
+        void RestorePairCache(const TriggerPairCache& pairCache) {
+            mPairCache = pairCache;
+            mFrameEvents.Clear();
+        }
+
+        bool IsOverlapping(entt::entity triggerEntity, entt::entity otherEntity) const {
+            return mPairCache.IsOverlapping(triggerEntity, otherEntity);
+        }
+
+        // Number of narrowphase tests run by last Update. Mainly useful for profiling and testing
+        uint32_t GetNarrowphaseTestCount() const {
+            return mNarrowphaseTestCount;
+        }
+
+      private:
+        // Returns false if overflowed. Candidates are left sorted by (trigger, other)
+        bool GatherCandidatePairs(CoreContext& coreContext);
+        void ResolveCandidateOverlaps(CoreContext& coreContext);
+        // Returns false if overflowed. Compares prior cache against candidates to produce this frame's events
+        bool GenerateEvents();
+        void AddEvent(TriggerEventType type, const TriggerOverlapPair& pair, bool& didOverflow);
+
+        // Persistent state. Part of snapshots
+        TriggerPairCache mPairCache;
+
+        // Frame-local state. Not part of snapshots
+        TriggerEvents mFrameEvents;
+        uint32_t mNarrowphaseTestCount = 0;
+
+        // Scratch state purely derived from the registry each update
+        BoundingVolumeHierarchy mTriggerTree;
+        TriggerOverlapPair mCandidates[kMaxTriggerPairs];
+        uint32_t mCandidateCount = 0;
+    };
+}
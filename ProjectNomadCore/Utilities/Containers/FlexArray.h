@@ -76,6 +76,18 @@ namespace ProjectNomad {
             return mArray[index];
         }
 
+        ContentType& Get(uint32_t index) {
+            // Check index in bounds
+            if (index > MaxSize - 1) {
+                return mArray[0];
+            }
+            if (index >= mHeadIndex) {
+                return mArray[0];
+            }
+
+            return mArray[index];
+        }
+
         /**
         * Checks if array currently contains a given element
         * @param checkValue - Value to check for
@@ -92,6 +104,25 @@ namespace ProjectNomad {
             return false;
         }
 
+        // Iteration over active elements only. Also allows implicit conversion to std::span (eg, for span parameters)
+        ContentType* begin() {
+            return mArray;
+        }
+        ContentType* end() {
+            return mArray + mHeadIndex;
+        }
+        const ContentType* begin() const {
+            return mArray;
+        }
+        const ContentType* end() const {
+            return mArray + mHeadIndex;
+        }
+
+        // Resets size to 0. Prior elements are left in place as "noise", same as elements past the head at any time
+        void Clear() {
+            mHeadIndex = 0;
+        }
+
         /// <summary>
         /// Removes the element at the given index and moves last element to index.
         /// FUTURE: Supply iterator and erase functions. Consumer should not need to know to decrement index if looping and removing
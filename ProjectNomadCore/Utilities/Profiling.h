@@ -9,5 +9,7 @@ DECLARE_STATS_GROUP(TEXT("Gameplay Systems"), STATGROUP_Nomad_GSystems, STATCAT_
 #define MEASURE_SYSTEM_FUNCTION(TextName, StatName) DECLARE_SCOPE_CYCLE_COUNTER(TEXT(TextName), StatName, STATGROUP_Nomad_GSystems)
 
 #else
-MEASURE_FUNCTION(...)
+// No profiler outside of engine (eg, unit tests), so compile out entirely
+#define MEASURE_SYSTEM_FUNCTION(TextName, StatName)
+
 #endif
\ No newline at end of file
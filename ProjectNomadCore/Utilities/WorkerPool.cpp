@@ -0,0 +1,93 @@
+#include "WorkerPool.h"
+
+namespace ProjectNomad {
+    WorkerPool::WorkerPool(uint32_t workerThreadCount) {
+        mWorkerThreads.reserve(workerThreadCount);
+        for (uint32_t i = 0; i < workerThreadCount; i++) {
+            mWorkerThreads.emplace_back(&WorkerPool::RunWorkerThread, this);
+        }
+    }
+
+    WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard lock(mMutex);
+            mIsShuttingDown = true;
+        }
+        mWorkAvailableCondition.notify_all();
+
+        for (std::thread& workerThread : mWorkerThreads) {
+            workerThread.join();
+        }
+    }
+
+    void WorkerPool::ParallelFor(uint32_t taskCount, const Task& task) {
+        // No point in waking up workers if there's nothing to split up
+        if (mWorkerThreads.empty() || taskCount <= 1) {
+            for (uint32_t i = 0; i < taskCount; i++) {
+                task(i);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard lock(mMutex);
+            mCurrentTask = &task;
+            mCurrentTaskCount = taskCount;
+            mNextTaskIndex = 0;
+            mBatchGeneration++;
+        }
+        mWorkAvailableCondition.notify_all();
+
+        RunAvailableTasks(task, taskCount);
+
+        // All tasks have been claimed at this point, but workers may still be running theirs
+        std::unique_lock lock(mMutex);
+        mWorkDoneCondition.wait(lock, [this] { return mActiveWorkerCount == 0; });
+
+        // Workers which only wake up now must not pick up this (soon to be out of scope) task
+        mCurrentTask = nullptr;
+        mCurrentTaskCount = 0;
+    }
+
+    void WorkerPool::RunWorkerThread() {
+        uint64_t lastSeenGeneration = 0;
+
+        while (true) {
+            std::unique_lock lock(mMutex);
+            mWorkAvailableCondition.wait(lock, [this, lastSeenGeneration] {
+                return mIsShuttingDown || mBatchGeneration != lastSeenGeneration;
+            });
+            if (mIsShuttingDown) {
+                return;
+            }
+
+            lastSeenGeneration = mBatchGeneration;
+            const Task* task = mCurrentTask;
+            uint32_t taskCount = mCurrentTaskCount;
+            if (task == nullptr) {
+                continue; // Woke up after batch was already finished
+            }
+            mActiveWorkerCount++;
+            lock.unlock();
+
+            RunAvailableTasks(*task, taskCount);
+
+            lock.lock();
+            mActiveWorkerCount--;
+            if (mActiveWorkerCount == 0) {
+                mWorkDoneCondition.notify_all();
+            }
+        }
+    }
+
+    void WorkerPool::RunAvailableTasks(const Task& task, uint32_t taskCount) {
+        while (true) {
+            uint32_t taskIndex = mNextTaskIndex.fetch_add(1);
+            if (taskIndex >= taskCount) {
+                return;
+            }
+
+            task(taskIndex);
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ProjectNomad {
+    /// <summary>
+    /// Minimal fixed-size pool of worker threads for fork-join style parallelism within a single sim frame.
+    ///
+    /// There's intentionally no general task queue: ParallelFor runs a batch of independent tasks then blocks until
+    ///     all are done. Which thread runs which task is NOT deterministic, so tasks must only write to data owned by
+    ///     their own task index and callers must combine results in a fixed order afterwards.
+    /// The calling thread always participates, so a pool with 0 worker threads simply runs everything inline.
+    /// </summary>
+    class WorkerPool {
+      public:
+        using Task = std::function<void(uint32_t taskIndex)>;
+
+        explicit WorkerPool(uint32_t workerThreadCount);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        uint32_t GetWorkerThreadCount() const {
+            return static_cast<uint32_t>(mWorkerThreads.size());
+        }
+
+        /**
+        * Runs task once for every index in [0, taskCount), then returns once all have completed.
+        * Not re-entrant: Tasks must not call ParallelFor on the same pool.
+        **/
+        void ParallelFor(uint32_t taskCount, const Task& task);
+
+      private:
+        void RunWorkerThread();
+        void RunAvailableTasks(const Task& task, uint32_t taskCount);
+
+        std::vector<std::thread> mWorkerThreads;
+
+        std::mutex mMutex;
+        std::condition_variable mWorkAvailableCondition;
+        std::condition_variable mWorkDoneCondition;
+
+        // Current batch. Only modified under mutex while no worker is active
+        const Task* mCurrentTask = nullptr;
+        uint32_t mCurrentTaskCount = 0;
+        uint64_t mBatchGeneration = 0;
+        uint32_t mActiveWorkerCount = 0;
+        bool mIsShuttingDown = false;
+
+        std::atomic<uint32_t> mNextTaskIndex = 0;
+    };
+}
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <type_traits>
 #include "fixed.hpp"
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 #if WITH_ENGINE // Use following necessary includes if in Unreal context
 #include "CoreMinimal.h"
 #include "FixedPoint.generated.h"
@@ -11,6 +17,17 @@
 #include "Utilities/PlatformSupport/UnrealReplacements.h"
 #endif
 
+// Set to 1 to check arithmetic operators for raw overflow and division by zero, counting and recording each occurrence
+//      in ProjectNomad::FixedPointOverflowTracker. Meant for debug and test builds, as every operation pays for checks.
+//      Results are unchanged, other than division by zero giving 0 rather than crashing. Set to 0 to compile no checks
+#ifndef NOMAD_CHECKED_FIXED_POINT
+#define NOMAD_CHECKED_FIXED_POINT 0
+#endif
+
+#if NOMAD_CHECKED_FIXED_POINT
+#include "Math/FixedPointOverflowTracker.h"
+#endif
+
 /**
 * Port of fpm's fixed.hpp file to an Unreal-supported USTRUCT type.
 *
@@ -46,6 +63,7 @@ struct THENOMADGAME_API FFixedPoint {
     ;
     // JMN: Commenting out below static asset as using same intermediate and base type.
     //      Not the safest approach but will work... as long as *very* careful of constraints.
+    //      (Multiply and divide no longer rely on IntermediateType for overflow safety, see MultiplyRaw/DivideRaw)
     // static_assert(sizeof(IntermediateType) > sizeof(BaseType), "IntermediateType must be larger than BaseType");
     static_assert(std::is_signed<IntermediateType>::value == std::is_signed<BaseType>::value,
                   "IntermediateType must have same signedness as BaseType");
@@ -54,6 +72,190 @@ struct THENOMADGAME_API FFixedPoint {
     // is incorrect (flips from positive to negative), so we must extend the size to IntermediateType.
     static constexpr IntermediateType FRACTION_MULT = IntermediateType(1) << FractionBits;
 
+    // Multiplication and division below go through a full 128 bit intermediate whenever the 64 bit IntermediateType
+    //      could overflow, with results bit-identical to the original fpm formulas wherever those didn't overflow.
+    //      (Original multiply overflowed as soon as the raw product passed 2^63, eg squaring ~46,000)
+
+    // Signed 64 x 64 -> 128 bit product, split into high and low halves
+    static constexpr void MultiplyFull(BaseType x, BaseType y, int64& high, std::uint64_t& low) noexcept {
+#if defined(_MSC_VER) && defined(_M_X64)
+        if (!std::is_constant_evaluated()) {
+            low = static_cast<std::uint64_t>(_mul128(x, y, &high));
+            return;
+        }
+#endif
+        // Schoolbook multiply on 32 bit halves as unsigned, then correct high half for two's complement signs
+        std::uint64_t unsignedX = static_cast<std::uint64_t>(x);
+        std::uint64_t unsignedY = static_cast<std::uint64_t>(y);
+        std::uint64_t xLow = unsignedX & 0xFFFFFFFF;
+        std::uint64_t xHigh = unsignedX >> 32;
+        std::uint64_t yLow = unsignedY & 0xFFFFFFFF;
+        std::uint64_t yHigh = unsignedY >> 32;
+
+        std::uint64_t lowLow = xLow * yLow;
+        std::uint64_t highLow = xHigh * yLow;
+        std::uint64_t lowHigh = xLow * yHigh;
+        std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+
+        std::uint64_t unsignedHigh = xHigh * yHigh + (highLow >> 32) + (middle >> 32);
+        if (x < 0) {
+            unsignedHigh -= unsignedY;
+        }
+        if (y < 0) {
+            unsignedHigh -= unsignedX;
+        }
+
+        high = static_cast<int64>(unsignedHigh);
+        low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+    }
+
+    // Amount to add to a full product before arithmetic right shift by FractionBits. Rounding mode matches original
+    //      divide-then-add-remainder approach (ie, round half away from zero), and otherwise truncates towards zero
+    static constexpr std::uint64_t GetProductBias(bool isNegative) noexcept {
+        if (EnableRounding) {
+            return static_cast<std::uint64_t>(FRACTION_MULT / 2) - (isNegative ? 1 : 0);
+        }
+        return isNegative ? static_cast<std::uint64_t>(FRACTION_MULT - 1) : 0;
+    }
+
+    static constexpr BaseType MultiplyRaw(BaseType x, BaseType y) noexcept {
+#if defined(__SIZEOF_INT128__)
+        __int128 product = static_cast<__int128>(x) * y;
+        product += GetProductBias(product < 0);
+        return static_cast<BaseType>(product >> FractionBits);
+#else
+        int64 high = 0;
+        std::uint64_t low = 0;
+        MultiplyFull(x, y, high, low);
+
+        std::uint64_t bias = GetProductBias(high < 0);
+        low += bias;
+        high += low < bias ? 1 : 0; // Carry
+
+        return static_cast<BaseType>((low >> FractionBits) | (static_cast<std::uint64_t>(high) << (64 - FractionBits)));
+#endif
+    }
+
+    static constexpr BaseType DivideRaw(BaseType x, BaseType y) noexcept {
+        // One extra bit is needed for rounding, same as original implementation
+        constexpr unsigned int kShiftBits = EnableRounding ? FractionBits + 1 : FractionBits;
+        constexpr BaseType kMaxFastNumerator = std::numeric_limits<BaseType>::max() >> kShiftBits;
+
+        // Common case: numerator can be shifted up within 64 bits, so use original formula as-is
+        if (x <= kMaxFastNumerator && x >= -kMaxFastNumerator) {
+            auto value = (static_cast<IntermediateType>(x) << kShiftBits) / y;
+            if (EnableRounding) {
+                return static_cast<BaseType>((value / 2) + (value % 2));
+            }
+            return static_cast<BaseType>(value);
+        }
+
+        // Otherwise do the shifted part of the division bit by bit on magnitudes, as 128 bit division is either slow
+        //      or unavailable depending on compiler. Remainder is always below divisor, so doubling it never overflows
+        bool isNegative = (x < 0) != (y < 0);
+        std::uint64_t numeratorMagnitude = x < 0 ? 0 - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x);
+        std::uint64_t divisorMagnitude = y < 0 ? 0 - static_cast<std::uint64_t>(y) : static_cast<std::uint64_t>(y);
+
+        std::uint64_t quotient = numeratorMagnitude / divisorMagnitude;
+        std::uint64_t remainder = numeratorMagnitude % divisorMagnitude;
+        for (unsigned int i = 0; i < kShiftBits; i++) {
+            quotient <<= 1;
+            remainder <<= 1;
+            if (remainder >= divisorMagnitude) {
+                remainder -= divisorMagnitude;
+                quotient |= 1;
+            }
+        }
+        if (EnableRounding) {
+            quotient = (quotient + 1) >> 1; // Same as (value / 2) + (value % 2) on the magnitude
+        }
+
+        return isNegative ? -static_cast<BaseType>(quotient) : static_cast<BaseType>(quotient);
+    }
+
+#if NOMAD_CHECKED_FIXED_POINT
+    // Overflow checks for checked arithmetic mode. Each matches the corresponding operation's raw math exactly, so no
+    //      false positives for results that fit (eg, products which only fit thanks to the 128 bit intermediate)
+
+    static constexpr bool DoesAddOverflow(BaseType x, BaseType y) noexcept {
+        BaseType sum = WrappingAdd(x, y);
+        return ((x ^ sum) & (y ^ sum)) < 0; // Overflowed iff both operands have a different sign than result
+    }
+
+    static constexpr bool DoesSubtractOverflow(BaseType x, BaseType y) noexcept {
+        BaseType difference = WrappingSubtract(x, y);
+        return ((x ^ y) & (x ^ difference)) < 0; // Overflowed iff operand signs differ and result sign differs from x
+    }
+
+    // Plain integer product, as used by operators taking an integer and when scaling integers to fixed point
+    static constexpr bool DoesIntegerMultiplyOverflow(BaseType x, BaseType y) noexcept {
+#if defined(__SIZEOF_INT128__)
+        __int128 product = static_cast<__int128>(x) * y;
+        return product != static_cast<BaseType>(product);
+#else
+        int64 high = 0;
+        std::uint64_t low = 0;
+        MultiplyFull(x, y, high, low);
+        return high != (static_cast<BaseType>(low) >> 63); // High half must just be sign extension of low half
+#endif
+    }
+
+    static constexpr bool DoesMultiplyOverflow(BaseType x, BaseType y) noexcept {
+#if defined(__SIZEOF_INT128__)
+        __int128 product = static_cast<__int128>(x) * y;
+        product += GetProductBias(product < 0);
+        product >>= FractionBits;
+        return product != static_cast<BaseType>(product);
+#else
+        int64 high = 0;
+        std::uint64_t low = 0;
+        MultiplyFull(x, y, high, low);
+
+        std::uint64_t bias = GetProductBias(high < 0);
+        low += bias;
+        high += low < bias ? 1 : 0; // Carry
+
+        // Shifted result fits iff every bit from its sign bit upwards is the same
+        BaseType upperBits = high >> (FractionBits - 1);
+        return upperBits != 0 && upperBits != -1;
+#endif
+    }
+
+    // Assumes y is non-zero. Only DivideRaw's slow path can overflow, as fast path numerators are small enough
+    static constexpr bool DoesDivideOverflow(BaseType x, BaseType y) noexcept {
+        constexpr BaseType kMaxFastNumerator = std::numeric_limits<BaseType>::max() >> (FractionBits + 1);
+        if (x <= kMaxFastNumerator && x >= -kMaxFastNumerator) {
+            return false;
+        }
+
+        std::uint64_t numeratorMagnitude = x < 0 ? 0 - static_cast<std::uint64_t>(x) : static_cast<std::uint64_t>(x);
+        std::uint64_t divisorMagnitude = y < 0 ? 0 - static_cast<std::uint64_t>(y) : static_cast<std::uint64_t>(y);
+        // Result is integral quotient shifted up by FractionBits (plus fraction), which must stay below the sign bit
+        return (numeratorMagnitude / divisorMagnitude) >> (63 - FractionBits) != 0;
+    }
+
+    // Two's complement wraparound without signed overflow UB, matching what unchecked operators do in practice
+    static constexpr BaseType WrappingAdd(BaseType x, BaseType y) noexcept {
+        return static_cast<BaseType>(static_cast<std::uint64_t>(x) + static_cast<std::uint64_t>(y));
+    }
+
+    static constexpr BaseType WrappingSubtract(BaseType x, BaseType y) noexcept {
+        return static_cast<BaseType>(static_cast<std::uint64_t>(x) - static_cast<std::uint64_t>(y));
+    }
+
+    static constexpr BaseType WrappingMultiply(BaseType x, BaseType y) noexcept {
+        return static_cast<BaseType>(static_cast<std::uint64_t>(x) * static_cast<std::uint64_t>(y));
+    }
+
+    // Reporting is skipped in constant evaluation, as tracker only exists at runtime
+    static constexpr void ReportIfOverflowed(bool hasOverflowed, ProjectNomad::FixedPointOperation operation,
+                                             BaseType x, BaseType y) noexcept {
+        if (hasOverflowed && !std::is_constant_evaluated()) {
+            ProjectNomad::FixedPointOverflowTracker::Report(operation, x, y);
+        }
+    }
+#endif
+
     struct raw_construct_tag {};
 
     constexpr FFixedPoint(BaseType val, raw_construct_tag) noexcept : m_value(val) {}
@@ -146,68 +348,121 @@ struct THENOMADGAME_API FFixedPoint {
     //
 
     constexpr inline FFixedPoint operator-() const noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        ReportIfOverflowed(DoesSubtractOverflow(0, m_value), ProjectNomad::FixedPointOperation::Subtract, 0, m_value);
+        return FFixedPoint::from_raw_value(WrappingSubtract(0, m_value));
+#else
         return FFixedPoint::from_raw_value(-m_value);
+#endif
     }
 
     constexpr inline FFixedPoint& operator+=(const FFixedPoint& y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        ReportIfOverflowed(DoesAddOverflow(m_value, y.m_value), ProjectNomad::FixedPointOperation::Add,
+                           m_value, y.m_value);
+        m_value = WrappingAdd(m_value, y.m_value);
+#else
         m_value += y.m_value;
+#endif
         return *this;
     }
 
     template <typename I, typename std::enable_if<std::is_integral<I>::value>::type* = nullptr>
     constexpr inline FFixedPoint& operator+=(I y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        BaseType scaledY = WrappingMultiply(static_cast<BaseType>(y), FRACTION_MULT);
+        bool hasOverflowed = DoesIntegerMultiplyOverflow(static_cast<BaseType>(y), FRACTION_MULT)
+                             || DoesAddOverflow(m_value, scaledY);
+        ReportIfOverflowed(hasOverflowed, ProjectNomad::FixedPointOperation::Add, m_value, static_cast<BaseType>(y));
+        m_value = WrappingAdd(m_value, scaledY);
+#else
         m_value += y * FRACTION_MULT;
+#endif
         return *this;
     }
 
     constexpr inline FFixedPoint& operator-=(const FFixedPoint& y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        ReportIfOverflowed(DoesSubtractOverflow(m_value, y.m_value), ProjectNomad::FixedPointOperation::Subtract,
+                           m_value, y.m_value);
+        m_value = WrappingSubtract(m_value, y.m_value);
+#else
         m_value -= y.m_value;
+#endif
         return *this;
     }
 
     template <typename I, typename std::enable_if<std::is_integral<I>::value>::type* = nullptr>
     constexpr inline FFixedPoint& operator-=(I y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        BaseType scaledY = WrappingMultiply(static_cast<BaseType>(y), FRACTION_MULT);
+        bool hasOverflowed = DoesIntegerMultiplyOverflow(static_cast<BaseType>(y), FRACTION_MULT)
+                             || DoesSubtractOverflow(m_value, scaledY);
+        ReportIfOverflowed(hasOverflowed, ProjectNomad::FixedPointOperation::Subtract,
+                           m_value, static_cast<BaseType>(y));
+        m_value = WrappingSubtract(m_value, scaledY);
+#else
         m_value -= y * FRACTION_MULT;
+#endif
         return *this;
     }
 
     constexpr inline FFixedPoint& operator*=(const FFixedPoint& y) noexcept {
-        if (EnableRounding) {
-            // Normal fixed-point multiplication is: x * y / 2**FractionBits.
-            // To correctly round the last bit in the result, we need one more bit of information.
-            // We do this by multiplying by two before dividing and adding the LSB to the real result.
-            auto value = (static_cast<IntermediateType>(m_value) * y.m_value) / (FRACTION_MULT / 2);
-            m_value = static_cast<BaseType>((value / 2) + (value % 2));
-        } else {
-            auto value = (static_cast<IntermediateType>(m_value) * y.m_value) / FRACTION_MULT;
-            m_value = static_cast<BaseType>(value);
-        }
+#if NOMAD_CHECKED_FIXED_POINT
+        ReportIfOverflowed(DoesMultiplyOverflow(m_value, y.m_value), ProjectNomad::FixedPointOperation::Multiply,
+                           m_value, y.m_value);
+#endif
+        // Normal fixed-point multiplication is: x * y / 2**FractionBits. Done on the full 128 bit product with a
+        //      rounding bias and shift, rather than dividing a 64 bit product which may already have overflowed
+        m_value = MultiplyRaw(m_value, y.m_value);
         return *this;
     }
 
     template <typename I, typename std::enable_if<std::is_integral<I>::value>::type* = nullptr>
     constexpr inline FFixedPoint& operator*=(I y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        ReportIfOverflowed(DoesIntegerMultiplyOverflow(m_value, static_cast<BaseType>(y)),
+                           ProjectNomad::FixedPointOperation::Multiply, m_value, static_cast<BaseType>(y));
+        m_value = WrappingMultiply(m_value, static_cast<BaseType>(y));
+#else
         m_value *= y;
+#endif
         return *this;
     }
 
     constexpr inline FFixedPoint& operator/=(const FFixedPoint& y) noexcept {
         // assert(y.m_value != 0); // JMN: Commented out as no 
-        if (EnableRounding) {
-            // Normal fixed-point division is: x * 2**FractionBits / y.
-            // To correctly round the last bit in the result, we need one more bit of information.
-            // We do this by multiplying by two before dividing and adding the LSB to the real result.
-            auto value = (static_cast<IntermediateType>(m_value) * FRACTION_MULT * 2) / y.m_value;
-            m_value = static_cast<BaseType>((value / 2) + (value % 2));
-        } else {
-            auto value = (static_cast<IntermediateType>(m_value) * FRACTION_MULT) / y.m_value;
-            m_value = static_cast<BaseType>(value);
+#if NOMAD_CHECKED_FIXED_POINT
+        if (y.m_value == 0) {
+            ReportIfOverflowed(true, ProjectNomad::FixedPointOperation::DivideByZero, m_value, y.m_value);
+            m_value = 0;
+            return *this;
         }
+        ReportIfOverflowed(DoesDivideOverflow(m_value, y.m_value), ProjectNomad::FixedPointOperation::Divide,
+                           m_value, y.m_value);
+#endif
+        // Normal fixed-point division is: x * 2**FractionBits / y.
+        // To correctly round the last bit in the result, we need one more bit of information.
+        // We do this by multiplying by two before dividing and adding the LSB to the real result.
+        m_value = DivideRaw(m_value, y.m_value);
         return *this;
     }
 
     template <typename I, typename std::enable_if<std::is_integral<I>::value>::type* = nullptr>
     constexpr inline FFixedPoint& operator/=(I y) noexcept {
+#if NOMAD_CHECKED_FIXED_POINT
+        if (y == 0) {
+            ReportIfOverflowed(true, ProjectNomad::FixedPointOperation::DivideByZero, m_value, 0);
+            m_value = 0;
+            return *this;
+        }
+        if constexpr (std::is_signed<I>::value) {
+            if (m_value == std::numeric_limits<BaseType>::min() && y == -1) {
+                ReportIfOverflowed(true, ProjectNomad::FixedPointOperation::Divide, m_value, -1);
+                return *this; // Same as wrapping negation
+            }
+        }
+#endif
         m_value /= y;
         return *this;
     }
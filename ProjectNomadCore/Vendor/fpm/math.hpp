@@ -2,7 +2,9 @@
 #define FPM_MATH_HPP
 
 #include "fixed.hpp"
+#include <bit>
 #include <cmath>
+#include <type_traits>
 
 #ifdef _MSC_VER
 #include <intrin.h>
@@ -18,9 +20,13 @@ namespace detail
 {
 
 // Returns the index of the most-signifcant set bit
-inline long find_highest_bit(unsigned long long value) noexcept
+// JMN: Made constexpr (via std::bit_width during constant evaluation) so that sqrt and trig can run at compile time
+constexpr inline long find_highest_bit(unsigned long long value) noexcept
 {
     assert(value != 0);
+    if (std::is_constant_evaluated()) {
+        return static_cast<long>(std::bit_width(value)) - 1;
+    }
 #if defined(_MSC_VER)
     unsigned long index;
 #if defined(_WIN64)
@@ -122,7 +128,7 @@ constexpr inline bool isunordered(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noex
 // Nearest integer operations
 //
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> ceil(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> ceil(fixed<B, I, F, R> x) noexcept
 {
     constexpr auto FRAC = B(1) << F;
     auto value = x.raw_value();
@@ -131,7 +137,7 @@ inline fixed<B, I, F, R> ceil(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> floor(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> floor(fixed<B, I, F, R> x) noexcept
 {
     constexpr auto FRAC = B(1) << F;
     auto value = x.raw_value();
@@ -140,14 +146,14 @@ inline fixed<B, I, F, R> floor(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> trunc(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> trunc(fixed<B, I, F, R> x) noexcept
 {
     constexpr auto FRAC = B(1) << F;
     return fixed<B, I, F, R>::from_raw_value(x.raw_value() / FRAC * FRAC);
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> round(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> round(fixed<B, I, F, R> x) noexcept
 {
     constexpr auto FRAC = B(1) << F;
     auto value = x.raw_value() / (FRAC / 2);
@@ -458,7 +464,7 @@ fixed<B, I, F, R> cbrt(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
 
@@ -497,7 +503,7 @@ fixed<B, I, F, R> sqrt(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
+constexpr inline fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
 {
     assert(x != 0 || y != 0);
     return sqrt(x*x + y*y);
@@ -508,7 +514,7 @@ fixed<B, I, F, R> hypot(fixed<B, I, F, R> x, fixed<B, I, F, R> y) noexcept
 //
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
 {
     // This sine uses a fifth-order curve-fitting approximation originally
     // described by Jasper Vijn on coranac.com which has a worst-case
@@ -541,13 +547,13 @@ fixed<B, I, F, R> sin(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> cos(fixed<B, I, F, R> x) noexcept
 {
     return sin(fixed<B, I, F, R>::half_pi() + x);
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> tan(fixed<B, I, F, R> x) noexcept
 {
     auto cx = cos(x);
 
@@ -562,7 +568,7 @@ namespace detail {
 
 // Calculates atan(x) assuming that x is in the range [0,1]
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> atan_sanitized(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> atan_sanitized(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     assert(x >= Fixed(0) && x <= Fixed(1));
@@ -582,7 +588,7 @@ fixed<B, I, F, R> atan_sanitized(fixed<B, I, F, R> x) noexcept
 // anyway. We can shortcut that here and avoid the loss of information, thus
 // improving the accuracy of atan(y/x) for very small x.
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> atan_div(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> atan_div(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     assert(x != Fixed(0));
@@ -611,7 +617,7 @@ fixed<B, I, F, R> atan_div(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     if (x < Fixed(0))
@@ -628,7 +634,7 @@ fixed<B, I, F, R> atan(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     assert(x >= Fixed(-1) && x <= Fixed(+1));
@@ -642,7 +648,7 @@ fixed<B, I, F, R> asin(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     assert(x >= Fixed(-1) && x <= Fixed(+1));
@@ -656,7 +662,7 @@ fixed<B, I, F, R> acos(fixed<B, I, F, R> x) noexcept
 }
 
 template <typename B, typename I, unsigned int F, bool R>
-fixed<B, I, F, R> atan2(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
+constexpr inline fixed<B, I, F, R> atan2(fixed<B, I, F, R> y, fixed<B, I, F, R> x) noexcept
 {
     using Fixed = fixed<B, I, F, R>;
     if (x == Fixed(0))
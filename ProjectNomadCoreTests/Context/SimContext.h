@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Context/CoreContext.h"
+#include "Math/FixedPoint.h"
+
+// Normally provided by Unreal, which the game's SimContext pulls in
+#ifndef UNLIKELY
+#define UNLIKELY(x) (x)
+#endif
+
+namespace ProjectNomad {
+    // Just the gameplay constants which the Systems_Example physics systems read
+    struct GameplayConstants {
+        uint8_t maxCollisionResolutionsPerFrame = 4;
+        fp massRatioForDistributionDynamicCollisions = fp{4};
+    };
+
+    struct StaticGameplayData {
+        GameplayConstants gameplayConstants;
+    };
+
+    /// <summary>
+    /// Test stand-in for the game's SimContext (see CoreContext), so that the Systems_Example physics systems can be
+    ///     compiled and exercised within the test project
+    /// </summary>
+    struct SimContext : CoreContext {
+        StaticGameplayData staticGameplayData;
+
+        const StaticGameplayData& GetStaticGameplayData() const {
+            return staticGameplayData;
+        }
+
+        const GameplayConstants& GetGameplayConstants() const {
+            return staticGameplayData.gameplayConstants;
+        }
+    };
+}
@@ -0,0 +1,206 @@
+#include "pchNCT.h"
+
+#include <random>
+
+#include "Math/BatchMath.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace BatchMathTests {
+    constexpr BatchMathBackend kAllBackends[] = {
+        BatchMathBackend::Scalar, BatchMathBackend::Sse42, BatchMathBackend::Avx2
+    };
+
+    class BatchMathTests : public ::testing::Test {
+      protected:
+        // Odd count so that every SIMD backend also has to handle a tail
+        static constexpr uint32_t kCount = 37;
+
+        std::mt19937_64 generator{1234};
+        VectorBatch a;
+        VectorBatch b;
+        VectorBatch out;
+        std::vector<fpBaseType> rotationW, rotationX, rotationY, rotationZ;
+        BatchMathBackend originalBackend = BatchMath::GetBackend();
+
+        void SetUp() override {
+            a.Resize(kCount);
+            b.Resize(kCount);
+            out.Resize(kCount);
+            for (uint32_t i = 0; i < kCount; i++) {
+                a.Set(i, GetRandomVector());
+                b.Set(i, GetRandomVector());
+            }
+            a.Set(0, FVectorFP::Zero()); // Normalize special case
+
+            for (uint32_t i = 0; i < kCount; i++) {
+                FVectorFP axis = GetRandomVector().Normalized();
+                FQuatFP rotation = FQuatFP::fromDegrees(axis.IsZero() ? FVectorFP::Up() : axis, fp{i * 17});
+                rotationW.push_back(rotation.w.raw_value());
+                rotationX.push_back(rotation.v.x.raw_value());
+                rotationY.push_back(rotation.v.y.raw_value());
+                rotationZ.push_back(rotation.v.z.raw_value());
+            }
+        }
+
+        void TearDown() override {
+            BatchMath::SetBackend(originalBackend);
+        }
+
+        /**
+        * Mix of small fractional values and large values with bits set in upper 32 bits of raw value, which is where
+        *   SIMD multiply differs most from the scalar version. Kept small enough that dot products can't overflow.
+        **/
+        fpBaseType GetRandomRaw() {
+            fpBaseType range = generator() % 2 == 0 ? fpBaseType{1} << 20 : fpBaseType{1} << 36;
+            return static_cast<fpBaseType>(generator() % (2 * range)) - range;
+        }
+
+        FVectorFP GetRandomVector() {
+            return {fp::from_raw_value(GetRandomRaw()), fp::from_raw_value(GetRandomRaw()),
+                    fp::from_raw_value(GetRandomRaw())};
+        }
+
+        QuatBatchView GetRotations() const {
+            return {rotationW.data(), rotationX.data(), rotationY.data(), rotationZ.data(), kCount};
+        }
+    };
+
+    TEST_F(BatchMathTests, SetBackend_whenScalar_thenAlwaysSupported) {
+        EXPECT_TRUE(BatchMath::IsBackendSupported(BatchMathBackend::Scalar));
+        EXPECT_TRUE(BatchMath::SetBackend(BatchMathBackend::Scalar));
+        EXPECT_EQ(BatchMathBackend::Scalar, BatchMath::GetBackend());
+    }
+
+    TEST_F(BatchMathTests, AddSubtractAndScale_whenAnyBackend_thenBitIdenticalToOperators) {
+        fp scalar = fp::from_raw_value(-GetRandomRaw() | 1);
+
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            BatchMath::Add(a.View(), b.View(), out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i) + b.Get(i), out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+
+            BatchMath::Subtract(a.View(), b.View(), out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i) - b.Get(i), out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+
+            BatchMath::Scale(a.View(), scalar, out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i) * scalar, out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+        }
+    }
+
+    TEST_F(BatchMathTests, DotCrossAndLengthSquared_whenAnyBackend_thenBitIdenticalToOperators) {
+        std::vector<fpBaseType> results(kCount);
+
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            BatchMath::Dot(a.View(), b.View(), results.data());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i).Dot(b.Get(i)).raw_value(), results[i])
+                    << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+
+            BatchMath::Cross(a.View(), b.View(), out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i).Cross(b.Get(i)), out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+
+            BatchMath::LengthSquared(a.View(), results.data());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i).GetLengthSquared().raw_value(), results[i])
+                    << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+        }
+    }
+
+    TEST_F(BatchMathTests, Normalize_whenAnyBackend_thenBitIdenticalToOperatorsIncludingZeroVector) {
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            BatchMath::Normalize(a.View(), out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i).Normalized(), out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+            EXPECT_EQ(FVectorFP::Zero(), out.Get(0));
+        }
+    }
+
+    TEST_F(BatchMathTests, Rotate_whenAnyBackend_thenBitIdenticalToQuatOperator) {
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            BatchMath::Rotate(GetRotations(), a.View(), out.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                FQuatFP rotation(
+                    fp::from_raw_value(rotationW[i]),
+                    FVectorFP(fp::from_raw_value(rotationX[i]), fp::from_raw_value(rotationY[i]),
+                              fp::from_raw_value(rotationZ[i]))
+                );
+                EXPECT_EQ(rotation * a.Get(i), out.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+        }
+    }
+
+    TEST_F(BatchMathTests, Add_whenOutputAliasesInput_thenSameAsSeparateOutput) {
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            VectorBatch inPlace = a;
+            BatchMath::Add(inPlace.View(), b.View(), inPlace.MutableView());
+            for (uint32_t i = 0; i < kCount; i++) {
+                EXPECT_EQ(a.Get(i) + b.Get(i), inPlace.Get(i)) << "Backend " << static_cast<int>(backend) << ", " << i;
+            }
+        }
+    }
+
+    // Disabled as a benchmark. See BenchmarkHelpers for how to run
+    TEST_F(BatchMathTests, DISABLED_RotateBenchmarks) {
+        constexpr uint32_t batchCount = 1024;
+        std::vector<fpBaseType> w(batchCount), x(batchCount), y(batchCount), z(batchCount);
+        VectorBatch vectors, rotated;
+        vectors.Resize(batchCount);
+        rotated.Resize(batchCount);
+        for (uint32_t i = 0; i < batchCount; i++) {
+            FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), fp{i % 360});
+            w[i] = rotation.w.raw_value();
+            x[i] = rotation.v.x.raw_value();
+            y[i] = rotation.v.y.raw_value();
+            z[i] = rotation.v.z.raw_value();
+            vectors.Set(i, GetRandomVector());
+        }
+        QuatBatchView rotations = {w.data(), x.data(), y.data(), z.data(), batchCount};
+
+        for (BatchMathBackend backend : kAllBackends) {
+            if (!BatchMath::SetBackend(backend)) {
+                continue;
+            }
+
+            std::string name = "Rotate 1024 vectors, backend " + std::to_string(static_cast<int>(backend));
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name, 20000, [&](uint32_t) {
+                BatchMath::Rotate(rotations, vectors.View(), rotated.MutableView());
+                return rotated.MutableView().x[0];
+            });
+        }
+    }
+}
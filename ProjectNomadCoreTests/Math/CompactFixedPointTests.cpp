@@ -0,0 +1,140 @@
+#include "pchNCT.h"
+
+#include <random>
+
+#include "Input/CharacterInput.h"
+#include "Math/CompactFixedPoint.h"
+#include "Math/CompactQuatFP.h"
+#include "Math/FPMath.h"
+#include "Math/FQuatFP.h"
+
+using namespace ProjectNomad;
+
+namespace CompactFixedPointTests {
+    static_assert(sizeof(fpCompact32) == 4);
+    static_assert(sizeof(fpUnit16) == 2);
+    static_assert(sizeof(CompactQuatFP) == 16);
+    static_assert(fpCompact32(fp{1.5f}).ToFP() == fp{1.5f});
+
+    TEST(fpCompact32, whenRandomValuesInRange_thenRoundTripsExactly) {
+        std::mt19937_64 generator{42};
+        for (int i = 0; i < 10000; i++) {
+            fp value = fp::from_raw_value(static_cast<int32_t>(generator()));
+
+            EXPECT_EQ(value, fpCompact32(value).ToFP());
+        }
+    }
+
+    TEST(fpCompact32, whenAtLimits_thenRoundTripsExactly) {
+        EXPECT_EQ(fpCompact32::MinValue(), fpCompact32(fpCompact32::MinValue()).ToFP());
+        EXPECT_EQ(fpCompact32::MaxValue(), fpCompact32(fpCompact32::MaxValue()).ToFP());
+        EXPECT_EQ(fp{-32768}, fpCompact32::MinValue());
+    }
+
+    TEST(fpCompact32, whenAssignedFromFp_thenImplicitlyConvertsBack) {
+        fpCompact32 value;
+        value = fp{-12.25f};
+
+        fp result = value;
+        EXPECT_EQ(fp{-12.25f}, result);
+        EXPECT_EQ(fp{-24.5f}, value * fp{2});
+    }
+
+    TEST(fpUnit16, whenUnitRangeValue_thenWithinHalfStepOfOriginal) {
+        const fp kHalfStep = fp::from_raw_value(2); // 14 fraction bits means each step is 4 fp LSB
+        for (fpBaseType raw = -(fpBaseType{1} << 16); raw <= (fpBaseType{1} << 16); raw += 7) {
+            fp value = fp::from_raw_value(raw);
+            fp result = fpUnit16(value);
+
+            EXPECT_LE(FPMath::abs(value - result), kHalfStep);
+        }
+    }
+
+    TEST(fpUnit16, whenExactlyHalfStep_thenRoundsAwayFromZero) {
+        EXPECT_EQ(fp::from_raw_value(4), fpUnit16(fp::from_raw_value(2)).ToFP());
+        EXPECT_EQ(fp::from_raw_value(-4), fpUnit16(fp::from_raw_value(-2)).ToFP());
+        EXPECT_EQ(fp::from_raw_value(0), fpUnit16(fp::from_raw_value(1)).ToFP());
+    }
+
+    TEST(fpUnit16, whenCommonAxisValues_thenExact) {
+        for (fp value : {fp{-1}, fp{-0.5f}, fp{0}, fp{0.25f}, fp{1}}) {
+            EXPECT_EQ(value, fpUnit16(value).ToFP());
+        }
+    }
+
+    TEST(fpUnit16, whenSerializedAndDeserialized_thenSameValue) {
+        fpUnit16 value(fp{-0.75f});
+
+        fpUnit16 result;
+        result.Deserialize(value.Serialize());
+
+        EXPECT_EQ(value, result);
+    }
+
+    TEST(CompactQuatFP, whenConvertedBack_thenMatchesOriginalQuaternion) {
+        FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP(fp{1}, fp{2}, fp{-3}).Normalized(), fp{135});
+
+        CompactQuatFP compact(rotation);
+
+        EXPECT_EQ(rotation, compact.ToQuat());
+        EXPECT_EQ(rotation * FVectorFP::Forward(), static_cast<FQuatFP>(compact) * FVectorFP::Forward());
+    }
+
+    TEST(CompactQuatFP, whenSameRotation_thenSameCrc) {
+        FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), fp{30});
+        CompactQuatFP a(rotation);
+        CompactQuatFP b;
+        b = rotation;
+
+        uint32_t crcA = 0, crcB = 0;
+        a.CalculateCRC32(crcA);
+        b.CalculateCRC32(crcB);
+
+        EXPECT_EQ(a, b);
+        EXPECT_EQ(crcA, crcB);
+    }
+
+    TEST(CompactQuatFP, whenUsedLikeFQuatFP_thenSameResults) {
+        FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Right(), fp{-20}) * FQuatFP::fromDegrees(FVectorFP::Up(), fp{75});
+        FQuatFP other = FQuatFP::fromDegrees(FVectorFP::Forward(), fp{10});
+        CompactQuatFP compact(rotation);
+
+        EXPECT_EQ(rotation * FVectorFP::Forward(), compact * FVectorFP::Forward());
+        EXPECT_EQ(rotation * other, compact * other);
+        EXPECT_EQ(other * rotation, other * compact);
+        EXPECT_EQ(rotation.inverted(), compact.inverted());
+    }
+
+    TEST(CharacterInput, whenUsingGetters_thenReturnsStoredValuesAsFullPrecision) {
+        FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), fp{30});
+        CharacterInput input;
+        input.camRotation = rotation;
+        input.moveForward = fp{0.5f};
+        input.moveRight = fp{-1};
+
+        EXPECT_EQ(rotation, input.GetCamRotation());
+        EXPECT_EQ(fp{0.5f}, input.GetMoveForward());
+        EXPECT_EQ(fp{-1}, input.GetMoveRight());
+    }
+
+    TEST(CharacterInput, whenUsingCompactStorage_thenSmallerThanFullPrecisionFields) {
+        constexpr size_t kFullPrecisionSize = sizeof(FQuatFP) + 2 * sizeof(fp);
+        constexpr size_t kCompactSize = sizeof(CompactQuatFP) + 2 * sizeof(fpUnit16);
+
+        EXPECT_EQ(kFullPrecisionSize - kCompactSize, static_cast<size_t>(28));
+        EXPECT_LT(sizeof(CharacterInput), sizeof(FVectorFP) + kFullPrecisionSize + sizeof(CommandSetList));
+    }
+
+    TEST(CharacterInput, whenAxisDiffersBelowCompactPrecision_thenInputsEqual) {
+        CharacterInput inputA, inputB;
+        inputA.moveForward = fp{0.5f};
+        inputB.moveForward = fp{0.5f} + fp::from_raw_value(1);
+
+        uint32_t crcA = 0, crcB = 0;
+        inputA.CalculateCRC32(crcA);
+        inputB.CalculateCRC32(crcB);
+
+        EXPECT_EQ(inputA, inputB);
+        EXPECT_EQ(crcA, crcB);
+    }
+}
@@ -0,0 +1,156 @@
+#include "pchNCT.h"
+
+#include <random>
+#include <vector>
+
+#include "Math/FMatrix3FP.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+#include "Physics/Model/FCollider.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace FMatrix3FPTests {
+    class FMatrix3FPTests : public ::testing::Test {
+      protected:
+        // Matrix entries are rounded to fp, so error grows with input length (test inputs are at most ~20 units long).
+        //      fromDegrees also isn't quite unit length due to trig approximations, so basis vectors are a bit off too
+        const fp kTolerance = fp{0.002f};
+
+        std::mt19937_64 generator{42};
+
+        FVectorFP GetRandomVector(int64_t range) {
+            auto randomComponent = [&] {
+                return fp::from_raw_value(static_cast<fpBaseType>(generator() % (2 * range)) - range);
+            };
+            return {randomComponent(), randomComponent(), randomComponent()};
+        }
+
+        FQuatFP GetRandomRotation() {
+            FVectorFP axis = GetRandomVector(fpBaseType{1} << 16).Normalized();
+            return FQuatFP::fromDegrees(axis.IsZero() ? FVectorFP::Up() : axis, fp{static_cast<int>(generator() % 360)});
+        }
+    };
+
+    TEST_F(FMatrix3FPTests, FromQuat_whenIdentity_thenReturnsIdentityMatrix) {
+        EXPECT_EQ(FMatrix3FP::Identity(), FMatrix3FP::FromQuat(FQuatFP::identity()));
+    }
+
+    TEST_F(FMatrix3FPTests, FromQuat_whenQuarterTurnAroundUp_thenForwardBecomesRight) {
+        FMatrix3FP matrix = FMatrix3FP::FromQuat(FQuatFP::fromDegrees(FVectorFP::Up(), fp{90}));
+
+        TestHelpers::expectNear(FVectorFP::Right(), matrix * FVectorFP::Forward(), kTolerance);
+        TestHelpers::expectNear(FVectorFP::Backward(), matrix * FVectorFP::Right(), kTolerance);
+        TestHelpers::expectNear(FVectorFP::Up(), matrix * FVectorFP::Up(), kTolerance);
+    }
+
+    TEST_F(FMatrix3FPTests, MultiplyVector_whenRandomRotations_thenMatchesQuaternionRotation) {
+        for (int i = 0; i < 1000; i++) {
+            FQuatFP rotation = GetRandomRotation();
+            FVectorFP value = GetRandomVector(fpBaseType{10} << 16);
+
+            TestHelpers::expectNear(rotation * value, FMatrix3FP::FromQuat(rotation) * value, kTolerance);
+        }
+    }
+
+    TEST_F(FMatrix3FPTests, Transposed_whenRoundTripped_thenMatchesQuaternionRoundTrip) {
+        // Round trip isn't exact even for quaternions, as fromDegrees results are slightly off unit length
+        for (int i = 0; i < 100; i++) {
+            FQuatFP rotation = GetRandomRotation();
+            FMatrix3FP matrix = FMatrix3FP::FromQuat(rotation);
+            FVectorFP value = GetRandomVector(fpBaseType{10} << 16);
+
+            TestHelpers::expectNear(rotation.inverted() * (rotation * value), matrix.Transposed() * (matrix * value),
+                                    kTolerance);
+        }
+    }
+
+    TEST_F(FMatrix3FPTests, Transposed_whenCompared_thenMatchesInverseQuaternion) {
+        FQuatFP rotation = GetRandomRotation();
+        FVectorFP value = GetRandomVector(fpBaseType{10} << 16);
+
+        TestHelpers::expectNear(rotation.inverted() * value, FMatrix3FP::FromQuat(rotation).Transposed() * value,
+                                kTolerance);
+    }
+
+    TEST_F(FMatrix3FPTests, MultiplyMatrix_whenCombined_thenMatchesApplyingEachRotationInTurn) {
+        for (int i = 0; i < 100; i++) {
+            FQuatFP first = GetRandomRotation();
+            FQuatFP second = GetRandomRotation();
+            FVectorFP value = GetRandomVector(fpBaseType{10} << 16);
+
+            FMatrix3FP combined = FMatrix3FP::FromQuat(second) * FMatrix3FP::FromQuat(first);
+            TestHelpers::expectNear(second * (first * value), combined * value, kTolerance);
+        }
+    }
+
+    TEST_F(FMatrix3FPTests, TransformPoints_whenTranslated_thenMatchesSinglePointTransform) {
+        FMatrix3FP matrix = FMatrix3FP::FromQuat(GetRandomRotation());
+        FVectorFP translation(fp{10}, fp{-5}, fp{2});
+
+        std::vector<FVectorFP> points;
+        for (int i = 0; i < 17; i++) {
+            points.push_back(GetRandomVector(fpBaseType{10} << 16));
+        }
+        std::vector<FVectorFP> results(points.size());
+        matrix.TransformPoints(points, results, translation);
+
+        for (size_t i = 0; i < points.size(); i++) {
+            EXPECT_EQ(matrix * points[i] + translation, results[i]);
+        }
+    }
+
+    TEST_F(FMatrix3FPTests, TransformPoints_whenInPlace_thenTransformsEveryPoint) {
+        FMatrix3FP matrix = FMatrix3FP::FromQuat(FQuatFP::fromDegrees(FVectorFP::Up(), fp{90}));
+        FVectorFP points[2] = {FVectorFP::Forward(), FVectorFP::Right()};
+
+        matrix.TransformPoints(points, points);
+
+        TestHelpers::expectNear(FVectorFP::Right(), points[0], kTolerance);
+        TestHelpers::expectNear(FVectorFP::Backward(), points[1], kTolerance);
+    }
+
+    TEST_F(FMatrix3FPTests, BoxVertices_whenRotatedBox_thenMatchesQuaternionRotatedCorners) {
+        FQuatFP rotation = GetRandomRotation();
+        FVectorFP center(fp{3}, fp{-2}, fp{7});
+        FVectorFP halfSize(fp{1}, fp{2}, fp{3});
+        FCollider box;
+        box.SetBox(center, rotation, halfSize);
+
+        BoxVertices vertices = box.GetBoxVerticesInWorldCoordinates();
+
+        ASSERT_EQ(8, vertices.GetSize());
+        TestHelpers::expectNear(center + rotation * -halfSize, vertices.Get(0), kTolerance);
+        TestHelpers::expectNear(center + rotation * halfSize, vertices.Get(1), kTolerance);
+        TestHelpers::expectNear(center + rotation * FVectorFP(halfSize.x, -halfSize.y, halfSize.z), vertices.Get(7),
+                                kTolerance);
+    }
+
+    TEST_F(FMatrix3FPTests, DISABLED_Benchmark_BoxVertices_QuaternionVsMatrix) {
+        constexpr uint32_t kCallCount = 2000000;
+        FQuatFP rotation = GetRandomRotation();
+        FVectorFP corners[8];
+        for (FVectorFP& corner : corners) {
+            corner = GetRandomVector(fpBaseType{4} << 16);
+        }
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Quaternion rotation of 8 points", kCallCount, [&](uint32_t i) {
+            FVectorFP sum;
+            for (const FVectorFP& corner : corners) {
+                sum += rotation * (corner + FVectorFP(fp::from_raw_value(i)));
+            }
+            return sum.x.raw_value();
+        });
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Matrix conversion + rotation of 8 points", kCallCount, [&](uint32_t i) {
+            FMatrix3FP matrix = FMatrix3FP::FromQuat(rotation);
+            FVectorFP sum;
+            for (const FVectorFP& corner : corners) {
+                sum += matrix * (corner + FVectorFP(fp::from_raw_value(i)));
+            }
+            return sum.x.raw_value();
+        });
+    }
+}
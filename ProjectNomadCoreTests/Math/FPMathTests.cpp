@@ -1,6 +1,9 @@
 #include "pchNCT.h"
 #include "Math/FixedPoint.h"
 #include "Math/FPMath.h"
+#include "Math/FPMath2.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
 
 using namespace ProjectNomad;
 
@@ -522,4 +525,28 @@ namespace FPMathTests {
         EXPECT_FALSE(FPMath::isNear(fp{1}, fp{1.1f}, fp{0}));
         EXPECT_FALSE(FPMath::isNear(fp{-5}, fp{1}, fp{5.9f}));
     }
+
+    // Compile time results must be bit-identical to runtime results, otherwise constants would desync from live math
+    constexpr fp kConstexprSqrt = FPMath::sqrt(fp{2});
+    constexpr fp kConstexprSin = FPMath::sinD(fp{30});
+    constexpr fp kConstexprCos = FPMath::cosR(fp{1.5f});
+    constexpr fp kConstexprAtan = FPMath::atanD(fp{1}, fp{-1});
+    constexpr FVectorFP kConstexprNormalized = FVectorFP(fp{3}, fp{-4}, fp{12}).Normalized();
+    constexpr FQuatFP kConstexprRotation = FQuatFP::fromDegrees(FVectorFP::Up(), fp{90});
+    constexpr FQuatFP kConstexprYaw = FPMath2::HorizontalDirVectorToYawOnlyQuat(FVectorFP::Left());
+    static_assert(kConstexprSqrt > fp{1.414f} && kConstexprSqrt < fp{1.415f});
+    static_assert(FPMath::sqrt(fp{9}) == fp{3});
+
+    TEST(constexprMath, whenEvaluatedAtCompileTime_thenMatchesRuntimeResults) {
+        // Volatile so that the runtime side can't be constant folded
+        volatile float two = 2.f, thirty = 30.f, oneAndHalf = 1.5f, one = 1.f, ninety = 90.f;
+
+        EXPECT_EQ(kConstexprSqrt, FPMath::sqrt(fp{two}));
+        EXPECT_EQ(kConstexprSin, FPMath::sinD(fp{thirty}));
+        EXPECT_EQ(kConstexprCos, FPMath::cosR(fp{oneAndHalf}));
+        EXPECT_EQ(kConstexprAtan, FPMath::atanD(fp{one}, -fp{one}));
+        EXPECT_EQ(kConstexprNormalized, FVectorFP(fp{3}, -fp{4} * fp{one}, fp{12}).Normalized());
+        EXPECT_EQ(kConstexprRotation, FQuatFP::fromDegrees(FVectorFP::Up(), fp{ninety}));
+        EXPECT_EQ(kConstexprYaw, FPMath2::HorizontalDirVectorToYawOnlyQuat(FVectorFP(fp{0}, -fp{one}, fp{0})));
+    }
 }
@@ -0,0 +1,162 @@
+#include "pchNCT.h"
+
+#include <cmath>
+#include <random>
+
+#include "Math/FPMath.h"
+#include "Math/FPRsqrt.h"
+#include "Math/FVectorFP.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace FPRsqrtTests {
+    double toRaw(double value) {
+        return value * 65536.0;
+    }
+
+    // Random vectors spanning tiny to level-sized lengths, as short vectors are where normalization loses the most
+    std::vector<FVectorFP> createTestVectors(uint32_t count) {
+        std::mt19937_64 generator(7);
+        std::vector<fpBaseType> scales = {fpBaseType{1} << 6, fpBaseType{1} << 12, fpBaseType{1} << 20, fpBaseType{1} << 30};
+
+        std::vector<FVectorFP> result;
+        for (uint32_t i = 0; i < count; i++) {
+            fpBaseType scale = scales[i % scales.size()];
+            auto randomComponent = [&] {
+                return fp::from_raw_value(static_cast<fpBaseType>(generator() % (2 * scale)) - scale);
+            };
+            FVectorFP vector(randomComponent(), randomComponent(), randomComponent());
+            if (!vector.IsZero()) {
+                result.push_back(vector);
+            }
+        }
+        return result;
+    }
+
+    double maxComponentErrorLsb(const FVectorFP& vector, const FVectorFP& normalized) {
+        double x = static_cast<double>(vector.x.raw_value());
+        double y = static_cast<double>(vector.y.raw_value());
+        double z = static_cast<double>(vector.z.raw_value());
+        double length = std::sqrt(x * x + y * y + z * z);
+
+        return std::max({
+            std::abs(normalized.x.raw_value() - toRaw(x / length)),
+            std::abs(normalized.y.raw_value() - toRaw(y / length)),
+            std::abs(normalized.z.raw_value() - toRaw(z / length))
+        });
+    }
+
+    TEST(FPRsqrt, Calculate_whenRandomValues_thenRelativeErrorBelowDocumentedBound) {
+        std::mt19937_64 generator(3);
+        double maxRelativeError = 0;
+        for (int i = 0; i < 1000000; i++) {
+            uint64_t value = generator() >> (generator() % 64);
+            if (value == 0) {
+                continue;
+            }
+
+            FPRsqrt::Result result = FPRsqrt::Calculate(value);
+            long double actual = static_cast<long double>(result.mantissa) / std::ldexp(1.0L, result.shift);
+            long double expected = 1.0L / std::sqrt(static_cast<long double>(value));
+            maxRelativeError = std::max(maxRelativeError, static_cast<double>(std::abs(actual / expected - 1)));
+        }
+
+        EXPECT_LT(maxRelativeError, std::ldexp(1.0, -28));
+    }
+
+    TEST(FPRsqrt, Sqrt_whenPerfectSquares_thenExact) {
+        EXPECT_EQ(0, FPRsqrt::Sqrt(0));
+        EXPECT_EQ(1, FPRsqrt::Sqrt(1));
+        EXPECT_EQ(1024, FPRsqrt::Sqrt(1 << 20));
+        EXPECT_EQ(12345, FPRsqrt::Sqrt(12345 * 12345));
+        EXPECT_EQ(uint64_t{3037000499}, FPRsqrt::Sqrt(uint64_t{3037000499} * 3037000499));
+    }
+
+    TEST(FPMath, rsqrt_whenVariousValues_thenWithinOneLsb) {
+        for (float value : {0.01f, 0.25f, 1.f, 2.f, 3.f, 100.f, 12345.f, 1000000.f}) {
+            fp actual = FPMath::rsqrt(fp{value});
+            double expected = 1.0 / std::sqrt(static_cast<double>(fp{value}));
+            EXPECT_LE(std::abs(actual.raw_value() - toRaw(expected)), 1.0) << value;
+        }
+        EXPECT_EQ(fp{1}, FPMath::rsqrt(fp{1}));
+        EXPECT_EQ(fp{0.5f}, FPMath::rsqrt(fp{4}));
+    }
+
+    TEST(FVectorFP, NormalizedFast_whenZero_thenZero) {
+        EXPECT_EQ(FVectorFP::Zero(), FVectorFP::Zero().NormalizedFast());
+
+        FVectorFP zero = FVectorFP::Zero();
+        EXPECT_EQ(fp{0}, zero.NormalizeAndGetLength());
+        EXPECT_EQ(FVectorFP::Zero(), zero);
+    }
+
+    TEST(FVectorFP, NormalizedFast_whenAxisAligned_thenExactUnitVector) {
+        EXPECT_EQ(FVectorFP::Forward(), FVectorFP(fp{123.5f}, fp{0}, fp{0}).NormalizedFast());
+        EXPECT_EQ(FVectorFP::Down(), FVectorFP(fp{0}, fp{0}, fp{-0.001f}).NormalizedFast());
+        EXPECT_EQ(FVectorFP::Left(), FVectorFP(fp{0}, fp{-30000}, fp{0}).NormalizedFast());
+    }
+
+    TEST(FVectorFP, NormalizeAndGetLength_whenVector_thenReturnsLengthAndNormalizes) {
+        FVectorFP vector(fp{3}, fp{-4}, fp{12});
+        fp length = vector.NormalizeAndGetLength();
+
+        EXPECT_EQ(fp{13}, length);
+        EXPECT_EQ(FVectorFP(fp{3}, fp{-4}, fp{12}).NormalizedFast(), vector);
+    }
+
+    TEST(FVectorFP, SafeNormalize_whenTooShort_thenReturnsFalseAndLeavesVectorAsIs) {
+        FVectorFP tiny(fp{0.001f}, fp{0}, fp{0.001f});
+        EXPECT_FALSE(tiny.SafeNormalize());
+        EXPECT_EQ(FVectorFP(fp{0.001f}, fp{0}, fp{0.001f}), tiny);
+
+        FVectorFP vector(fp{0}, fp{2}, fp{0});
+        EXPECT_TRUE(vector.SafeNormalize());
+        EXPECT_EQ(FVectorFP::Right(), vector);
+    }
+
+    // NormalizedFast accuracy versus existing Normalized, both measured against exact normalization.
+    //      See MathBenchmarks' accuracy report for the actual numbers
+    TEST(FVectorFP, NormalizedFast_whenRandomVectors_thenAtLeastAsAccurateAsNormalized) {
+        double maxFastError = 0;
+        double maxExistingError = 0;
+        double maxLengthRelativeError = 0;
+        for (const FVectorFP& vector : createTestVectors(100000)) {
+            maxFastError = std::max(maxFastError, maxComponentErrorLsb(vector, vector.NormalizedFast()));
+            maxExistingError = std::max(maxExistingError, maxComponentErrorLsb(vector, vector.Normalized()));
+
+            FVectorFP copy = vector;
+            double length = static_cast<double>(copy.NormalizeAndGetLength().raw_value());
+            double x = static_cast<double>(vector.x.raw_value());
+            double y = static_cast<double>(vector.y.raw_value());
+            double z = static_cast<double>(vector.z.raw_value());
+            double expectedLength = std::sqrt(x * x + y * y + z * z);
+            maxLengthRelativeError = std::max(maxLengthRelativeError, std::abs(length - expectedLength) / std::max(expectedLength, 65536.0));
+        }
+
+        EXPECT_LE(maxFastError, 0.6);
+        EXPECT_LE(maxFastError, maxExistingError);
+        EXPECT_LT(maxLengthRelativeError, 0.0001);
+    }
+
+    // Disabled as a benchmark. See BenchmarkHelpers for how to run
+    TEST(FPRsqrtBenchmarks, DISABLED_NormalizeVersusNormalizedFast) {
+        std::vector<FVectorFP> vectors = createTestVectors(4096);
+        const uint32_t mask = 4095;
+        vectors.resize(mask + 1, FVectorFP::Forward());
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Normalized", 10000000, [&](uint32_t i) {
+            return vectors[i & mask].Normalized().x.raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("NormalizedFast", 10000000, [&](uint32_t i) {
+            return vectors[i & mask].NormalizedFast().x.raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("FPMath::sqrt", 10000000, [&](uint32_t i) {
+            return FPMath::sqrt(FPMath::abs(vectors[i & mask].x) + fp{1}).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("FPMath::rsqrt", 10000000, [&](uint32_t i) {
+            return FPMath::rsqrt(FPMath::abs(vectors[i & mask].x) + fp{1}).raw_value();
+        });
+    }
+}
@@ -0,0 +1,122 @@
+#include "pchNCT.h"
+
+#include <cmath>
+
+#include "Math/FPMath.h"
+#include "Math/FPTrigLookup.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace FPTrigLookupTests {
+    // Documented accuracy of FPTrigLookup, in units of fp's smallest step (2^-16)
+    constexpr double kMaxErrorLsb = 0.6;
+
+    double toRaw(double value) {
+        return value * 65536.0;
+    }
+
+    double errorLsb(fp actual, double expected) {
+        return std::abs(static_cast<double>(actual.raw_value()) - toRaw(expected));
+    }
+
+    // Tables and lookups are usable at compile time
+    static_assert(FPTrigLookup::sin(fp{0}) == fp{0});
+    static_assert(FPTrigLookup::cos(fp{0}) == fp{1});
+
+    TEST(FPTrigLookup, sinAndCos_whenEveryRawValueWithinSeveralTurns_thenWithinDocumentedAccuracy) {
+        constexpr int64_t range = 4 * 411775; // ~4 full turns in either direction
+        double maxSinError = 0;
+        double maxCosError = 0;
+        for (int64_t raw = -range; raw <= range; raw++) {
+            double radians = static_cast<double>(raw) / 65536.0;
+            maxSinError = std::max(maxSinError, errorLsb(FPTrigLookup::sin(fp::from_raw_value(raw)), std::sin(radians)));
+            maxCosError = std::max(maxCosError, errorLsb(FPTrigLookup::cos(fp::from_raw_value(raw)), std::cos(radians)));
+        }
+
+        EXPECT_LE(maxSinError, kMaxErrorLsb);
+        EXPECT_LE(maxCosError, kMaxErrorLsb);
+    }
+
+    TEST(FPTrigLookup, sin_whenLargeAngle_thenStillAccurate) {
+        // No modulo by an approximate 2pi, so error doesn't grow with number of turns
+        for (int64_t raw : {int64_t{1} << 30, -(int64_t{1} << 30) - 12345, int64_t{987654321}}) {
+            double radians = static_cast<double>(raw) / 65536.0;
+            EXPECT_LE(errorLsb(FPTrigLookup::sin(fp::from_raw_value(raw)), std::sin(radians)), 1.0) << raw;
+        }
+    }
+
+    TEST(FPTrigLookup, asinAndAcos_whenEveryRawValueInDomain_thenWithinDocumentedAccuracy) {
+        double maxAsinError = 0;
+        double maxAcosError = 0;
+        for (int64_t raw = -65536; raw <= 65536; raw++) {
+            double value = static_cast<double>(raw) / 65536.0;
+            maxAsinError = std::max(maxAsinError, errorLsb(FPTrigLookup::asin(fp::from_raw_value(raw)), std::asin(value)));
+            maxAcosError = std::max(maxAcosError, errorLsb(FPTrigLookup::acos(fp::from_raw_value(raw)), std::acos(value)));
+        }
+
+        EXPECT_LE(maxAsinError, kMaxErrorLsb);
+        EXPECT_LE(maxAcosError, kMaxErrorLsb);
+    }
+
+    TEST(FPTrigLookup, asinAndAcos_whenEndpoints_thenExactConstants) {
+        EXPECT_EQ(fp::half_pi(), FPTrigLookup::asin(fp{1}));
+        EXPECT_EQ(-fp::half_pi(), FPTrigLookup::asin(fp{-1}));
+        EXPECT_EQ(fp{0}, FPTrigLookup::acos(fp{1}));
+        EXPECT_EQ(fp::pi(), FPTrigLookup::acos(fp{-1}));
+    }
+
+    TEST(FPTrigLookup, atan2_whenAnglesAroundCircleAtVariousRadii_thenWithinDocumentedAccuracy) {
+        double maxError = 0;
+        for (int step = 0; step < 100000; step++) {
+            double angle = step * 2 * std::acos(-1.0) / 100000 - std::acos(-1.0);
+            for (double radius : {0.01, 1.0, 37.0, 20000.0}) {
+                int64_t x = std::llround(toRaw(std::cos(angle) * radius));
+                int64_t y = std::llround(toRaw(std::sin(angle) * radius));
+                if (x == 0 && y == 0) {
+                    continue;
+                }
+
+                double expected = std::atan2(static_cast<double>(y), static_cast<double>(x));
+                fp actual = FPTrigLookup::atan2(fp::from_raw_value(y), fp::from_raw_value(x));
+                maxError = std::max(maxError, errorLsb(actual, expected));
+            }
+        }
+
+        EXPECT_LE(maxError, kMaxErrorLsb);
+    }
+
+    TEST(FPTrigLookup, atan2_whenOnAxes_thenMatchesFpmConventions) {
+        EXPECT_EQ(fp{0}, FPTrigLookup::atan2(fp{0}, fp{5}));
+        EXPECT_EQ(fp::pi(), FPTrigLookup::atan2(fp{0}, fp{-5}));
+        EXPECT_EQ(fp::half_pi(), FPTrigLookup::atan2(fp{5}, fp{0}));
+        EXPECT_EQ(-fp::half_pi(), FPTrigLookup::atan2(fp{-5}, fp{0}));
+    }
+
+    // Disabled as a benchmark. See BenchmarkHelpers for how to run
+    TEST(FPTrigLookupBenchmarks, DISABLED_LookupVersusFpm) {
+        const int64_t mask = (1 << 16) - 1;
+        auto angle = [&](uint32_t i) { return fp::from_raw_value((static_cast<int64_t>(i) * 7919) & ((1 << 19) - 1)); };
+        auto unit = [&](uint32_t i) { return fp::from_raw_value(((static_cast<int64_t>(i) * 7919) & mask) * 2 - mask); };
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("fpm sin", 10000000, [&](uint32_t i) {
+            return fp::FromLibraryType(fpm::sin(angle(i).ToLibraryType())).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Lookup sin", 10000000, [&](uint32_t i) {
+            return FPTrigLookup::sin(angle(i)).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("fpm asin", 10000000, [&](uint32_t i) {
+            return fp::FromLibraryType(fpm::asin(unit(i).ToLibraryType())).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Lookup asin", 10000000, [&](uint32_t i) {
+            return FPTrigLookup::asin(unit(i)).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("fpm atan2", 10000000, [&](uint32_t i) {
+            return fp::FromLibraryType(fpm::atan2(unit(i).ToLibraryType(), angle(i + 1).ToLibraryType())).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Lookup atan2", 10000000, [&](uint32_t i) {
+            return FPTrigLookup::atan2(unit(i), angle(i + 1)).raw_value();
+        });
+    }
+}
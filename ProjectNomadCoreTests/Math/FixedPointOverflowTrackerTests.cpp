@@ -0,0 +1,189 @@
+#include "pchNCT.h"
+
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "Math/FixedPoint.h"
+#include "Math/FixedPointOverflowTracker.h"
+
+using namespace ProjectNomad;
+
+namespace FixedPointOverflowTrackerTests {
+    class FixedPointOverflowTrackerTests : public ::testing::Test {
+      protected:
+        void SetUp() override {
+            FixedPointOverflowTracker::Reset();
+        }
+
+        void TearDown() override {
+            FixedPointOverflowTracker::Reset();
+        }
+    };
+
+    TEST_F(FixedPointOverflowTrackerTests, whenReported_thenCountedAndRecordedWithCallStack) {
+        FixedPointOverflowTracker::Report(FixedPointOperation::Multiply, 123, -456);
+
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Multiply));
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Add));
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetTotalCount());
+        ASSERT_EQ(1u, FixedPointOverflowTracker::GetRecordedCount());
+
+        FixedPointOverflowRecord record;
+        ASSERT_TRUE(FixedPointOverflowTracker::TryGetRecord(0, record));
+        EXPECT_EQ(FixedPointOperation::Multiply, record.operation);
+        EXPECT_EQ(123, record.lhsRaw);
+        EXPECT_EQ(-456, record.rhsRaw);
+        EXPECT_GT(record.callStackDepth, 0u);
+        EXPECT_NE(nullptr, record.callStack[0]);
+        EXPECT_FALSE(FixedPointOverflowTracker::TryGetRecord(1, record));
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, whenMoreReportsThanBufferSize_thenAllCountedButOnlyFirstRecorded) {
+        constexpr uint32_t kReportCount = FixedPointOverflowTracker::kMaxRecordedOverflows + 10;
+        for (uint32_t i = 0; i < kReportCount; i++) {
+            FixedPointOverflowTracker::Report(FixedPointOperation::Add, i, 0);
+        }
+
+        EXPECT_EQ(kReportCount, FixedPointOverflowTracker::GetCount(FixedPointOperation::Add));
+        ASSERT_EQ(FixedPointOverflowTracker::kMaxRecordedOverflows, FixedPointOverflowTracker::GetRecordedCount());
+
+        FixedPointOverflowRecord record;
+        constexpr uint32_t kLastIndex = FixedPointOverflowTracker::kMaxRecordedOverflows - 1;
+        ASSERT_TRUE(FixedPointOverflowTracker::TryGetRecord(kLastIndex, record));
+        EXPECT_EQ(kLastIndex, record.lhsRaw);
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, whenReportedFromManyThreads_thenNoReportsLost) {
+        constexpr uint32_t kThreadCount = 4;
+        constexpr uint32_t kReportsPerThread = 1000;
+
+        std::vector<std::thread> threads;
+        for (uint32_t threadIndex = 0; threadIndex < kThreadCount; threadIndex++) {
+            threads.emplace_back([threadIndex] {
+                for (uint32_t i = 0; i < kReportsPerThread; i++) {
+                    FixedPointOverflowTracker::Report(FixedPointOperation::Divide, threadIndex, i);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        EXPECT_EQ(kThreadCount * kReportsPerThread, FixedPointOverflowTracker::GetCount(FixedPointOperation::Divide));
+        ASSERT_EQ(FixedPointOverflowTracker::kMaxRecordedOverflows, FixedPointOverflowTracker::GetRecordedCount());
+        FixedPointOverflowRecord record;
+        for (uint32_t i = 0; i < FixedPointOverflowTracker::kMaxRecordedOverflows; i++) {
+            ASSERT_TRUE(FixedPointOverflowTracker::TryGetRecord(i, record));
+            EXPECT_EQ(FixedPointOperation::Divide, record.operation);
+            EXPECT_LT(record.lhsRaw, static_cast<int64_t>(kThreadCount));
+        }
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, whenReset_thenNothingCountedOrRecorded) {
+        FixedPointOverflowTracker::Report(FixedPointOperation::Subtract, 1, 2);
+        FixedPointOverflowTracker::Reset();
+
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetTotalCount());
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetRecordedCount());
+    }
+
+#if NOMAD_CHECKED_FIXED_POINT
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenAddOrSubtractPastLimits_thenReportedAndWraps) {
+        fp max = fp::from_raw_value(std::numeric_limits<fpBaseType>::max());
+        fp min = fp::from_raw_value(std::numeric_limits<fpBaseType>::min());
+        fp epsilon = fp::from_raw_value(1);
+
+        EXPECT_EQ(min, max + epsilon);
+        EXPECT_EQ(max, min - epsilon);
+        EXPECT_EQ(min, -min);
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Add));
+        EXPECT_EQ(2u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Subtract));
+
+        fp nearMax = max - fp{1};
+        nearMax += 2;
+        EXPECT_EQ(2u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Add));
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenMultiplyResultTooLarge_thenReported) {
+        fp large = fp{1 << 24};
+
+        large * large; // Integral result is 2^48, which doesn't fit alongside 16 fraction bits
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Multiply));
+
+        large * (fpBaseType{1} << 40); // Same for integer operand
+        EXPECT_EQ(2u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Multiply));
+
+        FixedPointOverflowRecord record;
+        ASSERT_TRUE(FixedPointOverflowTracker::TryGetRecord(0, record));
+        EXPECT_EQ(FixedPointOperation::Multiply, record.operation);
+        EXPECT_EQ(large.raw_value(), record.lhsRaw);
+        EXPECT_EQ(large.raw_value(), record.rhsRaw);
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenMultiplyOnlyFitsDueToWideIntermediate_thenNotReported) {
+        fp max = fp::from_raw_value(std::numeric_limits<fpBaseType>::max());
+        fp min = fp::from_raw_value(std::numeric_limits<fpBaseType>::min());
+
+        EXPECT_EQ(max, max * fp{1});
+        EXPECT_EQ(min, min * fp{1});
+        EXPECT_EQ(fp{50000} * fp{50000}, fp{2500000000});
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetTotalCount());
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenMultiplyJustPastLimit_thenReported) {
+        fp max = fp::from_raw_value(std::numeric_limits<fpBaseType>::max());
+
+        max * (fp{1} + fp::from_raw_value(1));
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Multiply));
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenDivideResultTooLarge_thenReported) {
+        fp tiny = fp::from_raw_value(1);
+
+        fp{fpBaseType{1} << 40} / tiny;
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetCount(FixedPointOperation::Divide));
+
+        EXPECT_EQ(fp::from_raw_value(fpBaseType{1} << 62), fp{1 << 30} / tiny); // Just fits
+        EXPECT_EQ(1u, FixedPointOverflowTracker::GetTotalCount());
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenDivideByZero_thenReportedAndResultIsZero) {
+        EXPECT_EQ(fp{0}, fp{5} / fp{0});
+        EXPECT_EQ(fp{0}, fp{-5} / 0);
+
+        EXPECT_EQ(2u, FixedPointOverflowTracker::GetCount(FixedPointOperation::DivideByZero));
+        EXPECT_EQ(2u, FixedPointOverflowTracker::GetTotalCount());
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenRandomOperationsInRange_thenNothingReportedAndSameResults) {
+        std::mt19937_64 generator{42};
+        std::uniform_int_distribution<fpBaseType> distribution(-(fpBaseType{1} << 40), fpBaseType{1} << 40);
+        constexpr double kLsb = 1.0 / 65536;
+        for (int i = 0; i < 10000; i++) {
+            fp a = fp::from_raw_value(distribution(generator));
+            fp b = fp::from_raw_value(distribution(generator) >> 16);
+            if (b == fp{0}) {
+                continue;
+            }
+
+            fp sum = a + b;
+            fp product = a * b;
+            fp quotient = a / b;
+            EXPECT_EQ(a.raw_value() + b.raw_value(), sum.raw_value());
+            EXPECT_NEAR(static_cast<double>(a) * static_cast<double>(b), static_cast<double>(product), kLsb);
+            EXPECT_NEAR(static_cast<double>(a) / static_cast<double>(b), static_cast<double>(quotient), kLsb);
+        }
+
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetTotalCount()) << FixedPointOverflowTracker::ToString();
+    }
+
+    TEST_F(FixedPointOverflowTrackerTests, checked_whenConstantEvaluated_thenStillCompiles) {
+        constexpr fp kResult = fp{3} * fp{4} / fp{2} - fp{1} + 2;
+
+        EXPECT_EQ(fp{7}, kResult);
+        EXPECT_EQ(0u, FixedPointOverflowTracker::GetTotalCount());
+    }
+#endif
+}
@@ -1,6 +1,10 @@
 #include "pchNCT.h"
 
+#include <random>
+
 #include "Math/FixedPoint.h"
+#include "Math/FVectorFP.h"
+#include "TestHelpers/BenchmarkHelpers.h"
 #include "TestHelpers/TestHelpers.h"
 
 using namespace ProjectNomad;
@@ -43,6 +47,85 @@ namespace FixedPointTests {
         EXPECT_NEAR(base * base, toFloat(test * test), 0.001);
     }
 
+    // Original fpm formulas with a 64 bit intermediate, which all results should match whenever these don't overflow
+    static fpBaseType legacyMultiply(fpBaseType x, fpBaseType y) {
+        fpBaseType value = (x * y) / (fpBaseType{1} << 15);
+        return (value / 2) + (value % 2);
+    }
+    static fpBaseType legacyDivide(fpBaseType x, fpBaseType y) {
+        fpBaseType value = (x * (fpBaseType{1} << 16) * 2) / y;
+        return (value / 2) + (value % 2);
+    }
+
+    TEST(multiply, whenProductExceeds64BitIntermediate_thenStillCorrect) {
+        fp test = fp{100000};
+
+        EXPECT_EQ(fp{10000000000ll}, test * test);
+        EXPECT_EQ(fp{-10000000000ll}, -test * test);
+    }
+
+    TEST(multiply, whenResultRoundsToHalf_thenRoundsAwayFromZero) {
+        EXPECT_EQ(2, (fp::from_raw_value(3) * fp{0.5f}).raw_value());
+        EXPECT_EQ(-2, (fp::from_raw_value(-3) * fp{0.5f}).raw_value());
+    }
+
+    TEST(multiply, whenWithinLegacyRange_thenBitIdenticalToLegacyFormula) {
+        std::mt19937_64 generator(1234); // Fixed seed so failures are reproducible
+        for (int i = 0; i < 100000; i++) {
+            fpBaseType x = static_cast<fpBaseType>(generator() % (1ull << 40)) - (fpBaseType{1} << 39);
+            fpBaseType y = static_cast<fpBaseType>(generator() % (1ull << 22)) - (fpBaseType{1} << 21);
+
+            ASSERT_EQ(legacyMultiply(x, y), (fp::from_raw_value(x) * fp::from_raw_value(y)).raw_value());
+        }
+    }
+
+    TEST(divide, whenNumeratorExceedsLegacyRange_thenStillCorrect) {
+        EXPECT_EQ(fp{2000000}, fp{1000000} / fp{0.5f});
+        EXPECT_EQ(fp{-250000}, fp{1000000} / fp{-4});
+    }
+
+    TEST(divide, whenWithinLegacyRange_thenBitIdenticalToLegacyFormula) {
+        std::mt19937_64 generator(5678);
+        for (int i = 0; i < 100000; i++) {
+            fpBaseType x = static_cast<fpBaseType>(generator() % (1ull << 46)) - (fpBaseType{1} << 45);
+            fpBaseType y = static_cast<fpBaseType>(generator() % (1ull << 30)) - (fpBaseType{1} << 29);
+            if (y == 0) {
+                continue;
+            }
+
+            ASSERT_EQ(legacyDivide(x, y), (fp::from_raw_value(x) / fp::from_raw_value(y)).raw_value());
+        }
+    }
+
+    TEST(FVectorFP, GetLengthSquared_whenComponentsPastLegacyOverflowRange_thenCorrect) {
+        FVectorFP vector(fp{60000}, fp{0}, fp{80000});
+
+        EXPECT_EQ(fp{10000000000ll}, vector.GetLengthSquared());
+    }
+
+    // Disabled as a benchmark. See BenchmarkHelpers for how to run
+    TEST(FixedPointBenchmarks, DISABLED_MultiplyAndDivide) {
+        std::mt19937_64 generator(42);
+        std::vector<fpBaseType> values(4096);
+        for (fpBaseType& value : values) {
+            value = static_cast<fpBaseType>(generator() % (1ull << 36)) - (fpBaseType{1} << 35);
+        }
+        const uint32_t mask = static_cast<uint32_t>(values.size()) - 1;
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Legacy 64 bit multiply", 10000000, [&](uint32_t i) {
+            return legacyMultiply(values[i & mask], values[(i + 1) & mask]);
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("FFixedPoint multiply", 10000000, [&](uint32_t i) {
+            return (fp::from_raw_value(values[i & mask]) * fp::from_raw_value(values[(i + 1) & mask])).raw_value();
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Legacy 64 bit divide", 10000000, [&](uint32_t i) {
+            return legacyDivide(values[i & mask] / 16, values[(i + 1) & mask] | 1);
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("FFixedPoint divide", 10000000, [&](uint32_t i) {
+            return (fp::from_raw_value(values[i & mask] / 16) / fp::from_raw_value(values[(i + 1) & mask] | 1)).raw_value();
+        });
+    }
+
     // TEST(serialization, serializesThenDeserializesSuccessfully) {
     //     float base = 45000.12345f;
     //     fp fpFromBase = fp{base};
@@ -0,0 +1,557 @@
+#include "pchNCT.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Math/FixedPoint.h"
+#include "Math/FMatrix3FP.h"
+#include "Math/FPEulerAngles.h"
+#include "Math/FPMath.h"
+#include "Math/FPMath2.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+#include "Math/QuatUtilities.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+
+using namespace ProjectNomad;
+
+// Timings and accuracy for every core math type next to float/double equivalents, so that before/after numbers for
+//      any math change come from one place. All tests are DISABLED_ so they only run on request:
+//      --gtest_also_run_disabled_tests --gtest_filter=MathBenchmarks*
+// Trig results follow the configured backend (see NOMAD_USE_TRIG_LOOKUP), so run both configs when changing trig.
+namespace MathBenchmarks {
+    constexpr uint32_t kCallCount = 2000000;
+    constexpr uint32_t kInputCount = 4096;
+    constexpr uint32_t kInputMask = kInputCount - 1;
+    static_assert(std::has_single_bit(kInputCount), "Inputs are indexed via mask");
+
+    constexpr double kRawPerUnit = 65536.0;
+
+    // Measured results only need to feed BenchmarkHelpers' sink, so reinterpret bits rather than converting
+    uint64_t ToResult(fp value) {
+        return static_cast<uint64_t>(value.raw_value());
+    }
+    uint64_t ToResult(float value) {
+        return std::bit_cast<uint32_t>(value);
+    }
+    uint64_t ToResult(double value) {
+        return std::bit_cast<uint64_t>(value);
+    }
+
+    double ToDouble(fp value) {
+        return static_cast<double>(value.raw_value()) / kRawPerUnit;
+    }
+
+    // Error in units of fp's smallest step (2^-16), which is also used for float results to compare like for like
+    double ErrorLsb(double actual, double expected) {
+        return std::abs(actual - expected) * kRawPerUnit;
+    }
+    double ErrorLsb(fp actual, double expected) {
+        return ErrorLsb(ToDouble(actual), expected);
+    }
+
+    /// <summary>Minimal float/double stand-ins for FVectorFP and FQuatFP, using the same formulas</summary>
+    template <typename T>
+    struct Vector3 {
+        T x = 0;
+        T y = 0;
+        T z = 0;
+
+        Vector3 operator+(const Vector3& other) const {
+            return {x + other.x, y + other.y, z + other.z};
+        }
+        Vector3 operator-(const Vector3& other) const {
+            return {x - other.x, y - other.y, z - other.z};
+        }
+        Vector3 operator*(T value) const {
+            return {x * value, y * value, z * value};
+        }
+        T Dot(const Vector3& other) const {
+            return x * other.x + y * other.y + z * other.z;
+        }
+        Vector3 Cross(const Vector3& other) const {
+            return {y * other.z - z * other.y, z * other.x - x * other.z, x * other.y - y * other.x};
+        }
+        T GetLength() const {
+            return std::sqrt(Dot(*this));
+        }
+        Vector3 Normalized() const {
+            T length = GetLength();
+            return length == 0 ? Vector3{} : *this * (1 / length);
+        }
+    };
+
+    template <typename T>
+    struct Quat {
+        T w = 1;
+        Vector3<T> v;
+
+        // Same formula as FQuatFP, including its sign convention
+        Quat operator*(const Quat& q) const {
+            return {w * q.w + v.Dot(q.v), v * q.w + q.v * w + v.Cross(q.v)};
+        }
+        Vector3<T> operator*(const Vector3<T>& input) const {
+            Vector3<T> vCrossInput = v.Cross(input);
+            return input + vCrossInput * (2 * w) + v.Cross(vCrossInput) * 2;
+        }
+        Quat Normalized() const {
+            T inverseLength = 1 / std::sqrt(w * w + v.Dot(v));
+            return {w * inverseLength, v * inverseLength};
+        }
+    };
+
+    template <typename T>
+    Vector3<T> ToVector(const FVectorFP& value) {
+        return {static_cast<T>(ToDouble(value.x)), static_cast<T>(ToDouble(value.y)), static_cast<T>(ToDouble(value.z))};
+    }
+
+    template <typename T>
+    Quat<T> ToQuat(const FQuatFP& value) {
+        return {static_cast<T>(ToDouble(value.w)), ToVector<T>(value.v)};
+    }
+
+    double MaxErrorLsb(const FVectorFP& actual, const Vector3<double>& expected) {
+        return std::max({ErrorLsb(actual.x, expected.x), ErrorLsb(actual.y, expected.y), ErrorLsb(actual.z, expected.z)});
+    }
+    double MaxErrorLsb(const Vector3<float>& actual, const Vector3<double>& expected) {
+        return std::max({ErrorLsb(actual.x, expected.x), ErrorLsb(actual.y, expected.y), ErrorLsb(actual.z, expected.z)});
+    }
+    double MaxErrorLsb(const FQuatFP& actual, const Quat<double>& expected) {
+        return std::max(ErrorLsb(actual.w, expected.w), MaxErrorLsb(actual.v, expected.v));
+    }
+
+    /// <summary>Reference versions of FPMath2 functions, templated so they can be timed as float and double</summary>
+    template <typename T>
+    struct Reference {
+        static constexpr T kDegreesToRadians = static_cast<T>(3.14159265358979323846 / 180.0);
+
+        static T BezierInterp(T a, T b, T alpha) {
+            return a + (b - a) * (alpha * alpha * (3 - 2 * alpha));
+        }
+
+        static Vector3<T> EulerToDirVector(T pitch, T yaw) {
+            T cosPitch = std::cos(pitch * kDegreesToRadians);
+            return {
+                std::cos(yaw * kDegreesToRadians) * cosPitch,
+                std::sin(yaw * kDegreesToRadians) * cosPitch,
+                std::sin(pitch * kDegreesToRadians)
+            };
+        }
+
+        static Quat<T> EulerToQuat(T roll, T pitch, T yaw) {
+            T halfToRadians = kDegreesToRadians / 2;
+            T cy = std::cos(yaw * halfToRadians), sy = std::sin(yaw * halfToRadians);
+            T cp = std::cos(pitch * halfToRadians), sp = std::sin(pitch * halfToRadians);
+            T cr = std::cos(roll * halfToRadians), sr = std::sin(roll * halfToRadians);
+            return {
+                cr * cp * cy + sr * sp * sy,
+                {sr * cp * cy - cr * sp * sy, cr * sp * cy + sr * cp * sy, cr * cp * sy - sr * sp * cy}
+            };
+        }
+
+        // FPMath2::dirVectorToQuat approach (axis + acos angle + sin/cos)
+        static Quat<T> DirVectorToQuatViaAngle(const Vector3<T>& target) {
+            Vector3<T> forward{1, 0, 0};
+            Vector3<T> axis = forward.Cross(target).Normalized();
+            T halfAngle = std::acos(std::clamp(target.Normalized().x, T{-1}, T{1})) / 2;
+            return {std::cos(halfAngle), axis * std::sin(halfAngle)};
+        }
+
+        // QuatUtilities::FromTo approach (shortest arc, no trig)
+        static Quat<T> DirVectorToQuat(const Vector3<T>& target) {
+            Vector3<T> forward{1, 0, 0};
+            Vector3<T> targetDir = target.Normalized();
+            return Quat<T>{1 + forward.Dot(targetDir), forward.Cross(targetDir)}.Normalized();
+        }
+
+        // Direct quat to pitch/yaw, for comparison with FPMath2::QuatToEuler
+        static Vector3<T> QuatToEuler(const Quat<T>& rotation) {
+            Vector3<T> forward = rotation * Vector3<T>{1, 0, 0};
+            return {0, std::asin(std::clamp(forward.z, T{-1}, T{1})) / kDegreesToRadians, std::atan2(forward.y, forward.x) / kDegreesToRadians};
+        }
+    };
+
+    class MathBenchmarks : public ::testing::Test {
+      protected:
+        std::mt19937_64 generator{0x4E4F4D4144}; // Fixed so that every run measures the exact same inputs
+
+        // Same values in every representation, so each variant does identical work
+        std::vector<fp> fps, unitFps, angleFps;
+        std::vector<float> floats, unitFloats, angleFloats;
+        std::vector<double> doubles, unitDoubles, angleDoubles;
+
+        std::vector<FVectorFP> vectors;
+        std::vector<Vector3<float>> floatVectors;
+        std::vector<Vector3<double>> doubleVectors;
+
+        std::vector<FQuatFP> rotations;
+        std::vector<Quat<float>> floatRotations;
+        std::vector<Quat<double>> doubleRotations;
+
+        std::vector<EulerAngles> eulers;
+
+        void SetUp() override {
+            for (uint32_t i = 0; i < kInputCount; i++) {
+                AddScalar(fps, floats, doubles, RandomFp(fp{-100}, fp{100}));
+                AddScalar(unitFps, unitFloats, unitDoubles, RandomFp(fp{-1}, fp{1}));
+                AddScalar(angleFps, angleFloats, angleDoubles, RandomFp(fp{-180}, fp{180}));
+
+                FVectorFP vector(RandomFp(fp{-10}, fp{10}), RandomFp(fp{-10}, fp{10}), RandomFp(fp{-10}, fp{10}));
+                vectors.push_back(vector.IsZero() ? FVectorFP::Forward() : vector);
+                floatVectors.push_back(ToVector<float>(vectors.back()));
+                doubleVectors.push_back(ToVector<double>(vectors.back()));
+
+                // Pitch kept away from vertical, where DirVectorToEuler's acos input can land outside [-1, 1] and assert
+                EulerAngles euler(RandomFp(fp{-180}, fp{180}), RandomFp(fp{-60}, fp{60}), RandomFp(fp{-180}, fp{180}));
+                eulers.push_back(euler);
+                rotations.push_back(FPMath2::eulerToQuat(euler).Normalized());
+                floatRotations.push_back(ToQuat<float>(rotations.back()));
+                doubleRotations.push_back(ToQuat<double>(rotations.back()));
+            }
+        }
+
+        fp RandomFp(fp min, fp max) {
+            uint64_t range = static_cast<uint64_t>(max.raw_value() - min.raw_value()) + 1;
+            return fp::from_raw_value(min.raw_value() + static_cast<fpBaseType>(generator() % range));
+        }
+
+        static void AddScalar(std::vector<fp>& fpValues, std::vector<float>& floatValues, std::vector<double>& doubleValues,
+                              fp value) {
+            fpValues.push_back(value);
+            floatValues.push_back(static_cast<float>(ToDouble(value)));
+            doubleValues.push_back(ToDouble(value));
+        }
+
+        template <typename Func>
+        static void Measure(const std::string& name, Func&& func) {
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name, kCallCount, func);
+        }
+    };
+
+    TEST_F(MathBenchmarks, DISABLED_FixedPointOperators) {
+        Measure("fp +", [&](uint32_t i) { return ToResult(fps[i & kInputMask] + fps[(i + 1) & kInputMask]); });
+        Measure("float +", [&](uint32_t i) { return ToResult(floats[i & kInputMask] + floats[(i + 1) & kInputMask]); });
+        Measure("double +", [&](uint32_t i) { return ToResult(doubles[i & kInputMask] + doubles[(i + 1) & kInputMask]); });
+
+        Measure("fp -", [&](uint32_t i) { return ToResult(fps[i & kInputMask] - fps[(i + 1) & kInputMask]); });
+        Measure("float -", [&](uint32_t i) { return ToResult(floats[i & kInputMask] - floats[(i + 1) & kInputMask]); });
+        Measure("double -", [&](uint32_t i) { return ToResult(doubles[i & kInputMask] - doubles[(i + 1) & kInputMask]); });
+
+        Measure("fp *", [&](uint32_t i) { return ToResult(fps[i & kInputMask] * fps[(i + 1) & kInputMask]); });
+        Measure("float *", [&](uint32_t i) { return ToResult(floats[i & kInputMask] * floats[(i + 1) & kInputMask]); });
+        Measure("double *", [&](uint32_t i) { return ToResult(doubles[i & kInputMask] * doubles[(i + 1) & kInputMask]); });
+
+        // Divisors kept away from zero, which would only measure error handling
+        Measure("fp /", [&](uint32_t i) { return ToResult(fps[i & kInputMask] / (FPMath::abs(fps[(i + 1) & kInputMask]) + fp{1})); });
+        Measure("float /", [&](uint32_t i) { return ToResult(floats[i & kInputMask] / (std::abs(floats[(i + 1) & kInputMask]) + 1)); });
+        Measure("double /", [&](uint32_t i) { return ToResult(doubles[i & kInputMask] / (std::abs(doubles[(i + 1) & kInputMask]) + 1)); });
+
+        Measure("fp unary -", [&](uint32_t i) { return ToResult(-fps[i & kInputMask]); });
+        Measure("float unary -", [&](uint32_t i) { return ToResult(-floats[i & kInputMask]); });
+        Measure("double unary -", [&](uint32_t i) { return ToResult(-doubles[i & kInputMask]); });
+
+        Measure("fp <", [&](uint32_t i) { return fps[i & kInputMask] < fps[(i + 1) & kInputMask]; });
+        Measure("float <", [&](uint32_t i) { return floats[i & kInputMask] < floats[(i + 1) & kInputMask]; });
+        Measure("double <", [&](uint32_t i) { return doubles[i & kInputMask] < doubles[(i + 1) & kInputMask]; });
+
+        Measure("fp from float", [&](uint32_t i) { return ToResult(fp{floats[i & kInputMask]}); });
+        Measure("fp to float", [&](uint32_t i) { return ToResult(static_cast<float>(fps[i & kInputMask])); });
+        Measure("fp to double", [&](uint32_t i) { return ToResult(static_cast<double>(fps[i & kInputMask])); });
+    }
+
+    TEST_F(MathBenchmarks, DISABLED_FPMathFunctions) {
+        Measure("FPMath::abs", [&](uint32_t i) { return ToResult(FPMath::abs(fps[i & kInputMask])); });
+        Measure("float abs", [&](uint32_t i) { return ToResult(std::abs(floats[i & kInputMask])); });
+        Measure("double abs", [&](uint32_t i) { return ToResult(std::abs(doubles[i & kInputMask])); });
+
+        Measure("FPMath::sqrt", [&](uint32_t i) { return ToResult(FPMath::sqrt(FPMath::abs(fps[i & kInputMask]))); });
+        Measure("float sqrt", [&](uint32_t i) { return ToResult(std::sqrt(std::abs(floats[i & kInputMask]))); });
+        Measure("double sqrt", [&](uint32_t i) { return ToResult(std::sqrt(std::abs(doubles[i & kInputMask]))); });
+
+        Measure("FPMath::rsqrt", [&](uint32_t i) { return ToResult(FPMath::rsqrt(FPMath::abs(fps[i & kInputMask]) + fp{1})); });
+        Measure("float 1 / sqrt", [&](uint32_t i) { return ToResult(1 / std::sqrt(std::abs(floats[i & kInputMask]) + 1)); });
+        Measure("double 1 / sqrt", [&](uint32_t i) { return ToResult(1 / std::sqrt(std::abs(doubles[i & kInputMask]) + 1)); });
+
+        Measure("FPMath::sinD", [&](uint32_t i) { return ToResult(FPMath::sinD(angleFps[i & kInputMask])); });
+        Measure("float sin", [&](uint32_t i) { return ToResult(std::sin(angleFloats[i & kInputMask] * Reference<float>::kDegreesToRadians)); });
+        Measure("double sin", [&](uint32_t i) { return ToResult(std::sin(angleDoubles[i & kInputMask] * Reference<double>::kDegreesToRadians)); });
+
+        Measure("FPMath::cosD", [&](uint32_t i) { return ToResult(FPMath::cosD(angleFps[i & kInputMask])); });
+        Measure("float cos", [&](uint32_t i) { return ToResult(std::cos(angleFloats[i & kInputMask] * Reference<float>::kDegreesToRadians)); });
+        Measure("double cos", [&](uint32_t i) { return ToResult(std::cos(angleDoubles[i & kInputMask] * Reference<double>::kDegreesToRadians)); });
+
+        Measure("FPMath::asinD", [&](uint32_t i) { return ToResult(FPMath::asinD(unitFps[i & kInputMask])); });
+        Measure("float asin", [&](uint32_t i) { return ToResult(std::asin(unitFloats[i & kInputMask])); });
+        Measure("double asin", [&](uint32_t i) { return ToResult(std::asin(unitDoubles[i & kInputMask])); });
+
+        Measure("FPMath::acosD", [&](uint32_t i) { return ToResult(FPMath::acosD(unitFps[i & kInputMask])); });
+        Measure("float acos", [&](uint32_t i) { return ToResult(std::acos(unitFloats[i & kInputMask])); });
+        Measure("double acos", [&](uint32_t i) { return ToResult(std::acos(unitDoubles[i & kInputMask])); });
+
+        Measure("FPMath::atanD", [&](uint32_t i) { return ToResult(FPMath::atanD(fps[i & kInputMask], fps[(i + 1) & kInputMask])); });
+        Measure("float atan2", [&](uint32_t i) { return ToResult(std::atan2(floats[i & kInputMask], floats[(i + 1) & kInputMask])); });
+        Measure("double atan2", [&](uint32_t i) { return ToResult(std::atan2(doubles[i & kInputMask], doubles[(i + 1) & kInputMask])); });
+
+        Measure("FPMath::fmod", [&](uint32_t i) { return ToResult(FPMath::fmod(fps[i & kInputMask], fp{7})); });
+        Measure("float fmod", [&](uint32_t i) { return ToResult(std::fmod(floats[i & kInputMask], 7.f)); });
+        Measure("double fmod", [&](uint32_t i) { return ToResult(std::fmod(doubles[i & kInputMask], 7.0)); });
+
+        Measure("FPMath::clamp", [&](uint32_t i) { return ToResult(FPMath::clamp(fps[i & kInputMask], fp{-50}, fp{50})); });
+        Measure("float clamp", [&](uint32_t i) { return ToResult(std::clamp(floats[i & kInputMask], -50.f, 50.f)); });
+        Measure("double clamp", [&](uint32_t i) { return ToResult(std::clamp(doubles[i & kInputMask], -50.0, 50.0)); });
+
+        Measure("FPMath::normalizeAxis", [&](uint32_t i) { return ToResult(FPMath::normalizeAxis(fps[i & kInputMask] * fp{5})); });
+        Measure("FPMath::clampAngle", [&](uint32_t i) { return ToResult(FPMath::clampAngle(angleFps[i & kInputMask], fp{-45}, fp{45})); });
+        Measure("FPMath::degreesToRadians", [&](uint32_t i) { return ToResult(FPMath::degreesToRadians(angleFps[i & kInputMask])); });
+        Measure("FPMath::min", [&](uint32_t i) { return ToResult(FPMath::min(fps[i & kInputMask], fps[(i + 1) & kInputMask])); });
+        Measure("FPMath::max", [&](uint32_t i) { return ToResult(FPMath::max(fps[i & kInputMask], fps[(i + 1) & kInputMask])); });
+    }
+
+    TEST_F(MathBenchmarks, DISABLED_FPMath2Functions) {
+        Measure("FPMath2::lerp", [&](uint32_t i) {
+            return ToResult(FPMath2::lerp(fps[i & kInputMask], fps[(i + 1) & kInputMask], unitFps[i & kInputMask]));
+        });
+        Measure("float lerp", [&](uint32_t i) {
+            float a = floats[i & kInputMask];
+            return ToResult(a + (floats[(i + 1) & kInputMask] - a) * unitFloats[i & kInputMask]);
+        });
+        Measure("double lerp", [&](uint32_t i) {
+            double a = doubles[i & kInputMask];
+            return ToResult(a + (doubles[(i + 1) & kInputMask] - a) * unitDoubles[i & kInputMask]);
+        });
+
+        Measure("FPMath2::bezierInterp", [&](uint32_t i) {
+            return ToResult(FPMath2::bezierInterp(fps[i & kInputMask], fps[(i + 1) & kInputMask], unitFps[i & kInputMask]));
+        });
+        Measure("float bezierInterp", [&](uint32_t i) {
+            return ToResult(Reference<float>::BezierInterp(floats[i & kInputMask], floats[(i + 1) & kInputMask], unitFloats[i & kInputMask]));
+        });
+        Measure("double bezierInterp", [&](uint32_t i) {
+            return ToResult(Reference<double>::BezierInterp(doubles[i & kInputMask], doubles[(i + 1) & kInputMask], unitDoubles[i & kInputMask]));
+        });
+
+        Measure("FPMath2::interpTo", [&](uint32_t i) {
+            return ToResult(FPMath2::interpTo(vectors[i & kInputMask], vectors[(i + 1) & kInputMask], fp{10}).x);
+        });
+
+        Measure("FPMath2::eulerToDirVector", [&](uint32_t i) { return ToResult(FPMath2::eulerToDirVector(eulers[i & kInputMask]).x); });
+        Measure("float eulerToDirVector", [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i & kInputMask];
+            return ToResult(Reference<float>::EulerToDirVector(static_cast<float>(euler.pitch), static_cast<float>(euler.yaw)).x);
+        });
+        Measure("double eulerToDirVector", [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i & kInputMask];
+            return ToResult(Reference<double>::EulerToDirVector(static_cast<double>(euler.pitch), static_cast<double>(euler.yaw)).x);
+        });
+
+        Measure("FPMath2::eulerToQuat", [&](uint32_t i) { return ToResult(FPMath2::eulerToQuat(eulers[i & kInputMask]).w); });
+        Measure("float eulerToQuat", [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i & kInputMask];
+            return ToResult(Reference<float>::EulerToQuat(static_cast<float>(euler.roll), static_cast<float>(euler.pitch),
+                                                          static_cast<float>(euler.yaw)).w);
+        });
+        Measure("double eulerToQuat", [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i & kInputMask];
+            return ToResult(Reference<double>::EulerToQuat(static_cast<double>(euler.roll), static_cast<double>(euler.pitch),
+                                                           static_cast<double>(euler.yaw)).w);
+        });
+
+        Measure("FPMath2::QuatToEuler", [&](uint32_t i) { return ToResult(FPMath2::QuatToEuler(rotations[i & kInputMask]).yaw); });
+        Measure("float QuatToEuler", [&](uint32_t i) { return ToResult(Reference<float>::QuatToEuler(floatRotations[i & kInputMask]).z); });
+        Measure("double QuatToEuler", [&](uint32_t i) { return ToResult(Reference<double>::QuatToEuler(doubleRotations[i & kInputMask]).z); });
+
+        // Unit inputs, as asin asserts on values even slightly outside [-1, 1]
+        std::vector<FVectorFP> directions;
+        for (const EulerAngles& euler : eulers) {
+            directions.push_back(FPMath2::eulerToDirVector(euler));
+        }
+        Measure("FPMath2::DirVectorToEuler", [&](uint32_t i) { return ToResult(FPMath2::DirVectorToEuler(directions[i & kInputMask]).yaw); });
+
+        Measure("FPMath2::dirVectorToQuat", [&](uint32_t i) { return ToResult(FPMath2::dirVectorToQuat(vectors[i & kInputMask]).w); });
+        Measure("QuatUtilities::FromTo", [&](uint32_t i) {
+            return ToResult(QuatUtilities::FromTo(FVectorFP::Forward(), vectors[i & kInputMask].Normalized()).w);
+        });
+        Measure("float dirVectorToQuat (axis + angle)", [&](uint32_t i) {
+            return ToResult(Reference<float>::DirVectorToQuatViaAngle(floatVectors[i & kInputMask]).w);
+        });
+        Measure("float dirVectorToQuat (shortest arc)", [&](uint32_t i) {
+            return ToResult(Reference<float>::DirVectorToQuat(floatVectors[i & kInputMask]).w);
+        });
+        Measure("double dirVectorToQuat (shortest arc)", [&](uint32_t i) {
+            return ToResult(Reference<double>::DirVectorToQuat(doubleVectors[i & kInputMask]).w);
+        });
+
+        Measure("FPMath2::HorizontalDirVectorToYawOnlyQuat", [&](uint32_t i) {
+            const FVectorFP& vector = vectors[i & kInputMask];
+            return ToResult(FPMath2::HorizontalDirVectorToYawOnlyQuat(FVectorFP(vector.x, vector.y, fp{0})).w);
+        });
+        Measure("QuatUtilities::FromYawDirection", [&](uint32_t i) {
+            return ToResult(QuatUtilities::FromYawDirection(vectors[i & kInputMask]).w);
+        });
+    }
+
+    TEST_F(MathBenchmarks, DISABLED_VectorAndQuatOperations) {
+        Measure("FVectorFP +", [&](uint32_t i) { return ToResult((vectors[i & kInputMask] + vectors[(i + 1) & kInputMask]).x); });
+        Measure("float vector +", [&](uint32_t i) { return ToResult((floatVectors[i & kInputMask] + floatVectors[(i + 1) & kInputMask]).x); });
+        Measure("double vector +", [&](uint32_t i) { return ToResult((doubleVectors[i & kInputMask] + doubleVectors[(i + 1) & kInputMask]).x); });
+
+        Measure("FVectorFP * scalar", [&](uint32_t i) { return ToResult((vectors[i & kInputMask] * fps[i & kInputMask]).x); });
+        Measure("float vector * scalar", [&](uint32_t i) { return ToResult((floatVectors[i & kInputMask] * floats[i & kInputMask]).x); });
+        Measure("double vector * scalar", [&](uint32_t i) { return ToResult((doubleVectors[i & kInputMask] * doubles[i & kInputMask]).x); });
+
+        Measure("FVectorFP::Dot", [&](uint32_t i) { return ToResult(vectors[i & kInputMask].Dot(vectors[(i + 1) & kInputMask])); });
+        Measure("float vector Dot", [&](uint32_t i) { return ToResult(floatVectors[i & kInputMask].Dot(floatVectors[(i + 1) & kInputMask])); });
+        Measure("double vector Dot", [&](uint32_t i) { return ToResult(doubleVectors[i & kInputMask].Dot(doubleVectors[(i + 1) & kInputMask])); });
+
+        Measure("FVectorFP::Cross", [&](uint32_t i) { return ToResult(vectors[i & kInputMask].Cross(vectors[(i + 1) & kInputMask]).x); });
+        Measure("float vector Cross", [&](uint32_t i) { return ToResult(floatVectors[i & kInputMask].Cross(floatVectors[(i + 1) & kInputMask]).x); });
+        Measure("double vector Cross", [&](uint32_t i) { return ToResult(doubleVectors[i & kInputMask].Cross(doubleVectors[(i + 1) & kInputMask]).x); });
+
+        Measure("FVectorFP::GetLength", [&](uint32_t i) { return ToResult(vectors[i & kInputMask].GetLength()); });
+        Measure("float vector GetLength", [&](uint32_t i) { return ToResult(floatVectors[i & kInputMask].GetLength()); });
+        Measure("double vector GetLength", [&](uint32_t i) { return ToResult(doubleVectors[i & kInputMask].GetLength()); });
+
+        Measure("FVectorFP::Normalized", [&](uint32_t i) { return ToResult(vectors[i & kInputMask].Normalized().x); });
+        Measure("FVectorFP::NormalizedFast", [&](uint32_t i) { return ToResult(vectors[i & kInputMask].NormalizedFast().x); });
+        Measure("float vector Normalized", [&](uint32_t i) { return ToResult(floatVectors[i & kInputMask].Normalized().x); });
+        Measure("double vector Normalized", [&](uint32_t i) { return ToResult(doubleVectors[i & kInputMask].Normalized().x); });
+
+        Measure("FQuatFP * FVectorFP", [&](uint32_t i) { return ToResult((rotations[i & kInputMask] * vectors[i & kInputMask]).x); });
+        Measure("float quat * vector", [&](uint32_t i) { return ToResult((floatRotations[i & kInputMask] * floatVectors[i & kInputMask]).x); });
+        Measure("double quat * vector", [&](uint32_t i) { return ToResult((doubleRotations[i & kInputMask] * doubleVectors[i & kInputMask]).x); });
+
+        Measure("FMatrix3FP * FVectorFP (incl. FromQuat)", [&](uint32_t i) {
+            return ToResult((FMatrix3FP::FromQuat(rotations[i & kInputMask]) * vectors[i & kInputMask]).x);
+        });
+
+        Measure("FQuatFP * FQuatFP", [&](uint32_t i) { return ToResult((rotations[i & kInputMask] * rotations[(i + 1) & kInputMask]).w); });
+        Measure("float quat * quat", [&](uint32_t i) { return ToResult((floatRotations[i & kInputMask] * floatRotations[(i + 1) & kInputMask]).w); });
+        Measure("double quat * quat", [&](uint32_t i) { return ToResult((doubleRotations[i & kInputMask] * doubleRotations[(i + 1) & kInputMask]).w); });
+
+        Measure("FQuatFP::Normalized", [&](uint32_t i) { return ToResult(rotations[i & kInputMask].Normalized().w); });
+        Measure("float quat Normalized", [&](uint32_t i) { return ToResult(floatRotations[i & kInputMask].Normalized().w); });
+        Measure("double quat Normalized", [&](uint32_t i) { return ToResult(doubleRotations[i & kInputMask].Normalized().w); });
+
+        Measure("FQuatFP::fromDegrees", [&](uint32_t i) {
+            return ToResult(FQuatFP::fromDegrees(FVectorFP::Up(), angleFps[i & kInputMask]).w);
+        });
+    }
+
+    // Errors are all in fp LSB (2^-16) versus double, including for float, so each row is directly comparable
+    TEST_F(MathBenchmarks, DISABLED_AccuracyVersusDouble) {
+        constexpr uint32_t kSweepCount = 1 << 20;
+        // Evenly spaced sweep over [min, max], which visits every raw value when range is small enough
+        auto sweep = [&](uint32_t i, double min, double max) {
+            return fp::from_raw_value(static_cast<fpBaseType>(std::llround((min + (max - min) * i / (kSweepCount - 1)) * kRawPerUnit)));
+        };
+
+        BenchmarkHelpers::MeasureError("fp * (|values| < 1000)", "LSB", kSweepCount, [&](uint32_t i) {
+            fp a = sweep(i, -1000, 1000), b = sweep((i * 7919) % kSweepCount, -1000, 1000);
+            return ErrorLsb(a * b, ToDouble(a) * ToDouble(b));
+        });
+        BenchmarkHelpers::MeasureError("float * (|values| < 1000)", "LSB", kSweepCount, [&](uint32_t i) {
+            double a = ToDouble(sweep(i, -1000, 1000)), b = ToDouble(sweep((i * 7919) % kSweepCount, -1000, 1000));
+            return ErrorLsb(static_cast<double>(static_cast<float>(a) * static_cast<float>(b)), a * b);
+        });
+        BenchmarkHelpers::MeasureError("fp / (|divisor| >= 1)", "LSB", kSweepCount, [&](uint32_t i) {
+            fp a = sweep(i, -1000, 1000), b = FPMath::abs(sweep((i * 7919) % kSweepCount, -100, 100)) + fp{1};
+            return ErrorLsb(a / b, ToDouble(a) / ToDouble(b));
+        });
+
+        BenchmarkHelpers::MeasureError("FPMath::sqrt [0, 1000]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, 0, 1000);
+            return ErrorLsb(FPMath::sqrt(value), std::sqrt(ToDouble(value)));
+        });
+        BenchmarkHelpers::MeasureError("float sqrt [0, 1000]", "LSB", kSweepCount, [&](uint32_t i) {
+            double value = ToDouble(sweep(i, 0, 1000));
+            return ErrorLsb(static_cast<double>(std::sqrt(static_cast<float>(value))), std::sqrt(value));
+        });
+        BenchmarkHelpers::MeasureError("FPMath::rsqrt [0.01, 1000]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, 0.01, 1000);
+            return ErrorLsb(FPMath::rsqrt(value), 1 / std::sqrt(ToDouble(value)));
+        });
+
+        BenchmarkHelpers::MeasureError("FPMath::sinR [-2pi, 2pi]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, -6.28, 6.28);
+            return ErrorLsb(FPMath::sinR(value), std::sin(ToDouble(value)));
+        });
+        BenchmarkHelpers::MeasureError("float sin [-2pi, 2pi]", "LSB", kSweepCount, [&](uint32_t i) {
+            double value = ToDouble(sweep(i, -6.28, 6.28));
+            return ErrorLsb(static_cast<double>(std::sin(static_cast<float>(value))), std::sin(value));
+        });
+        BenchmarkHelpers::MeasureError("FPMath::cosR [-2pi, 2pi]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, -6.28, 6.28);
+            return ErrorLsb(FPMath::cosR(value), std::cos(ToDouble(value)));
+        });
+        BenchmarkHelpers::MeasureError("FPMath::asinR [-1, 1]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, -1, 1);
+            return ErrorLsb(FPMath::asinR(value), std::asin(ToDouble(value)));
+        });
+        BenchmarkHelpers::MeasureError("FPMath::acosR [-1, 1]", "LSB", kSweepCount, [&](uint32_t i) {
+            fp value = sweep(i, -1, 1);
+            return ErrorLsb(FPMath::acosR(value), std::acos(ToDouble(value)));
+        });
+        BenchmarkHelpers::MeasureError("FPMath::atanR (y, x in [-10, 10])", "LSB", kSweepCount, [&](uint32_t i) {
+            fp y = sweep(i, -10, 10), x = sweep((i * 7919) % kSweepCount, -10, 10);
+            return ErrorLsb(FPMath::atanR(y, x), std::atan2(ToDouble(y), ToDouble(x)));
+        });
+
+        BenchmarkHelpers::MeasureError("FVectorFP::GetLength", "LSB", kInputCount, [&](uint32_t i) {
+            return ErrorLsb(vectors[i].GetLength(), ToVector<double>(vectors[i]).GetLength());
+        });
+        BenchmarkHelpers::MeasureError("FVectorFP::Normalized (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(vectors[i].Normalized(), ToVector<double>(vectors[i]).Normalized());
+        });
+        BenchmarkHelpers::MeasureError("FVectorFP::NormalizedFast (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(vectors[i].NormalizedFast(), ToVector<double>(vectors[i]).Normalized());
+        });
+        BenchmarkHelpers::MeasureError("float vector Normalized (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(floatVectors[i].Normalized(), ToVector<double>(vectors[i]).Normalized());
+        });
+        BenchmarkHelpers::MeasureError("FVectorFP::NormalizeAndGetLength (length)", "LSB", kInputCount, [&](uint32_t i) {
+            FVectorFP copy = vectors[i];
+            return ErrorLsb(copy.NormalizeAndGetLength(), ToVector<double>(vectors[i]).GetLength());
+        });
+
+        BenchmarkHelpers::MeasureError("FQuatFP * FVectorFP (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(rotations[i] * vectors[i], ToQuat<double>(rotations[i]) * ToVector<double>(vectors[i]));
+        });
+        BenchmarkHelpers::MeasureError("float quat * vector (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(floatRotations[i] * floatVectors[i], ToQuat<double>(rotations[i]) * ToVector<double>(vectors[i]));
+        });
+        BenchmarkHelpers::MeasureError("FMatrix3FP * FVectorFP (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(FMatrix3FP::FromQuat(rotations[i]) * vectors[i],
+                               ToQuat<double>(rotations[i]) * ToVector<double>(vectors[i]));
+        });
+        BenchmarkHelpers::MeasureError("FQuatFP * FQuatFP (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            const FQuatFP& a = rotations[i];
+            const FQuatFP& b = rotations[(i + 1) & kInputMask];
+            return MaxErrorLsb(a * b, ToQuat<double>(a) * ToQuat<double>(b));
+        });
+        BenchmarkHelpers::MeasureError("FQuatFP::Normalized (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            return MaxErrorLsb(rotations[i].Normalized(), ToQuat<double>(rotations[i]).Normalized());
+        });
+
+        BenchmarkHelpers::MeasureError("FPMath2::eulerToQuat (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i];
+            return MaxErrorLsb(FPMath2::eulerToQuat(euler),
+                               Reference<double>::EulerToQuat(ToDouble(euler.roll), ToDouble(euler.pitch), ToDouble(euler.yaw)));
+        });
+        BenchmarkHelpers::MeasureError("FPMath2::eulerToDirVector (max component)", "LSB", kInputCount, [&](uint32_t i) {
+            const EulerAngles& euler = eulers[i];
+            return MaxErrorLsb(FPMath2::eulerToDirVector(euler),
+                               Reference<double>::EulerToDirVector(ToDouble(euler.pitch), ToDouble(euler.yaw)));
+        });
+        BenchmarkHelpers::MeasureError("FPMath2::dirVectorToQuat (rotated Forward vs target)", "LSB", kInputCount, [&](uint32_t i) {
+            FVectorFP rotatedForward = FPMath2::dirVectorToQuat(vectors[i]) * FVectorFP::Forward();
+            return MaxErrorLsb(rotatedForward, ToVector<double>(vectors[i]).Normalized());
+        });
+        BenchmarkHelpers::MeasureError("FPMath2::QuatToEuler pitch (degrees)", "LSB", kInputCount, [&](uint32_t i) {
+            return ErrorLsb(FPMath2::QuatToEuler(rotations[i]).pitch, Reference<double>::QuatToEuler(ToQuat<double>(rotations[i])).y);
+        });
+    }
+}
@@ -0,0 +1,236 @@
+#include "pchNCT.h"
+
+#include <random>
+#include <vector>
+
+#include "Math/FPMath.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
+#include "Math/QuatUtilities.h"
+#include "Math/VectorUtilities.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace QuatUtilitiesTests {
+    class QuatUtilitiesTests : public ::testing::Test {
+      protected:
+        std::mt19937_64 generator{11};
+
+        FVectorFP GetRandomDirection() {
+            auto randomComponent = [&] {
+                return fp::from_raw_value(static_cast<fpBaseType>(generator() % (2 << 16)) - (1 << 16));
+            };
+            FVectorFP result(randomComponent(), randomComponent(), randomComponent());
+            return result.IsZero() ? FVectorFP::Forward() : result.Normalized();
+        }
+
+        void ExpectUnitLength(const FQuatFP& quat) {
+            TestHelpers::expectNear(fp{1}, quat.GetLengthSquared(), fp{0.0005f});
+        }
+    };
+
+    TEST_F(QuatUtilitiesTests, FromTo_whenRandomDirections_thenRotatesFromOntoTo) {
+        for (int i = 0; i < 1000; i++) {
+            FVectorFP from = GetRandomDirection();
+            FVectorFP to = GetRandomDirection();
+
+            FQuatFP result = QuatUtilities::FromTo(from, to);
+
+            ExpectUnitLength(result);
+            TestHelpers::expectNear(to, result * from, fp{0.002f});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, FromTo_whenOppositeDirections_thenRotatesHalfTurn) {
+        for (const FVectorFP& dir : {FVectorFP::Forward(), FVectorFP::Up(), FVectorFP::Down(), GetRandomDirection()}) {
+            FQuatFP result = QuatUtilities::FromTo(dir, -dir);
+
+            ExpectUnitLength(result);
+            TestHelpers::expectNear(-dir, result * dir, fp{0.002f});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, FromTo_whenNearlyOppositeDirections_thenRotatesOntoTo) {
+        FVectorFP to = FVectorFP(fp{-0.999329f}, fp{-0.036804f}, fp{0}); // Same game use case as FPMath2 tests
+
+        FQuatFP result = QuatUtilities::FromTo(FVectorFP::Forward(), to);
+
+        TestHelpers::expectNear(to, result * FVectorFP::Forward(), fp{0.002f});
+    }
+
+    TEST_F(QuatUtilitiesTests, FromTo_whenSameDirection_thenIdentity) {
+        FVectorFP dir = GetRandomDirection();
+
+        TestHelpers::expectNear(FQuatFP::identity(), QuatUtilities::FromTo(dir, dir), fp{0.0001f});
+    }
+
+    TEST_F(QuatUtilitiesTests, FromYawDirection_whenHorizontalDirections_thenMatchesAxisAngleYaw) {
+        for (int yaw = -179; yaw <= 180; yaw += 7) {
+            FQuatFP expected = FQuatFP::fromDegrees(FVectorFP::Up(), fp{yaw});
+            FVectorFP dir = expected * FVectorFP::Forward();
+
+            FQuatFP result = QuatUtilities::FromYawDirection(dir * fp{5});
+
+            EXPECT_EQ(fp{0}, result.v.x);
+            EXPECT_EQ(fp{0}, result.v.y);
+            TestHelpers::expectNear(dir, result * FVectorFP::Forward(), fp{0.002f});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, FromYawDirection_whenBackwards_thenHalfTurnAroundUp) {
+        TestHelpers::expectNear(FQuatFP(fp{0}, FVectorFP::Up()), QuatUtilities::FromYawDirection(FVectorFP::Backward()),
+                                fp{0});
+    }
+
+    TEST_F(QuatUtilitiesTests, FromYawDirection_whenVertical_thenIdentity) {
+        EXPECT_EQ(FQuatFP::identity(), QuatUtilities::FromYawDirection(FVectorFP::Up()));
+    }
+
+    TEST_F(QuatUtilitiesTests, LookRotation_whenRandomForward_thenFacesForwardWithHorizontalRight) {
+        for (int i = 0; i < 1000; i++) {
+            FVectorFP forward = GetRandomDirection();
+            if (FPMath::abs(forward.z) > fp{0.99f}) {
+                continue;
+            }
+
+            FQuatFP result = QuatUtilities::LookRotation(forward * fp{3});
+
+            ExpectUnitLength(result);
+            TestHelpers::expectNear(forward, result * FVectorFP::Forward(), fp{0.002f});
+            TestHelpers::expectNear(fp{0}, (result * FVectorFP::Right()).z, fp{0.002f});
+            EXPECT_GT((result * FVectorFP::Up()).z, fp{0});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, LookRotation_whenUpsideDownReference_thenRollsHalfTurn) {
+        FQuatFP result = QuatUtilities::LookRotation(FVectorFP::Forward(), FVectorFP::Down());
+
+        TestHelpers::expectNear(FVectorFP::Forward(), result * FVectorFP::Forward(), fp{0.002f});
+        TestHelpers::expectNear(FVectorFP::Down(), result * FVectorFP::Up(), fp{0.002f});
+    }
+
+    TEST_F(QuatUtilitiesTests, LookRotation_whenForwardParallelToUp_thenStillFacesForward) {
+        FQuatFP result = QuatUtilities::LookRotation(FVectorFP::Up());
+
+        TestHelpers::expectNear(FVectorFP::Up(), result * FVectorFP::Forward(), fp{0.002f});
+    }
+
+    TEST_F(QuatUtilitiesTests, Nlerp_whenEndpoints_thenReturnsInputs) {
+        FQuatFP from = FQuatFP::fromDegrees(FVectorFP::Up(), fp{10});
+        FQuatFP to = FQuatFP::fromDegrees(FVectorFP::Right(), fp{70});
+
+        TestHelpers::expectNear(from, QuatUtilities::Nlerp(from, to, fp{0}), fp{0.001f});
+        TestHelpers::expectNear(to, QuatUtilities::Nlerp(from, to, fp{1}), fp{0.001f});
+    }
+
+    TEST_F(QuatUtilitiesTests, Nlerp_whenTargetIsNegated_thenTakesShortPath) {
+        FQuatFP from = FQuatFP::identity();
+        FQuatFP to = FQuatFP::fromDegrees(FVectorFP::Up(), fp{90});
+        FQuatFP negatedTo(-to.w, -to.v);
+
+        FQuatFP result = QuatUtilities::Nlerp(from, negatedTo, fp{0.5f});
+
+        TestHelpers::expectNear(FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}) * FVectorFP::Forward(),
+                                result * FVectorFP::Forward(), fp{0.002f});
+    }
+
+    TEST_F(QuatUtilitiesTests, Slerp_whenHalfway_thenMatchesHalfAngle) {
+        FQuatFP from = FQuatFP::identity();
+        FQuatFP to = FQuatFP::fromDegrees(FVectorFP::Up(), fp{120});
+
+        for (fp alpha : {fp{0.25f}, fp{0.5f}, fp{0.75f}}) {
+            FQuatFP expected = FQuatFP::fromDegrees(FVectorFP::Up(), fp{120} * alpha);
+            TestHelpers::expectNear(expected, QuatUtilities::Slerp(from, to, alpha), fp{0.002f});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, Slerp_whenNearlyEqual_thenStaysUnitLength) {
+        FQuatFP from = FQuatFP::fromDegrees(FVectorFP::Up(), fp{30});
+        FQuatFP to = FQuatFP::fromDegrees(FVectorFP::Up(), fp{30.5f});
+
+        ExpectUnitLength(QuatUtilities::Slerp(from, to, fp{0.5f}));
+    }
+
+    TEST_F(QuatUtilitiesTests, GetBasis_whenRandomRotations_thenMatchesRotatingBasisVectors) {
+        for (int i = 0; i < 100; i++) {
+            FQuatFP rotation = QuatUtilities::FromTo(GetRandomDirection(), GetRandomDirection());
+
+            TestHelpers::expectNear(rotation * FVectorFP::Forward(), QuatUtilities::GetForward(rotation), fp{0.0005f});
+            TestHelpers::expectNear(rotation * FVectorFP::Right(), QuatUtilities::GetRight(rotation), fp{0.0005f});
+            TestHelpers::expectNear(rotation * FVectorFP::Up(), QuatUtilities::GetUp(rotation), fp{0.0005f});
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, GetYawAndPitch_whenYawThenPitch_thenReturnsSignedAngles) {
+        for (int yaw : {-150, -90, -20, 0, 45, 135}) {
+            for (int pitch : {-60, 0, 30}) {
+                FVectorFP dir(FPMath::cosD(fp{yaw}) * FPMath::cosD(fp{pitch}),
+                              FPMath::sinD(fp{yaw}) * FPMath::cosD(fp{pitch}),
+                              FPMath::sinD(fp{pitch}));
+                FQuatFP rotation = QuatUtilities::LookRotation(dir);
+
+                TestHelpers::expectNear(fp{yaw}, QuatUtilities::GetYawDegrees(rotation), fp{0.1f});
+                TestHelpers::expectNear(fp{pitch}, QuatUtilities::GetPitchDegrees(rotation), fp{0.1f});
+            }
+        }
+    }
+
+    TEST_F(QuatUtilitiesTests, GetYawOnly_whenPitchedAndRolled_thenKeepsHorizontalFacing) {
+        FQuatFP yaw = FQuatFP::fromDegrees(FVectorFP::Up(), fp{60});
+        FQuatFP lookingDown = QuatUtilities::LookRotation(yaw * FVectorFP(fp{1}, fp{0}, fp{-1}));
+
+        FQuatFP result = QuatUtilities::GetYawOnly(lookingDown);
+
+        TestHelpers::expectNear(yaw * FVectorFP::Forward(), result * FVectorFP::Forward(), fp{0.002f});
+        TestHelpers::expectNear(FVectorFP::Up(), result * FVectorFP::Up(), fp{0.002f});
+    }
+
+    TEST_F(QuatUtilitiesTests, Normalized_whenDrifted_thenUnitLengthAndSameRotation) {
+        FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP(fp{1}, fp{2}, fp{3}).Normalized(), fp{75});
+        FQuatFP drifted(rotation.w * fp{1.05f}, rotation.v * fp{1.05f});
+
+        FQuatFP result = drifted.Normalized();
+
+        ExpectUnitLength(result);
+        TestHelpers::expectNear(rotation * FVectorFP::Forward(), result * FVectorFP::Forward(), fp{0.002f});
+        EXPECT_EQ(FQuatFP::identity(), FQuatFP().Normalized());
+    }
+
+    TEST_F(QuatUtilitiesTests, DISABLED_Benchmark_AxisAngleVsDirectQuat) {
+        constexpr uint32_t kCallCount = 1000000;
+        std::vector<FVectorFP> directions;
+        std::vector<FVectorFP> horizontalDirections;
+        for (int i = 0; i < 256; i++) {
+            directions.push_back(GetRandomDirection());
+            horizontalDirections.push_back(VectorUtilities::zeroOutZ(directions.back()).Normalized());
+        }
+
+        // FPMath2::dirVectorToQuat approach
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Cross + acos + fromDegrees", kCallCount, [&](uint32_t i) {
+            const FVectorFP& to = directions[i & 0xFF];
+            FVectorFP axis = FVectorFP::Forward().Cross(to).Normalized();
+            fp angle = VectorUtilities::getAngleBetweenVectorsInDegrees(to, FVectorFP::Forward());
+            return FQuatFP::fromDegrees(axis, angle).w.raw_value();
+        });
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("QuatUtilities::FromTo", kCallCount, [&](uint32_t i) {
+            return QuatUtilities::FromTo(FVectorFP::Forward(), directions[i & 0xFF]).w.raw_value();
+        });
+
+        // FPMath2::HorizontalDirVectorToYawOnlyQuat approach
+        BenchmarkHelpers::MeasureNanosecondsPerCall("Yaw via acos + fromDegrees", kCallCount, [&](uint32_t i) {
+            const FVectorFP& dir = horizontalDirections[i & 0xFF];
+            fp angle = VectorUtilities::getAngleBetweenVectorsInDegrees(FVectorFP::Forward(), dir);
+            if (!VectorUtilities::isXYCrossDotPositive(FVectorFP::Forward(), dir)) {
+                angle = -angle;
+            }
+            return FQuatFP::fromDegrees(FVectorFP::Up(), angle).w.raw_value();
+        });
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("QuatUtilities::FromYawDirection", kCallCount, [&](uint32_t i) {
+            return QuatUtilities::FromYawDirection(horizontalDirections[i & 0xFF]).w.raw_value();
+        });
+    }
+}
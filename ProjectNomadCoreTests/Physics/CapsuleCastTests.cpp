@@ -0,0 +1,187 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Physics/SimpleCollisions.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/Line.h"
+#include "Physics/Model/Ray.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace CapsuleCastTests {
+    class CapsuleCastTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        const fp kTolerance = fp{0.01f};
+    };
+
+    TEST_F(CapsuleCastTests, RaycastWithCapsule_whenHittingCylinderSide_thenReturnsDistanceToSurface) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        Ray ray(FVectorFP(fp{-10}, fp{0}, fp{1}), FVectorFP::Forward());
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+        bool result = SimpleCollisions::RaycastWithCapsule(coreContext, ray, capsule, timeOfIntersection,
+                                                           pointOfIntersection);
+
+        ASSERT_TRUE(result);
+        TestHelpers::expectNear(fp{9}, timeOfIntersection, kTolerance);
+        TestHelpers::expectNear(FVectorFP(fp{-1}, fp{0}, fp{1}), pointOfIntersection, kTolerance);
+    }
+
+    TEST_F(CapsuleCastTests, RaycastWithCapsule_whenHittingEndCap_thenReturnsDistanceToCapSurface) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        Ray ray(FVectorFP(fp{0}, fp{0}, fp{10}), FVectorFP::Down());
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+        bool result = SimpleCollisions::RaycastWithCapsule(coreContext, ray, capsule, timeOfIntersection,
+                                                           pointOfIntersection);
+
+        ASSERT_TRUE(result);
+        TestHelpers::expectNear(fp{7}, timeOfIntersection, kTolerance);
+        TestHelpers::expectNear(FVectorFP(fp{0}, fp{0}, fp{3}), pointOfIntersection, kTolerance);
+    }
+
+    TEST_F(CapsuleCastTests, RaycastWithCapsule_whenPassingAboveEndCapWithinCylinderRange_thenNoHit) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        // Would hit infinite cylinder, but end cap has already curved away at this height
+        Ray ray(FVectorFP(fp{-10}, fp{0.5f}, fp{2.9f}), FVectorFP::Forward());
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+        bool result = SimpleCollisions::RaycastWithCapsule(coreContext, ray, capsule, timeOfIntersection,
+                                                           pointOfIntersection);
+
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(CapsuleCastTests, RaycastWithCapsule_whenOriginWithinCapsule_thenHitsImmediately) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        Ray ray(FVectorFP(fp{0.5f}, fp{0}, fp{2}), FVectorFP::Forward());
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+        bool result = SimpleCollisions::RaycastWithCapsule(coreContext, ray, capsule, timeOfIntersection,
+                                                           pointOfIntersection);
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(fp{0}, timeOfIntersection);
+        EXPECT_EQ(ray.origin, pointOfIntersection);
+    }
+
+    TEST_F(CapsuleCastTests, LinetestWithCapsule_whenLineEndsBeforeCapsule_thenNoHit) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        Line line(FVectorFP(fp{-10}, fp{0}, fp{0}), FVectorFP(fp{-1.1f}, fp{0}, fp{0}));
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+        bool result = SimpleCollisions::LinetestWithCapsule(coreContext, line, capsule, timeOfIntersection,
+                                                            pointOfIntersection);
+
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(CapsuleCastTests, SweepSphereWithCapsule_whenMovingIntoSide_thenContactsCapsuleSurface) {
+        FCollider sphere, capsule;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{0.5f});
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        // Centers are 1.5 apart at contact, ie after 8.5 units of movement out of 20
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepSphereWithCapsule(
+            coreContext, sphere, FVectorFP(fp{20}, fp{0}, fp{0}), capsule, timeOfImpact, pointOfImpact
+        );
+
+        ASSERT_TRUE(result);
+        TestHelpers::expectNear(fp{8.5f} / fp{20}, timeOfImpact, kTolerance);
+        TestHelpers::expectNear(FVectorFP(fp{-1}, fp{0}, fp{0}), pointOfImpact, kTolerance);
+    }
+
+    TEST_F(CapsuleCastTests, SweepSphereWithCapsule_whenMovingAway_thenNoHit) {
+        FCollider sphere, capsule;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{0.5f});
+        capsule.SetCapsule(FVectorFP::Zero(), fp{1}, fp{3});
+
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepSphereWithCapsule(
+            coreContext, sphere, FVectorFP(fp{-20}, fp{0}, fp{0}), capsule, timeOfImpact, pointOfImpact
+        );
+
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(CapsuleCastTests, SweepCapsuleWithBox_whenFallingOntoBox_thenEndCapContactsTopFace) {
+        FCollider capsule, box;
+        capsule.SetCapsule(FVectorFP(fp{1}, fp{2}, fp{10}), fp{1}, fp{2});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        // Capsule bottom starts at z = 8 and touches top face (z = 5) after 3 units of movement out of 10
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepCapsuleWithBox(
+            coreContext, capsule, FVectorFP(fp{0}, fp{0}, fp{-10}), box, timeOfImpact, pointOfImpact
+        );
+
+        ASSERT_TRUE(result);
+        TestHelpers::expectNear(fp{0.3f}, timeOfImpact, kTolerance);
+        TestHelpers::expectNear(FVectorFP(fp{1}, fp{2}, fp{5}), pointOfImpact, kTolerance);
+    }
+
+    TEST_F(CapsuleCastTests, SweepCapsuleWithBox_whenSideMovesIntoRotatedBoxEdge_thenContactsEdge) {
+        FCollider capsule, box;
+        capsule.SetCapsule(FVectorFP(fp{-10}, fp{-3}, fp{0}), FVectorFP(fp{-10}, fp{3}, fp{0}), fp{0.5f});
+        box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}), FVectorFP(fp{1}));
+
+        // Leading vertical edge is at x = -sqrt(2), which touches middle of capsule rather than either end
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepCapsuleWithBox(
+            coreContext, capsule, FVectorFP(fp{20}, fp{0}, fp{0}), box, timeOfImpact, pointOfImpact
+        );
+
+        ASSERT_TRUE(result);
+        fp edgeX = -FPMath::sqrt(fp{2});
+        TestHelpers::expectNear((edgeX - fp{0.5f} + fp{10}) / fp{20}, timeOfImpact, kTolerance);
+        TestHelpers::expectNear(FVectorFP(edgeX, fp{0}, fp{0}), pointOfImpact, kTolerance);
+    }
+
+    TEST_F(CapsuleCastTests, SweepCapsuleWithBox_whenPassingBesideBox_thenNoHit) {
+        FCollider capsule, box;
+        capsule.SetCapsule(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{1}, fp{2});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepCapsuleWithBox(
+            coreContext, capsule, FVectorFP(fp{0}, fp{20}, fp{0}), box, timeOfImpact, pointOfImpact
+        );
+
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(CapsuleCastTests, SweepCapsuleWithBox_whenAlreadyTouching_thenHitsImmediately) {
+        FCollider capsule, box;
+        capsule.SetCapsule(FVectorFP(fp{5.5f}, fp{0}, fp{0}), fp{1}, fp{2});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        bool result = SimpleCollisions::SweepCapsuleWithBox(
+            coreContext, capsule, FVectorFP(fp{10}, fp{0}, fp{0}), box, timeOfImpact, pointOfImpact
+        );
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(fp{0}, timeOfImpact);
+        // Capsule side is parallel to face, so any point along it is valid
+        TestHelpers::expectNear(fp{5}, pointOfImpact.x, kTolerance);
+    }
+}
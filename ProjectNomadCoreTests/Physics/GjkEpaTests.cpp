@@ -0,0 +1,162 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/GjkEpa.h"
+#include "Physics/Model/FCollider.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace GjkEpaTests {
+    class GjkEpaTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        const fp kTolerance = fp{0.02f};
+    };
+
+    TEST_F(GjkEpaTests, CalculateCoreDistance_whenSpheresApart_thenReturnsDistanceBetweenCenters) {
+        FCollider sphereA, sphereB;
+        sphereA.SetSphere(FVectorFP::Zero(), fp{1});
+        sphereB.SetSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{1});
+
+        GjkWarmStart warmStart;
+        GjkDistanceResult result = GjkEpa::CalculateCoreDistance(sphereA, sphereB, warmStart);
+
+        EXPECT_FALSE(result.areCoresOverlapping);
+        TestHelpers::expectNear(fp{10}, result.coreDistance, kTolerance);
+        TestHelpers::expectNear(FVectorFP::Forward(), result.directionAToB, kTolerance);
+        EXPECT_FALSE(warmStart.IsEmpty());
+    }
+
+    TEST_F(GjkEpaTests, CalculateCoreDistance_whenSimplexBecomesNearlyFlatTetrahedron_thenKeepsPriorClosestPoint) {
+        // Fourth support point lands almost on plane of the current triangle here, and reducing that tetrahedron
+        //      picks a face further from the origin (~1.71 instead of ~0.31) than previous iteration's triangle
+        FCollider boxA, boxB;
+        boxA.SetBox(FVectorFP::Zero(), FVectorFP(fp{4}, fp{3}, fp{2}));
+        boxB.SetBox(FVectorFP(fp{-2}, fp{2}, fp{-5}),
+                    FQuatFP::fromDegrees(FVectorFP::Right(), fp{35}),
+                    FVectorFP(fp{4}, fp{3}, fp{1}));
+
+        GjkWarmStart warmStart;
+        GjkDistanceResult result = GjkEpa::CalculateCoreDistance(boxA, boxB, warmStart);
+
+        EXPECT_FALSE(result.areCoresOverlapping);
+        TestHelpers::expectNear(fp{0.3098f}, result.coreDistance, kTolerance); // Exact distance between the boxes
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenSpheresApart_thenNoCollision) {
+        FCollider sphereA, sphereB;
+        sphereA.SetSphere(FVectorFP::Zero(), fp{1});
+        sphereB.SetSphere(FVectorFP(fp{2.5f}, fp{0}, fp{0}), fp{1});
+
+        ImpactResult result = GjkEpa::IsColliding(coreContext, sphereA, sphereB);
+
+        EXPECT_FALSE(result.isColliding);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenSpheresShallowlyOverlap_thenMatchesAnalyticResult) {
+        FCollider sphereA, sphereB;
+        sphereA.SetSphere(FVectorFP::Zero(), fp{1});
+        sphereB.SetSphere(FVectorFP(fp{0}, fp{1.5f}, fp{0}), fp{1});
+
+        ImpactResult gjkResult = GjkEpa::IsColliding(coreContext, sphereA, sphereB);
+        ImpactResult analyticResult = ComplexCollisions::IsSphereAndSphereColliding(coreContext, sphereA, sphereB);
+
+        ASSERT_TRUE(gjkResult.isColliding);
+        ASSERT_TRUE(analyticResult.isColliding);
+        TestHelpers::expectNear(analyticResult.penetrationDirection, gjkResult.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(analyticResult.penetrationMagnitude, gjkResult.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenCapsuleShallowlyIntoBoxFace_thenPushesAlongFaceNormal) {
+        FCollider box, capsule;
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        capsule.SetCapsule(FVectorFP(fp{6.5f}, fp{0}, fp{0}), fp{2}, fp{4});
+
+        ImpactResult result = GjkEpa::IsColliding(coreContext, box, capsule);
+
+        ASSERT_TRUE(result.isColliding);
+        TestHelpers::expectNear(FVectorFP::Forward(), result.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(fp{0.5f}, result.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenCapsuleCoreWithinBox_thenUsesEpaForPenetration) {
+        FCollider box, capsule;
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        capsule.SetCapsule(FVectorFP(fp{4}, fp{0}, fp{0}), fp{2}, fp{4});
+
+        ImpactResult result = GjkEpa::IsColliding(coreContext, box, capsule);
+
+        ASSERT_TRUE(result.isColliding);
+        TestHelpers::expectNear(FVectorFP::Forward(), result.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(fp{3}, result.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenSphereIntoRotatedBox_thenMatchesAnalyticResult) {
+        FCollider box, sphere;
+        box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{30}), FVectorFP(fp{5}));
+        sphere.SetSphere(FVectorFP(fp{5}, fp{3}, fp{1}), fp{2});
+
+        ImpactResult gjkResult = GjkEpa::IsColliding(coreContext, box, sphere);
+        ImpactResult analyticResult = ComplexCollisions::IsBoxAndSphereColliding(coreContext, box, sphere);
+
+        ASSERT_TRUE(gjkResult.isColliding);
+        ASSERT_TRUE(analyticResult.isColliding);
+        TestHelpers::expectNear(analyticResult.penetrationDirection, gjkResult.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(analyticResult.penetrationMagnitude, gjkResult.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenCapsuleCoreWithinBox_thenMatchesAnalyticResult) {
+        FCollider box, capsule;
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        capsule.SetCapsule(FVectorFP(fp{4}, fp{0}, fp{0}), fp{2}, fp{4});
+
+        ImpactResult gjkResult = GjkEpa::IsColliding(coreContext, box, capsule);
+        ImpactResult analyticResult = ComplexCollisions::IsBoxAndCapsuleColliding(coreContext, box, capsule);
+
+        ASSERT_TRUE(gjkResult.isColliding);
+        ASSERT_TRUE(analyticResult.isColliding);
+        TestHelpers::expectNear(analyticResult.penetrationDirection, gjkResult.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(analyticResult.penetrationMagnitude, gjkResult.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenTiltedCapsuleIntoRotatedBoxEdge_thenMatchesAnalyticResult) {
+        FCollider box, capsule;
+        box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{30}), FVectorFP(fp{3}, fp{2}, fp{1}));
+        capsule.SetCapsule(FVectorFP(fp{3}, fp{2}, fp{1.5f}),
+                           FQuatFP::fromDegrees(FVectorFP::Forward(), fp{60}),
+                           fp{1},
+                           fp{3});
+
+        ImpactResult gjkResult = GjkEpa::IsColliding(coreContext, box, capsule);
+        ImpactResult analyticResult = ComplexCollisions::IsBoxAndCapsuleColliding(coreContext, box, capsule);
+
+        ASSERT_TRUE(gjkResult.isColliding);
+        ASSERT_TRUE(analyticResult.isColliding);
+        TestHelpers::expectNear(analyticResult.penetrationDirection, gjkResult.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(analyticResult.penetrationMagnitude, gjkResult.penetrationMagnitude, kTolerance);
+    }
+
+    TEST_F(GjkEpaTests, IsColliding_whenRepeatedWithWarmStart_thenSameResultInFewIterations) {
+        FCollider box, capsule;
+        box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}), FVectorFP(fp{5}));
+        capsule.SetCapsule(FVectorFP(fp{8}, fp{1}, fp{0}), FQuatFP::fromDegrees(FVectorFP::Right(), fp{60}), fp{2}, fp{4});
+
+        GjkWarmStart warmStart;
+        uint32_t coldIterations = 0;
+        ImpactResult coldResult = GjkEpa::IsColliding(coreContext, box, capsule, warmStart, &coldIterations);
+
+        capsule.center.x -= fp{0.1f}; // Small amount of movement, as expected between frames
+        uint32_t warmIterations = 0;
+        ImpactResult warmResult = GjkEpa::IsColliding(coreContext, box, capsule, warmStart, &warmIterations);
+        ImpactResult referenceResult = GjkEpa::IsColliding(coreContext, box, capsule);
+
+        ASSERT_TRUE(coldResult.isColliding);
+        ASSERT_TRUE(warmResult.isColliding);
+        EXPECT_LE(warmIterations, 3);
+        EXPECT_LE(warmIterations, coldIterations);
+        TestHelpers::expectNear(referenceResult.penetrationDirection, warmResult.penetrationDirection, kTolerance);
+        TestHelpers::expectNear(referenceResult.penetrationMagnitude, warmResult.penetrationMagnitude, kTolerance);
+    }
+}
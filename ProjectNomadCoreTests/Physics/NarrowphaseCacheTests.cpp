@@ -0,0 +1,118 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/GjkData.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace NarrowphaseCacheTests {
+    class NarrowphaseCacheTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        NarrowphaseCache cache;
+        entt::entity otherEntity = entt::entity{7};
+        FCollider sphereA, sphereB;
+
+        void SetUp() override {
+            BaseSimTest::SetUp();
+            sphereA.SetSphere(FVectorFP::Zero(), fp{1});
+            sphereB.SetSphere(FVectorFP(fp{1.5f}, fp{0}, fp{0}), fp{1});
+        }
+
+        ImpactResult CheckOnFrame(FrameType frame) {
+            return ComplexCollisions::IsColliding(coreContext, sphereA, sphereB, cache.FindOrAdd(otherEntity, frame));
+        }
+    };
+
+    TEST_F(NarrowphaseCacheTests, IsColliding_whenFirstCheck_thenCachesFullResult) {
+        ImpactResult result = CheckOnFrame(1);
+
+        ASSERT_TRUE(result.isColliding);
+        const CachedContact& contact = cache.FindOrAdd(otherEntity, 1).contact;
+        EXPECT_TRUE(contact.isValid);
+        EXPECT_TRUE(contact.wasColliding);
+        EXPECT_EQ(1, contact.calculatedFrame);
+        EXPECT_EQ(result.penetrationDirection, contact.axis);
+        EXPECT_EQ(result.penetrationMagnitude, contact.depth);
+    }
+
+    TEST_F(NarrowphaseCacheTests, IsColliding_whenMovedAlongCachedAxis_thenReusesAxisWithExactDepth) {
+        CheckOnFrame(1);
+
+        sphereB.center.x = fp{1.25f};
+        ImpactResult cachedResult = CheckOnFrame(2);
+        ImpactResult fullResult = ComplexCollisions::IsColliding(coreContext, sphereA, sphereB);
+
+        ASSERT_TRUE(cachedResult.isColliding);
+        EXPECT_EQ(1, cache.FindOrAdd(otherEntity, 2).contact.calculatedFrame);
+        EXPECT_EQ(fullResult.penetrationDirection, cachedResult.penetrationDirection);
+        EXPECT_EQ(fullResult.penetrationMagnitude, cachedResult.penetrationMagnitude);
+    }
+
+    TEST_F(NarrowphaseCacheTests, IsColliding_whenSeparatedAlongCachedAxis_thenNoCollisionWithoutFullCheck) {
+        CheckOnFrame(1);
+
+        sphereB.center.x = fp{2.5f};
+        ImpactResult result = CheckOnFrame(2);
+
+        EXPECT_FALSE(result.isColliding);
+        EXPECT_EQ(1, cache.FindOrAdd(otherEntity, 2).contact.calculatedFrame);
+    }
+
+    TEST_F(NarrowphaseCacheTests, IsColliding_whenMovedSideways_thenRecalculates) {
+        CheckOnFrame(1);
+
+        sphereB.center.y = fp{1};
+        ImpactResult result = CheckOnFrame(2);
+        ImpactResult fullResult = ComplexCollisions::IsColliding(coreContext, sphereA, sphereB);
+
+        ASSERT_TRUE(result.isColliding);
+        EXPECT_EQ(2, cache.FindOrAdd(otherEntity, 2).contact.calculatedFrame);
+        EXPECT_EQ(fullResult.penetrationDirection, result.penetrationDirection);
+        EXPECT_EQ(fullResult.penetrationMagnitude, result.penetrationMagnitude);
+    }
+
+    TEST_F(NarrowphaseCacheTests, IsColliding_whenCachedContactTooOld_thenRecalculates) {
+        for (FrameType frame = 1; frame <= 20; frame++) {
+            CheckOnFrame(frame);
+        }
+
+        EXPECT_GT(cache.FindOrAdd(otherEntity, 20).contact.calculatedFrame, 1);
+    }
+
+    TEST_F(NarrowphaseCacheTests, FindOrAdd_whenEntryNotUsedLastFrame_thenClearsCachedData) {
+        CheckOnFrame(1);
+
+        NarrowphaseCacheEntry& entry = cache.FindOrAdd(otherEntity, 5);
+
+        EXPECT_FALSE(entry.contact.isValid);
+        EXPECT_TRUE(entry.gjkWarmStart.IsEmpty());
+    }
+
+    TEST_F(NarrowphaseCacheTests, FindOrAdd_whenFull_thenReplacesLeastRecentlyUsedEntry) {
+        for (uint32_t i = 0; i < NarrowphaseCache::kMaxEntries; i++) {
+            NarrowphaseCacheEntry& entry = cache.FindOrAdd(entt::entity{i}, i == 3 ? 1 : 2);
+            entry.gjkWarmStart.directionCount = 1; // Marker to tell apart existing entries from re-added entries
+        }
+
+        NarrowphaseCacheEntry& newEntry = cache.FindOrAdd(entt::entity{100}, 2);
+        EXPECT_EQ(NarrowphaseCache::kMaxEntries, cache.GetSize());
+        EXPECT_EQ(entt::entity{100}, newEntry.otherEntity);
+
+        EXPECT_TRUE(cache.FindOrAdd(entt::entity{3}, 2).gjkWarmStart.IsEmpty());
+    }
+
+    TEST_F(NarrowphaseCacheTests, CalculateCRC32_whenCachedContactChanges_thenChecksumChanges) {
+        uint32_t emptyChecksum = 0;
+        cache.CalculateCRC32(emptyChecksum);
+
+        CheckOnFrame(1);
+        uint32_t filledChecksum = 0;
+        cache.CalculateCRC32(filledChecksum);
+
+        EXPECT_NE(emptyChecksum, filledChecksum);
+    }
+}
@@ -0,0 +1,147 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/NarrowphaseMemo.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/GjkData.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace NarrowphaseMemoTests {
+    class NarrowphaseMemoTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        NarrowphaseMemo memo;
+        FCollider box, capsule;
+
+        void SetUp() override {
+            BaseSimTest::SetUp();
+            box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{30}), FVectorFP(fp{2}, fp{1}, fp{1}));
+            capsule.SetCapsule(FVectorFP(fp{2}, fp{1}, fp{0}), fp{1}, fp{2});
+        }
+
+        static NarrowphaseCacheEntry CreateCacheEntry(FrameType frame) {
+            NarrowphaseCacheEntry cacheEntry;
+            cacheEntry.otherEntity = entt::entity{3};
+            cacheEntry.lastUsedFrame = frame;
+            return cacheEntry;
+        }
+
+        static void ExpectSameOutput(const ImpactResult& expectedResult,
+                                     const NarrowphaseCacheEntry& expectedCacheEntry,
+                                     const ImpactResult& actualResult,
+                                     const NarrowphaseCacheEntry& actualCacheEntry) {
+            EXPECT_EQ(expectedResult.isColliding, actualResult.isColliding);
+            EXPECT_EQ(expectedResult.penetrationDirection, actualResult.penetrationDirection);
+            EXPECT_EQ(expectedResult.penetrationMagnitude, actualResult.penetrationMagnitude);
+
+            uint32_t expectedChecksum = 0, actualChecksum = 0;
+            expectedCacheEntry.CalculateCRC32(expectedChecksum);
+            actualCacheEntry.CalculateCRC32(actualChecksum);
+            EXPECT_EQ(expectedChecksum, actualChecksum);
+        }
+    };
+
+    TEST_F(NarrowphaseMemoTests, IsColliding_whenNotEnabled_thenCalculatesDirectly) {
+        NarrowphaseCacheEntry expectedCacheEntry = CreateCacheEntry(1);
+        NarrowphaseCacheEntry actualCacheEntry = CreateCacheEntry(1);
+
+        ImpactResult expectedResult = ComplexCollisions::IsColliding(coreContext, box, capsule, expectedCacheEntry);
+        ImpactResult actualResult = memo.IsColliding(coreContext, box, capsule, actualCacheEntry);
+
+        ExpectSameOutput(expectedResult, expectedCacheEntry, actualResult, actualCacheEntry);
+        EXPECT_FALSE(memo.IsEnabled());
+        EXPECT_EQ(0, memo.GetHitCount());
+        EXPECT_EQ(0, memo.GetMissCount());
+    }
+
+    TEST_F(NarrowphaseMemoTests, IsColliding_whenExactSameQueryRepeated_thenReturnsMemoizedOutput) {
+        memo.Enable();
+        NarrowphaseCacheEntry firstCacheEntry = CreateCacheEntry(1);
+        NarrowphaseCacheEntry secondCacheEntry = CreateCacheEntry(1);
+
+        ImpactResult firstResult = memo.IsColliding(coreContext, box, capsule, firstCacheEntry);
+        ImpactResult secondResult = memo.IsColliding(coreContext, box, capsule, secondCacheEntry);
+
+        ASSERT_TRUE(firstResult.isColliding);
+        ExpectSameOutput(firstResult, firstCacheEntry, secondResult, secondCacheEntry);
+        EXPECT_EQ(1, memo.GetHitCount());
+        EXPECT_EQ(1, memo.GetMissCount());
+    }
+
+    TEST_F(NarrowphaseMemoTests, IsColliding_whenColliderMovedByOneFixedPointStep_thenRecalculates) {
+        memo.Enable();
+        NarrowphaseCacheEntry firstCacheEntry = CreateCacheEntry(1);
+        NarrowphaseCacheEntry secondCacheEntry = CreateCacheEntry(1);
+        memo.IsColliding(coreContext, box, capsule, firstCacheEntry);
+
+        capsule.center.x = fp::from_raw_value(capsule.center.x.raw_value() + 1);
+        memo.IsColliding(coreContext, box, capsule, secondCacheEntry);
+
+        EXPECT_EQ(0, memo.GetHitCount());
+        EXPECT_EQ(2, memo.GetMissCount());
+    }
+
+    TEST_F(NarrowphaseMemoTests, IsColliding_whenCacheEntryStateDiffers_thenRecalculates) {
+        memo.Enable();
+        NarrowphaseCacheEntry firstCacheEntry = CreateCacheEntry(1);
+        memo.IsColliding(coreContext, box, capsule, firstCacheEntry);
+
+        // Same colliders but already warm started, which can differ from a cold result in the last few bits
+        NarrowphaseCacheEntry warmCacheEntry = firstCacheEntry;
+        warmCacheEntry.lastUsedFrame = 2;
+        memo.IsColliding(coreContext, box, capsule, warmCacheEntry);
+
+        EXPECT_EQ(0, memo.GetHitCount());
+        EXPECT_EQ(2, memo.GetMissCount());
+    }
+
+    TEST_F(NarrowphaseMemoTests, IsColliding_whenFramesResimulatedAfterRollback_thenAllHitsWithIdenticalOutput) {
+        memo.Enable();
+        constexpr FrameType kFrameCount = 10;
+
+        ImpactResult firstRunResults[kFrameCount] = {
+            ImpactResult::noCollision(), ImpactResult::noCollision(), ImpactResult::noCollision(),
+            ImpactResult::noCollision(), ImpactResult::noCollision(), ImpactResult::noCollision(),
+            ImpactResult::noCollision(), ImpactResult::noCollision(), ImpactResult::noCollision(),
+            ImpactResult::noCollision()
+        };
+        NarrowphaseCacheEntry firstRunCacheEntries[kFrameCount];
+
+        // Capsule slides along the box, so cached contact and warm start both carry over between frames
+        NarrowphaseCacheEntry cacheEntry = CreateCacheEntry(0);
+        for (FrameType frame = 0; frame < kFrameCount; frame++) {
+            FCollider movedCapsule = capsule.CopyWithNewCenter(capsule.center + FVectorFP(fp{frame} / fp{16}));
+            cacheEntry.lastUsedFrame = frame;
+            firstRunResults[frame] = memo.IsColliding(coreContext, box, movedCapsule, cacheEntry);
+            firstRunCacheEntries[frame] = cacheEntry;
+        }
+
+        // "Restore snapshot" from start, then re-simulate the same frames
+        cacheEntry = CreateCacheEntry(0);
+        for (FrameType frame = 0; frame < kFrameCount; frame++) {
+            FCollider movedCapsule = capsule.CopyWithNewCenter(capsule.center + FVectorFP(fp{frame} / fp{16}));
+            cacheEntry.lastUsedFrame = frame;
+            ImpactResult result = memo.IsColliding(coreContext, box, movedCapsule, cacheEntry);
+            ExpectSameOutput(firstRunResults[frame], firstRunCacheEntries[frame], result, cacheEntry);
+        }
+
+        EXPECT_EQ(kFrameCount, memo.GetHitCount());
+        EXPECT_EQ(kFrameCount, memo.GetMissCount());
+    }
+
+    TEST_F(NarrowphaseMemoTests, Clear_whenMemoized_thenRecalculates) {
+        memo.Enable();
+        NarrowphaseCacheEntry firstCacheEntry = CreateCacheEntry(1);
+        NarrowphaseCacheEntry secondCacheEntry = CreateCacheEntry(1);
+        memo.IsColliding(coreContext, box, capsule, firstCacheEntry);
+
+        memo.Clear();
+        memo.IsColliding(coreContext, box, capsule, secondCacheEntry);
+
+        EXPECT_EQ(0, memo.GetHitCount());
+        EXPECT_EQ(2, memo.GetMissCount());
+    }
+}
@@ -0,0 +1,239 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Context/SimContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/SimpleCollisions.h"
+#include "Physics/SweptCollisions.h"
+#include "Physics/TriggerSystem.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/Line.h"
+#include "Physics/Model/Ray.h"
+#include "Physics/Systems_Example/StepPhysicsIslandsSystem.h"
+#include "Physics/Systems_Example/UpdatePositionFromVelocitySystem.h"
+#include "Physics/Systems_Example/UpdateSleepStateSystem.h"
+#include "TestHelpers/AllocationTracker.h"
+#include "TestHelpers/TestHelpers.h"
+#include "Utilities/WorkerPool.h"
+
+using namespace ProjectNomad;
+
+namespace PhysicsAllocationTests {
+    class PhysicsAllocationTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        PhysicsWorld physicsWorld;
+        TriggerSystem triggerSystem;
+
+        void SetUp() override {
+            BaseSimTest::SetUp();
+
+            // Rows of every collider type, including rotated boxes so that box vs box goes through full SAT
+            FQuatFP tilt = FQuatFP::fromDegrees(FVectorFP(fp{1}, fp{1}, fp{0}).Normalized(), fp{30});
+            for (int i = 0; i < 4; i++) {
+                fp x = fp{i * 6};
+                CreateStatic().SetBox(FVectorFP(x, fp{0}, fp{0}), tilt, FVectorFP(fp{2}));
+                CreateStatic().SetSphere(FVectorFP(x, fp{6}, fp{0}), fp{2});
+                CreateStatic().SetCapsule(FVectorFP(x, fp{12}, fp{0}), fp{1}, fp{2});
+
+                CreateDynamic().SetBox(FVectorFP(x + fp{1}, fp{1}, fp{2}), FVectorFP(fp{1}));
+                CreateDynamic().SetSphere(FVectorFP(x + fp{1}, fp{7}, fp{1}), fp{1.5f});
+                CreateDynamic().SetCapsule(FVectorFP(x, fp{10}, fp{1}), tilt, fp{1}, fp{2});
+            }
+
+            entt::entity trigger = coreContext.registry.create();
+            coreContext.registry.emplace<TriggerColliderComponent>(trigger).collider.SetBox(
+                FVectorFP(fp{9}, fp{6}, fp{0}), tilt, FVectorFP(fp{8}, fp{8}, fp{4})
+            );
+
+            physicsWorld.RebuildBroadphase(coreContext);
+        }
+
+        FCollider& CreateStatic() {
+            entt::entity entity = coreContext.registry.create();
+            return coreContext.registry.emplace<StaticColliderComponent>(entity).collider;
+        }
+
+        FCollider& CreateDynamic() {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<NarrowphaseCacheComponent>(entity);
+            return coreContext.registry.emplace<DynamicColliderComponent>(entity).collider;
+        }
+
+        /// <summary>
+        /// Mirrors what the collision handling systems do each frame: rebuild dynamic broadphase, then resolve every
+        ///     dynamic collider against every static and dynamic collider with cached narrowphase and sweeps, update
+        ///     triggers, and run the typical gameplay scene queries.
+        /// </summary>
+        uint32_t SimulateCollisionUpdate(FrameType frame) {
+            uint32_t collisionCount = 0;
+            physicsWorld.RebuildDynamicBroadphase(coreContext);
+
+            auto dynamicView = coreContext.registry.view<DynamicColliderComponent, NarrowphaseCacheComponent>();
+            auto staticView = coreContext.registry.view<StaticColliderComponent>();
+            for (auto&& [selfId, selfComp, cacheComp] : dynamicView.each()) {
+                const FCollider& self = selfComp.collider;
+
+                for (auto&& [otherId, otherComp] : staticView.each()) {
+                    NarrowphaseCacheEntry& cacheEntry = cacheComp.cache.FindOrAdd(otherId, frame);
+                    if (ComplexCollisions::IsColliding(coreContext, self, otherComp.collider, cacheEntry).isColliding) {
+                        collisionCount++;
+                    }
+                    if (SimpleCollisions::IsColliding(coreContext, self, otherComp.collider)) {
+                        collisionCount++;
+                    }
+
+                    TimeOfImpactResult impact = SweptCollisions::CalculateTimeOfImpact(
+                        coreContext, self, FVectorFP(fp{0}, fp{0}, fp{-3}), otherComp.collider, cacheEntry.gjkWarmStart
+                    );
+                    if (impact.isHit) {
+                        collisionCount++;
+                    }
+                }
+
+                for (auto&& [otherId, otherComp, otherCacheComp] : dynamicView.each()) {
+                    if (otherId == selfId) {
+                        continue;
+                    }
+                    if (ComplexCollisions::IsColliding(coreContext, self, otherComp.collider).isColliding) {
+                        collisionCount++;
+                    }
+                }
+            }
+
+            triggerSystem.Update(coreContext);
+            collisionCount += triggerSystem.GetFrameEvents().GetSize();
+
+            SceneQueryHits hits;
+            Ray ray(FVectorFP(fp{-10}, fp{1}, fp{1}), FVectorFP::Forward());
+            physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::AllHits, {}, hits);
+            physicsWorld.Linetest(
+                coreContext, Line(FVectorFP(fp{0}, fp{-10}, fp{1}), FVectorFP(fp{0}, fp{20}, fp{1})),
+                SceneQueryMode::ClosestHit, {}, hits
+            );
+            physicsWorld.OverlapSphere(coreContext, FVectorFP(fp{6}, fp{6}, fp{0}), fp{5}, SceneQueryMode::AllHits, {}, hits);
+            physicsWorld.OverlapBox(
+                coreContext, FVectorFP(fp{12}, fp{3}, fp{0}), FQuatFP::identity(), FVectorFP(fp{4}),
+                SceneQueryMode::AllHits, {}, hits
+            );
+            collisionCount += hits.GetSize();
+
+            return collisionCount;
+        }
+    };
+
+    TEST_F(PhysicsAllocationTests, CollisionUpdate_whenSceneAlreadyBuilt_thenNoHeapAllocations) {
+        // First frame is allowed to size any persistent buffers (eg, broadphase nodes and trigger pairs)
+        uint32_t firstFrameCollisionCount = SimulateCollisionUpdate(1);
+
+        uint32_t collisionCount;
+        {
+            ScopedAllocationTracking tracking;
+            collisionCount = SimulateCollisionUpdate(2);
+        }
+
+        ASSERT_GT(firstFrameCollisionCount, 0); // Sanity check that scene exercises narrowphase at all
+        EXPECT_EQ(firstFrameCollisionCount, collisionCount);
+        EXPECT_EQ(0, AllocationTracker::GetAllocationCount());
+    }
+
+    TEST_F(PhysicsAllocationTests, StepPhysicsIslands_whenBuffersAlreadySized_thenNoHeapAllocations) {
+        // Islands need the full set of sim components, so uses its own scene: Pairs of overlapping spheres falling
+        //      onto walls, so that every frame has sweeps, static contacts and dynamic contacts
+        SimContext simContext;
+        std::vector<entt::entity> fallingSpheres;
+        for (int i = 0; i < 4; i++) {
+            fp x = fp{i * 8};
+            entt::entity wall = simContext.registry.create();
+            simContext.registry.emplace<StaticColliderComponent>(wall).collider.SetBox(
+                FVectorFP(x, fp{0}, fp{0}), FVectorFP(fp{3}, fp{3}, fp{1})
+            );
+
+            for (fp offset : {fp{0}, fp{1.5f}}) {
+                FVectorFP center(x + offset, fp{0}, fp{3});
+                entt::entity sphere = simContext.registry.create();
+                simContext.registry.emplace<TransformComponent>(sphere).location = center;
+                simContext.registry.emplace<PhysicsComponent>(sphere).velocity = FVectorFP(fp{0}, fp{0}, fp{-30});
+                simContext.registry.emplace<DynamicColliderComponent>(sphere).collider.SetSphere(center, fp{1});
+                fallingSpheres.push_back(sphere);
+            }
+        }
+
+        // Allocations are only counted on the tracking thread, so step every island on this thread
+        StepPhysicsIslandsSystem islandSystem;
+        WorkerPool workerPool(0);
+
+        // First frames are allowed to size persistent buffers and add narrowphase cache components
+        for (int i = 0; i < 3; i++) {
+            islandSystem.Update(simContext, workerPool);
+            simContext.simFrame.IncrementFrameCount();
+        }
+        FVectorFP locationBefore = simContext.registry.get<TransformComponent>(fallingSpheres[0]).location;
+
+        {
+            ScopedAllocationTracking tracking;
+            islandSystem.Update(simContext, workerPool);
+        }
+
+        // Sanity check that spheres are still being pushed apart, rather than the step having nothing left to do
+        EXPECT_NE(locationBefore.x, simContext.registry.get<TransformComponent>(fallingSpheres[0]).location.x);
+        EXPECT_EQ(0, AllocationTracker::GetAllocationCount());
+    }
+
+    TEST_F(PhysicsAllocationTests, MoveAndSleepUpdate_whenBuffersAlreadySized_thenNoHeapAllocations) {
+        // Resting pair on a floor, where one is nudged every cycle. Thus each cycle wakes by velocity, wakes the other
+        //      by contact, sweeps against the floor and finally puts the whole island back to sleep
+        SimContext simContext;
+        entt::entity floor = simContext.registry.create();
+        simContext.registry.emplace<StaticColliderComponent>(floor).collider.SetBox(
+            FVectorFP(fp{0}, fp{0}, fp{-2}), FVectorFP(fp{10}, fp{10}, fp{1})
+        );
+        std::vector<entt::entity> spheres;
+        for (fp x : {fp{0}, fp{2}}) {
+            FVectorFP center(x, fp{0}, fp{0});
+            entt::entity sphere = simContext.registry.create();
+            simContext.registry.emplace<TransformComponent>(sphere).location = center;
+            simContext.registry.emplace<PhysicsComponent>(sphere);
+            simContext.registry.emplace<DynamicColliderComponent>(sphere).collider.SetSphere(center, fp{1});
+            spheres.push_back(sphere);
+        }
+
+        UpdateSleepStateSystem sleepSystem;
+        auto step = [&] {
+            UpdatePositionFromVelocitySystem::Update(simContext);
+            sleepSystem.Update(simContext);
+            simContext.simFrame.IncrementFrameCount();
+        };
+        auto runNudgeCycle = [&] {
+            simContext.registry.get<PhysicsComponent>(spheres[1]).velocity = FVectorFP(fp{0}, fp{0}, fp{-2});
+            step();
+            bool wasContactWakeUp = !simContext.registry.all_of<SleepingFlagComponent>(spheres[0]);
+
+            simContext.registry.get<PhysicsComponent>(spheres[1]).velocity = FVectorFP::Zero();
+            for (uint32_t i = 0; i < UpdateSleepStateSystem::kFramesAtRestBeforeSleep + 1; i++) {
+                step();
+            }
+            return wasContactWakeUp;
+        };
+
+        // First sleep and cycle are allowed to size persistent buffers and component pools
+        for (uint32_t i = 0; i < UpdateSleepStateSystem::kFramesAtRestBeforeSleep; i++) {
+            step();
+        }
+        runNudgeCycle();
+
+        bool wasContactWakeUp;
+        {
+            ScopedAllocationTracking tracking;
+            wasContactWakeUp = runNudgeCycle();
+        }
+
+        // Sanity check that the tracked cycle went through every sleep state change
+        EXPECT_TRUE(wasContactWakeUp);
+        EXPECT_TRUE(simContext.registry.all_of<SleepingFlagComponent>(spheres[0]));
+        EXPECT_TRUE(simContext.registry.all_of<SleepingFlagComponent>(spheres[1]));
+        EXPECT_EQ(0, AllocationTracker::GetAllocationCount());
+    }
+}
@@ -0,0 +1,525 @@
+#include "pchNCT.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Context/CoreContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/NarrowphaseMemo.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/SimpleCollisions.h"
+#include "Physics/SweptCollisions.h"
+#include "Physics/Model/Cone.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/Line.h"
+#include "Physics/Model/Ray.h"
+#include "Random/IncrementalRandomizer.h"
+#include "TestHelpers/BenchmarkHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+// All benchmarks are DISABLED_ so they only run on request. See BenchmarkHelpers for how to run them
+namespace PhysicsBenchmarks {
+    class PhysicsBenchmarks : public BaseSimTest {
+      protected:
+        static constexpr uint64_t kSeed = 0x4E4F4D4144; // Fixed so that every run measures the exact same poses
+        static constexpr uint32_t kPoseCount = 256;
+        static constexpr uint32_t kCallCount = 200000;
+
+        CoreContext coreContext;
+        IncrementalRandomizer randomizer = IncrementalRandomizer(kSeed);
+
+        std::vector<FCollider> boxes;
+        std::vector<FCollider> capsules;
+        std::vector<FCollider> spheres;
+        std::vector<Ray> rays;
+        std::vector<Line> lines;
+        std::vector<Cone> cones;
+
+        void SetUp() override {
+            BaseSimTest::SetUp();
+
+            // Poses are packed close to origin so that roughly half of all pairs collide, as the colliding paths are
+            //      the expensive ones worth measuring
+            for (uint32_t i = 0; i < kPoseCount; i++) {
+                FCollider box;
+                box.SetBox(CreateRandomPosition(fp{3}), CreateRandomRotation(), CreateRandomSize());
+                boxes.push_back(box);
+
+                FCollider capsule;
+                fp radius = randomizer.GetRandomFp(fp{0.5f}, fp{1.5f});
+                capsule.SetCapsule(
+                    CreateRandomPosition(fp{3}), CreateRandomRotation(), radius, radius + randomizer.GetRandomFp(fp{0}, fp{2})
+                );
+                capsules.push_back(capsule);
+
+                FCollider sphere;
+                sphere.SetSphere(CreateRandomPosition(fp{3}), randomizer.GetRandomFp(fp{0.5f}, fp{2}));
+                spheres.push_back(sphere);
+
+                FVectorFP rayOrigin = CreateRandomPosition(fp{10});
+                FVectorFP rayTarget = CreateRandomPosition(fp{2});
+                rays.push_back(Ray::fromPoints(rayOrigin, rayTarget));
+                lines.push_back(Line(rayOrigin, rayTarget + (rayTarget - rayOrigin)));
+                cones.push_back(Cone(rayOrigin, rayTarget - rayOrigin, randomizer.GetRandomFp(fp{5}, fp{45}), fp{20}));
+            }
+        }
+
+        FVectorFP CreateRandomPosition(fp maxOffset) {
+            return {
+                randomizer.GetRandomFp(-maxOffset, maxOffset),
+                randomizer.GetRandomFp(-maxOffset, maxOffset),
+                randomizer.GetRandomFp(-maxOffset, maxOffset)
+            };
+        }
+
+        FVectorFP CreateRandomSize() {
+            return {
+                randomizer.GetRandomFp(fp{0.5f}, fp{2}),
+                randomizer.GetRandomFp(fp{0.5f}, fp{2}),
+                randomizer.GetRandomFp(fp{0.5f}, fp{2})
+            };
+        }
+
+        FQuatFP CreateRandomRotation() {
+            FVectorFP axis = CreateRandomPosition(fp{1});
+            if (axis.IsZero()) {
+                axis = FVectorFP::Up();
+            }
+            return FQuatFP::fromDegrees(axis.Normalized(), randomizer.GetRandomFp(fp{0}, fp{360}));
+        }
+
+        // Pairs up different poses of each list so that pairs don't repeat within kPoseCount calls
+        static uint32_t GetFirstIndex(uint32_t callIndex) {
+            return callIndex % kPoseCount;
+        }
+        static uint32_t GetSecondIndex(uint32_t callIndex) {
+            return (callIndex / kPoseCount + callIndex + 1) % kPoseCount;
+        }
+
+        template <typename Func>
+        void MeasurePairs(const std::string& name,
+                          const std::vector<FCollider>& firstColliders,
+                          const std::vector<FCollider>& secondColliders,
+                          Func&& func) {
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name, kCallCount, [&](uint32_t callIndex) {
+                return func(firstColliders[GetFirstIndex(callIndex)], secondColliders[GetSecondIndex(callIndex)]);
+            });
+        }
+
+        void MeasureAllShapePairs(const std::string& prefix,
+                                  const std::function<uint64_t(const FCollider&, const FCollider&)>& func) {
+            MeasurePairs(prefix + " box vs box", boxes, boxes, func);
+            MeasurePairs(prefix + " box vs capsule", boxes, capsules, func);
+            MeasurePairs(prefix + " box vs sphere", boxes, spheres, func);
+            MeasurePairs(prefix + " capsule vs capsule", capsules, capsules, func);
+            MeasurePairs(prefix + " capsule vs sphere", capsules, spheres, func);
+            MeasurePairs(prefix + " sphere vs sphere", spheres, spheres, func);
+        }
+    };
+
+    TEST_F(PhysicsBenchmarks, DISABLED_SimpleCollisions_IsColliding) {
+        MeasureAllShapePairs("SimpleCollisions::IsColliding", [this](const FCollider& A, const FCollider& B) {
+            return static_cast<uint64_t>(SimpleCollisions::IsColliding(coreContext, A, B));
+        });
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_ComplexCollisions_IsColliding) {
+        MeasureAllShapePairs("ComplexCollisions::IsColliding", [this](const FCollider& A, const FCollider& B) {
+            return static_cast<uint64_t>(ComplexCollisions::IsColliding(coreContext, A, B).penetrationMagnitude.raw_value());
+        });
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_ComplexCollisions_IsCollidingWithNarrowphaseCache) {
+        // Each pair is revisited once per "frame" with a slight drift, ie the coherent motion case the cache is for
+        auto measureCachedPairs = [this](const std::string& name,
+                                         const std::vector<FCollider>& firstColliders,
+                                         const std::vector<FCollider>& secondColliders) {
+            std::vector<NarrowphaseCacheEntry> cacheEntries(kPoseCount);
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name, kCallCount, [&](uint32_t callIndex) {
+                uint32_t poseIndex = GetFirstIndex(callIndex);
+                FrameType frame = callIndex / kPoseCount + 1;
+
+                const FCollider& B = secondColliders[GetSecondIndex(poseIndex)];
+                FCollider driftedB = B.CopyWithNewCenter(B.center + FVectorFP(fp{frame % 8} / fp{64}));
+                NarrowphaseCacheEntry& cacheEntry = cacheEntries[poseIndex];
+                cacheEntry.lastUsedFrame = frame;
+
+                ImpactResult result = ComplexCollisions::IsColliding(
+                    coreContext, firstColliders[poseIndex], driftedB, cacheEntry
+                );
+                return static_cast<uint64_t>(result.penetrationMagnitude.raw_value());
+            });
+        };
+
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) box vs box", boxes, boxes);
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) box vs capsule", boxes, capsules);
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) box vs sphere", boxes, spheres);
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) capsule vs capsule", capsules, capsules);
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) capsule vs sphere", capsules, spheres);
+        measureCachedPairs("ComplexCollisions::IsColliding (cached) sphere vs sphere", spheres, spheres);
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_NarrowphaseMemo_HitVersusDirect) {
+        // Exact same queries repeated, ie rollback re-simulation. Both measure a copy of the same cache entry per call
+        auto measureMemoHits = [this](const std::string& name,
+                                      const std::vector<FCollider>& firstColliders,
+                                      const std::vector<FCollider>& secondColliders) {
+            // Plenty of spare slots, so that no two queries compete for the same set
+            NarrowphaseMemo memo;
+            memo.Enable(kPoseCount * 64);
+            std::vector<NarrowphaseCacheEntry> cacheEntries(kPoseCount);
+            for (uint32_t i = 0; i < kPoseCount; i++) {
+                cacheEntries[i].lastUsedFrame = 1;
+                NarrowphaseCacheEntry cacheEntry = cacheEntries[i];
+                memo.IsColliding(coreContext, firstColliders[i], secondColliders[GetSecondIndex(i)], cacheEntry);
+            }
+
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name + " direct", kCallCount, [&](uint32_t callIndex) {
+                uint32_t poseIndex = GetFirstIndex(callIndex);
+                NarrowphaseCacheEntry cacheEntry = cacheEntries[poseIndex];
+                ImpactResult result = ComplexCollisions::IsColliding(
+                    coreContext, firstColliders[poseIndex], secondColliders[GetSecondIndex(poseIndex)], cacheEntry
+                );
+                return static_cast<uint64_t>(result.penetrationMagnitude.raw_value());
+            });
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name + " memo hit", kCallCount, [&](uint32_t callIndex) {
+                uint32_t poseIndex = GetFirstIndex(callIndex);
+                NarrowphaseCacheEntry cacheEntry = cacheEntries[poseIndex];
+                ImpactResult result = memo.IsColliding(
+                    coreContext, firstColliders[poseIndex], secondColliders[GetSecondIndex(poseIndex)], cacheEntry
+                );
+                return static_cast<uint64_t>(result.penetrationMagnitude.raw_value());
+            });
+
+            EXPECT_EQ(kPoseCount, memo.GetMissCount()) << name << ": Every measured call should have been a hit";
+        };
+
+        measureMemoHits("NarrowphaseMemo box vs box", boxes, boxes);
+        measureMemoHits("NarrowphaseMemo box vs capsule", boxes, capsules);
+        measureMemoHits("NarrowphaseMemo box vs sphere", boxes, spheres);
+        measureMemoHits("NarrowphaseMemo capsule vs capsule", capsules, capsules);
+        measureMemoHits("NarrowphaseMemo capsule vs sphere", capsules, spheres);
+        measureMemoHits("NarrowphaseMemo sphere vs sphere", spheres, spheres);
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_SimpleCollisions_RaycastsAndLinetests) {
+        fp timeOfIntersection;
+        FVectorFP pointOfIntersection;
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::RaycastWithSphere", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::RaycastWithSphere(
+                coreContext, rays[GetFirstIndex(i)], spheres[GetSecondIndex(i)], timeOfIntersection, pointOfIntersection
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::RaycastWithBox", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::RaycastWithBox(
+                coreContext, rays[GetFirstIndex(i)], boxes[GetSecondIndex(i)], timeOfIntersection, pointOfIntersection
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::RaycastWithCapsule", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::RaycastWithCapsule(
+                coreContext, rays[GetFirstIndex(i)], capsules[GetSecondIndex(i)], timeOfIntersection, pointOfIntersection
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::LinetestWithBox", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::LinetestWithBox(
+                coreContext, lines[GetFirstIndex(i)], boxes[GetSecondIndex(i)], timeOfIntersection, pointOfIntersection
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::LinetestWithCapsule", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::LinetestWithCapsule(
+                coreContext, lines[GetFirstIndex(i)], capsules[GetSecondIndex(i)], timeOfIntersection, pointOfIntersection
+            );
+        });
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_SimpleCollisions_Conecasts) {
+        fp angleCos;
+        fp distance;
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::ConecastWithSphere", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::ConecastWithSphere(
+                coreContext, cones[GetFirstIndex(i)], spheres[GetSecondIndex(i)], angleCos, distance
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::ConecastWithCapsule", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::ConecastWithCapsule(
+                coreContext, cones[GetFirstIndex(i)], capsules[GetSecondIndex(i)], angleCos, distance
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::ConecastWithBox", kCallCount, [&](uint32_t i) {
+            return SimpleCollisions::ConecastWithBox(
+                coreContext, cones[GetFirstIndex(i)], boxes[GetSecondIndex(i)], angleCos, distance
+            );
+        });
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_SimpleCollisions_CapsuleSweeps) {
+        fp timeOfImpact;
+        FVectorFP pointOfImpact;
+        FVectorFP displacement(fp{20}, fp{0}, fp{0});
+
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::SweepSphereWithCapsule", kCallCount, [&](uint32_t i) {
+            const FCollider& capsule = capsules[GetSecondIndex(i)];
+            FCollider sweepStart = spheres[GetFirstIndex(i)].CopyWithNewCenter(capsule.center - FVectorFP(fp{10}, fp{0}, fp{0}));
+            return SimpleCollisions::SweepSphereWithCapsule(
+                coreContext, sweepStart, displacement, capsule, timeOfImpact, pointOfImpact
+            );
+        });
+        BenchmarkHelpers::MeasureNanosecondsPerCall("SimpleCollisions::SweepCapsuleWithBox", kCallCount, [&](uint32_t i) {
+            const FCollider& box = boxes[GetSecondIndex(i)];
+            FCollider sweepStart = capsules[GetFirstIndex(i)].CopyWithNewCenter(box.center - FVectorFP(fp{10}, fp{0}, fp{0}));
+            return SimpleCollisions::SweepCapsuleWithBox(
+                coreContext, sweepStart, displacement, box, timeOfImpact, pointOfImpact
+            );
+        });
+    }
+
+    TEST_F(PhysicsBenchmarks, DISABLED_SweptCollisions_CalculateTimeOfImpact) {
+        GjkWarmStart warmStart;
+        MeasureAllShapePairs("SweptCollisions::CalculateTimeOfImpact", [&](const FCollider& A, const FCollider& B) {
+            // Start well away from target so that sweeps need actual advancement steps
+            FVectorFP displacement(fp{20}, fp{0}, fp{0});
+            FCollider sweepStart = A.CopyWithNewCenter(B.center - FVectorFP(fp{10}, fp{0}, fp{0}) + FVectorFP(fp{0}, A.center.y, fp{0}));
+            return static_cast<uint64_t>(
+                SweptCollisions::CalculateTimeOfImpact(coreContext, sweepStart, displacement, B, warmStart).iterations
+            );
+        });
+    }
+
+#pragma region Scenes
+
+    /// <summary>
+    /// N dynamic entities moving around M static entities, doing the same per-entity work as the Systems_Example
+    ///     systems each frame: Sweep against statics, discrete static passes, then dynamic vs dynamic checks.
+    /// Mirrors their inner loops directly on core types rather than running the systems, so that results stay
+    ///     comparable as the systems themselves change.
+    /// </summary>
+    class PhysicsSceneBenchmarks : public PhysicsBenchmarks {
+      protected:
+        static constexpr uint32_t kSceneFrameCount = 60;
+        static constexpr fp kArenaHalfSize = fp{100};
+
+        struct DynamicEntity {
+            FCollider collider;
+            FVectorFP velocity;
+            NarrowphaseCache narrowphaseCache;
+        };
+
+        std::vector<FCollider> staticColliders;
+        std::vector<DynamicEntity> dynamicEntities;
+
+        // Scene query inputs spread over the whole arena, generated up front so that only the queries are measured
+        std::vector<Ray> sceneRays;
+        std::vector<Line> sceneLines;
+        std::vector<Cone> sceneCones;
+        std::vector<FCollider> sceneOverlapShapes;
+
+        void SetUpScene(uint32_t dynamicCount, uint32_t staticCount) {
+            for (uint32_t i = 0; i < staticCount; i++) {
+                FCollider wall;
+                FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), randomizer.GetRandomFp(fp{0}, fp{360}));
+                wall.SetBox(CreateRandomPosition(kArenaHalfSize), rotation, FVectorFP(fp{8}, fp{1}, fp{5}));
+                staticColliders.push_back(wall);
+
+                entt::entity entity = coreContext.registry.create();
+                coreContext.registry.emplace<StaticColliderComponent>(entity).collider = wall;
+            }
+
+            for (uint32_t i = 0; i < dynamicCount; i++) {
+                DynamicEntity dynamicEntity;
+                if (i % 2 == 0) {
+                    dynamicEntity.collider.SetCapsule(CreateRandomPosition(kArenaHalfSize), fp{1}, fp{2});
+                }
+                else {
+                    dynamicEntity.collider.SetSphere(CreateRandomPosition(kArenaHalfSize), fp{1});
+                }
+                dynamicEntity.velocity = CreateRandomPosition(fp{2});
+                dynamicEntities.push_back(dynamicEntity);
+            }
+        }
+
+        void SetUpSceneQueries() {
+            for (uint32_t i = 0; i < kPoseCount; i++) {
+                FVectorFP origin = CreateRandomPosition(kArenaHalfSize);
+                const FVectorFP& direction = rays[i].direction;
+                sceneRays.push_back(Ray(origin, direction));
+                sceneLines.push_back(Line(origin, origin + direction * kArenaHalfSize));
+                sceneCones.push_back(Cone(origin, direction, cones[i].halfAngleDegrees, kArenaHalfSize / fp{2}));
+
+                // Query shapes are a few times bigger than the poses, eg explosions or melee hit volumes
+                FCollider shape;
+                if (i % 3 == 0) {
+                    shape.SetBox(CreateRandomPosition(kArenaHalfSize), CreateRandomRotation(), CreateRandomSize() * fp{4});
+                }
+                else if (i % 3 == 1) {
+                    shape.SetCapsule(CreateRandomPosition(kArenaHalfSize), CreateRandomRotation(), fp{3}, fp{6});
+                }
+                else {
+                    shape.SetSphere(CreateRandomPosition(kArenaHalfSize), fp{5});
+                }
+                sceneOverlapShapes.push_back(shape);
+            }
+        }
+
+        uint64_t StepScene(FrameType frame) {
+            uint64_t resultAccumulator = 0;
+
+            for (DynamicEntity& dynamicEntity : dynamicEntities) {
+                // Bounce off arena bounds so entities keep running into things rather than leaving
+                FVectorFP nextCenter = dynamicEntity.collider.center + dynamicEntity.velocity;
+                if (FPMath::abs(nextCenter.x) > kArenaHalfSize || FPMath::abs(nextCenter.y) > kArenaHalfSize) {
+                    dynamicEntity.velocity = dynamicEntity.velocity.Flipped();
+                }
+
+                // Sweep against statics
+                AABB sweptBounds = AABB::Merge(
+                    dynamicEntity.collider.GetWorldBounds(),
+                    dynamicEntity.collider.CopyWithNewCenter(dynamicEntity.collider.center + dynamicEntity.velocity).GetWorldBounds()
+                );
+                fp earliestTimeOfImpact = fp{1};
+                for (uint32_t i = 0; i < staticColliders.size(); i++) {
+                    if (!sweptBounds.Overlaps(staticColliders[i].GetWorldBounds())) {
+                        continue;
+                    }
+
+                    GjkWarmStart& warmStart = dynamicEntity.narrowphaseCache.FindOrAdd(entt::entity{i}, frame).gjkWarmStart;
+                    TimeOfImpactResult impact = SweptCollisions::CalculateTimeOfImpact(
+                        coreContext, dynamicEntity.collider, dynamicEntity.velocity, staticColliders[i], warmStart
+                    );
+                    if (impact.isHit && impact.timeOfImpact < earliestTimeOfImpact) {
+                        earliestTimeOfImpact = impact.timeOfImpact;
+                    }
+                }
+                dynamicEntity.collider.center += dynamicEntity.velocity * earliestTimeOfImpact;
+                if (earliestTimeOfImpact < fp{1}) {
+                    dynamicEntity.velocity = dynamicEntity.velocity.Flipped();
+                }
+
+                // Discrete static pass
+                for (uint32_t i = 0; i < staticColliders.size(); i++) {
+                    if (!dynamicEntity.collider.GetWorldBounds().Overlaps(staticColliders[i].GetWorldBounds())) {
+                        continue;
+                    }
+
+                    NarrowphaseCacheEntry& cacheEntry = dynamicEntity.narrowphaseCache.FindOrAdd(entt::entity{i}, frame);
+                    ImpactResult result = ComplexCollisions::IsColliding(
+                        coreContext, dynamicEntity.collider, staticColliders[i], cacheEntry
+                    );
+                    resultAccumulator += result.isColliding;
+                }
+            }
+
+            // Dynamic vs dynamic pass
+            for (uint32_t i = 0; i < dynamicEntities.size(); i++) {
+                for (uint32_t j = 0; j < dynamicEntities.size(); j++) {
+                    if (i == j) {
+                        continue;
+                    }
+                    const FCollider& other = dynamicEntities[j].collider;
+                    if (!dynamicEntities[i].collider.GetWorldBounds().Overlaps(other.GetWorldBounds())) {
+                        continue;
+                    }
+
+                    auto otherEntity = static_cast<entt::entity>(staticColliders.size() + j);
+                    NarrowphaseCacheEntry& cacheEntry = dynamicEntities[i].narrowphaseCache.FindOrAdd(otherEntity, frame);
+                    ImpactResult result = ComplexCollisions::IsColliding(
+                        coreContext, dynamicEntities[i].collider, other, cacheEntry
+                    );
+                    resultAccumulator += result.isColliding;
+                }
+            }
+
+            return resultAccumulator;
+        }
+
+        void MeasureScene(uint32_t dynamicCount, uint32_t staticCount) {
+            SetUpScene(dynamicCount, staticCount);
+
+            std::string name = "Scene " + std::to_string(dynamicCount) + " dynamic x " + std::to_string(staticCount)
+                             + " static (per frame)";
+            BenchmarkHelpers::MeasureNanosecondsPerCall(name, kSceneFrameCount, [this](uint32_t frame) {
+                return StepScene(frame + 1);
+            });
+        }
+    };
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_Scene_16DynamicVs64Static) {
+        MeasureScene(16, 64);
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_Scene_64DynamicVs64Static) {
+        MeasureScene(64, 64);
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_Scene_256DynamicVs256Static) {
+        MeasureScene(256, 256);
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_PhysicsWorld_RaycastClosestHitVs256Static) {
+        SetUpScene(0, 256);
+        SetUpSceneQueries();
+        PhysicsWorld physicsWorld;
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        BenchmarkHelpers::MeasureNanosecondsPerCall("PhysicsWorld::Raycast (closest, 256 static)", kCallCount / 10, [&](uint32_t i) {
+            hits.Clear();
+            const Ray& ray = sceneRays[GetFirstIndex(i)];
+            return physicsWorld.Raycast(coreContext, ray, kArenaHalfSize, SceneQueryMode::ClosestHit, {}, hits);
+        });
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_PhysicsWorld_LinetestClosestHitVs256Static) {
+        SetUpScene(0, 256);
+        SetUpSceneQueries();
+        PhysicsWorld physicsWorld;
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        BenchmarkHelpers::MeasureNanosecondsPerCall("PhysicsWorld::Linetest (closest, 256 static)", kCallCount / 10, [&](uint32_t i) {
+            hits.Clear();
+            const Line& line = sceneLines[GetFirstIndex(i)];
+            return physicsWorld.Linetest(coreContext, line, SceneQueryMode::ClosestHit, {}, hits);
+        });
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_PhysicsWorld_OverlapAllHitsVs256Static) {
+        SetUpScene(0, 256);
+        SetUpSceneQueries();
+        PhysicsWorld physicsWorld;
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        BenchmarkHelpers::MeasureNanosecondsPerCall("PhysicsWorld::Overlap (all, 256 static)", kCallCount / 10, [&](uint32_t i) {
+            hits.Clear();
+            const FCollider& shape = sceneOverlapShapes[GetFirstIndex(i)];
+            physicsWorld.Overlap(coreContext, shape, SceneQueryMode::AllHits, {}, hits);
+            return hits.GetSize();
+        });
+    }
+
+    TEST_F(PhysicsSceneBenchmarks, DISABLED_PhysicsWorld_ConecastBestAngleVs256Static) {
+        SetUpScene(0, 256);
+        SetUpSceneQueries();
+        PhysicsWorld physicsWorld;
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        // Grapple point search, ie the main gameplay use of conecasts
+        SceneQueryHits hits;
+        std::string name = "PhysicsWorld::Conecast (closest by angle, 256 static)";
+        BenchmarkHelpers::MeasureNanosecondsPerCall(name, kCallCount / 10, [&](uint32_t i) {
+            hits.Clear();
+            const Cone& cone = sceneCones[GetFirstIndex(i)];
+            return physicsWorld.Conecast(
+                coreContext, cone, SceneQueryMode::ClosestHit, SceneQuerySortMode::ByAngle, {}, hits
+            );
+        });
+    }
+
+#pragma endregion
+}
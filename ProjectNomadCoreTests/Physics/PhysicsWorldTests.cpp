@@ -0,0 +1,347 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/PhysicsWorld.h"
+#include "Physics/Model/Cone.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/Line.h"
+#include "Physics/Model/Ray.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace PhysicsWorldTests {
+    class PhysicsWorldTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        PhysicsWorld physicsWorld;
+
+        entt::entity CreateStaticSphere(const FVectorFP& center, fp radius) {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<StaticColliderComponent>(entity).collider.SetSphere(center, radius);
+            return entity;
+        }
+
+        entt::entity CreateStaticBox(const FVectorFP& center, const FVectorFP& halfSize) {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<StaticColliderComponent>(entity).collider.SetBox(center, halfSize);
+            return entity;
+        }
+
+        entt::entity CreateDynamicCapsule(const FVectorFP& center, fp radius, fp halfHeight) {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<DynamicColliderComponent>(entity).collider.SetCapsule(
+                center, radius, halfHeight
+            );
+            return entity;
+        }
+    };
+
+    TEST_F(PhysicsWorldTests, Raycast_whenWorldEmpty_thenNoHits) {
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::ClosestHit, {}, hits);
+
+        EXPECT_FALSE(result);
+        EXPECT_TRUE(hits.IsEmpty());
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenClosestHitMode_thenReturnsNearestCollider) {
+        CreateStaticSphere(FVectorFP(fp{30}, fp{0}, fp{0}), fp{2});
+        entt::entity nearSphere = CreateStaticSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{2});
+        CreateStaticSphere(FVectorFP(fp{20}, fp{0}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::ClosestHit, {}, hits);
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(1, hits.GetSize());
+        EXPECT_EQ(nearSphere, hits.Get(0).hitEntity);
+        EXPECT_NEAR(8, static_cast<float>(hits.Get(0).distance), 0.01f);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenAllHitsMode_thenReturnsHitsSortedByDistance) {
+        entt::entity farSphere = CreateStaticSphere(FVectorFP(fp{30}, fp{0}, fp{0}), fp{2});
+        entt::entity nearSphere = CreateStaticSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{2});
+        entt::entity middleBox = CreateStaticBox(FVectorFP(fp{20}, fp{0}, fp{0}), FVectorFP(fp{1}));
+        CreateStaticSphere(FVectorFP(fp{20}, fp{50}, fp{0}), fp{2}); // Not along ray
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::AllHits, {}, hits);
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(3, hits.GetSize());
+        EXPECT_EQ(nearSphere, hits.Get(0).hitEntity);
+        EXPECT_EQ(middleBox, hits.Get(1).hitEntity);
+        EXPECT_EQ(farSphere, hits.Get(2).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenColliderBeyondMaxDistance_thenNoHits) {
+        CreateStaticSphere(FVectorFP(fp{30}, fp{0}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{20}, SceneQueryMode::AnyHit, {}, hits);
+
+        EXPECT_FALSE(result);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenHittingDynamicCapsule_thenReportsDynamicHit) {
+        entt::entity capsule = CreateDynamicCapsule(FVectorFP(fp{10}, fp{0}, fp{0}), fp{1}, fp{3});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::ClosestHit, {}, hits);
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(capsule, hits.Get(0).hitEntity);
+        EXPECT_TRUE(hits.Get(0).didHitDynamicEntity);
+        EXPECT_NEAR(9, static_cast<float>(hits.Get(0).distance), 0.05f);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenFilterIgnoresEntity_thenSkipsThatEntity) {
+        entt::entity nearSphere = CreateStaticSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{2});
+        entt::entity farSphere = CreateStaticSphere(FVectorFP(fp{30}, fp{0}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryFilter filter;
+        filter.ignoredEntity = nearSphere;
+        CollisionResultWithHitEntity result = physicsWorld.RaycastClosest(
+            coreContext, Ray(FVectorFP::Zero(), FVectorFP::Forward()), fp{100}, filter
+        );
+
+        ASSERT_TRUE(result.isColliding);
+        EXPECT_EQ(farSphere, result.hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenManyColliders_thenMatchesBruteForceClosestHit) {
+        // Grid of spheres so that the BVH has several levels
+        for (int x = 0; x < 10; x++) {
+            for (int y = -5; y < 5; y++) {
+                CreateStaticSphere(FVectorFP(fp{x * 10 + 5}, fp{y * 4}, fp{0}), fp{1});
+            }
+        }
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        Ray ray(FVectorFP(fp{0}, fp{8}, fp{0}), FVectorFP::Forward());
+        CollisionResultWithHitEntity result = physicsWorld.RaycastClosest(coreContext, ray, fp{200});
+
+        ASSERT_TRUE(result.isColliding);
+        const FCollider& hitCollider = coreContext.registry.get<StaticColliderComponent>(result.hitEntity).collider;
+        EXPECT_EQ(fp{5}, hitCollider.center.x);
+        EXPECT_EQ(fp{8}, hitCollider.center.y);
+    }
+
+    TEST_F(PhysicsWorldTests, Linetest_whenLineStopsShortOfCollider_thenNoHits) {
+        CreateStaticBox(FVectorFP(fp{20}, fp{0}, fp{0}), FVectorFP(fp{1}));
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        Line line(FVectorFP::Zero(), FVectorFP(fp{15}, fp{0}, fp{0}));
+        CollisionResultWithHitEntity result = physicsWorld.LinetestClosest(coreContext, line);
+
+        EXPECT_FALSE(result.isColliding);
+    }
+
+    TEST_F(PhysicsWorldTests, OverlapSphere_whenOverlappingStaticAndDynamic_thenReturnsBoth) {
+        entt::entity box = CreateStaticBox(FVectorFP(fp{3}, fp{0}, fp{0}), FVectorFP(fp{1}));
+        entt::entity capsule = CreateDynamicCapsule(FVectorFP(fp{-3}, fp{0}, fp{0}), fp{1}, fp{2});
+        CreateStaticSphere(FVectorFP(fp{50}, fp{0}, fp{0}), fp{1});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.OverlapSphere(
+            coreContext, FVectorFP::Zero(), fp{2.5f}, SceneQueryMode::AllHits, {}, hits
+        );
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(2, hits.GetSize());
+        bool foundBox = hits.Get(0).hitEntity == box || hits.Get(1).hitEntity == box;
+        bool foundCapsule = hits.Get(0).hitEntity == capsule || hits.Get(1).hitEntity == capsule;
+        EXPECT_TRUE(foundBox);
+        EXPECT_TRUE(foundCapsule);
+    }
+
+    TEST_F(PhysicsWorldTests, OverlapBox_whenFilterExcludesDynamic_thenOnlyReturnsStatic) {
+        entt::entity box = CreateStaticBox(FVectorFP(fp{3}, fp{0}, fp{0}), FVectorFP(fp{1.5f}));
+        CreateDynamicCapsule(FVectorFP(fp{-3}, fp{0}, fp{0}), fp{1}, fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryFilter filter;
+        filter.includeDynamic = false;
+        SceneQueryHits hits;
+        bool result = physicsWorld.OverlapBox(
+            coreContext, FVectorFP::Zero(), FQuatFP::identity(), FVectorFP(fp{2.5f}),
+            SceneQueryMode::AllHits, filter, hits
+        );
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(1, hits.GetSize());
+        EXPECT_EQ(box, hits.Get(0).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenEntityDestroyedAfterRebuild_thenSkipsEntity) {
+        entt::entity sphere = CreateStaticSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+        coreContext.registry.destroy(sphere);
+
+        CollisionResultWithHitEntity result = physicsWorld.RaycastClosest(
+            coreContext, Ray(FVectorFP::Zero(), FVectorFP::Forward()), fp{100}
+        );
+
+        EXPECT_FALSE(result.isColliding);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenCollidersInsideAndOutsideCone_thenOnlyReturnsThoseInside) {
+        entt::entity sphereInside = CreateStaticSphere(FVectorFP(fp{10}, fp{2}, fp{0}), fp{1});
+        entt::entity boxInside = CreateStaticBox(FVectorFP(fp{20}, fp{-3}, fp{0}), FVectorFP(fp{1}));
+        entt::entity capsuleInside = CreateDynamicCapsule(FVectorFP(fp{15}, fp{0}, fp{0}), fp{1}, fp{3});
+        CreateStaticSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{1}); // Behind cone
+        CreateStaticSphere(FVectorFP(fp{10}, fp{20}, fp{0}), fp{1}); // Outside of cone angle
+        CreateStaticBox(FVectorFP(fp{60}, fp{0}, fp{0}), FVectorFP(fp{1})); // Beyond cone range
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{30}, fp{40}, {},
+            SceneQuerySortMode::ByDistance, hits
+        );
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(3, hits.GetSize());
+        EXPECT_EQ(sphereInside, hits.Get(0).hitEntity);
+        EXPECT_EQ(capsuleInside, hits.Get(1).hitEntity);
+        EXPECT_EQ(boxInside, hits.Get(2).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenSortingByAngle_thenMostCenteredColliderIsFirst) {
+        entt::entity nearButOffCenter = CreateStaticSphere(FVectorFP(fp{10}, fp{4}, fp{0}), fp{1});
+        entt::entity farButCentered = CreateStaticSphere(FVectorFP(fp{30}, fp{0}, fp{0}), fp{1});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{45}, fp{40}, {},
+            SceneQuerySortMode::ByAngle, hits
+        );
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(2, hits.GetSize());
+        EXPECT_EQ(farButCentered, hits.Get(0).hitEntity);
+        EXPECT_EQ(nearButOffCenter, hits.Get(1).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenOnlySphereEdgeWithinCone_thenReturnsSphere) {
+        // Center is at ~26.6 degrees from cone direction, but radius reaches within 20 degrees
+        entt::entity sphere = CreateStaticSphere(FVectorFP(fp{10}, fp{5}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{20}, fp{40}, {},
+            SceneQuerySortMode::ByDistance, hits
+        );
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(sphere, hits.Get(0).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenOnlyBoxEdgeWithinCone_thenReturnsBox) {
+        // Box corner pokes into cone even though box center, nearest point to apex, and cone axis all miss
+        FCollider rotatedBox;
+        rotatedBox.SetBox(
+            FVectorFP(fp{20}, fp{10}, fp{0}),
+            FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}),
+            FVectorFP(fp{4}, fp{4}, fp{1})
+        );
+        entt::entity box = coreContext.registry.create();
+        coreContext.registry.emplace<StaticColliderComponent>(box).collider = rotatedBox;
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{15}, fp{40}, {},
+            SceneQuerySortMode::ByDistance, hits
+        );
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(box, hits.Get(0).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenOnlyBoxFaceInteriorWithinCone_thenReturnsBox) {
+        // Huge box face lies alongside cone axis. All vertices and edges are out of range, but face cuts into the cone
+        entt::entity box = CreateStaticBox(FVectorFP(fp{0}, fp{30}, fp{0}), FVectorFP(fp{1000}, fp{10}, fp{1000}));
+        entt::entity sphereOnFace = CreateStaticSphere(FVectorFP(fp{60}, fp{20}, fp{0}), fp{1});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{30}, fp{100}, {},
+            SceneQuerySortMode::ByAngle, hits
+        );
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(2, hits.GetSize());
+        EXPECT_EQ(box, hits.Get(0).hitEntity); // Best face point is at edge of range, much closer to axis than sphere
+        EXPECT_EQ(sphereOnFace, hits.Get(1).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenBoxEdgeBestAnglePointOutOfRange_thenStillReturnsBox) {
+        // Edge along cone direction gets closer to cone axis further out, but only its near portion is within range
+        entt::entity box = CreateStaticBox(FVectorFP(fp{50}, fp{11}, fp{0}), FVectorFP(fp{50}, fp{1}, fp{1}));
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{30}, fp{40}, {},
+            SceneQuerySortMode::ByDistance, hits
+        );
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(box, hits.Get(0).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Conecast_whenCapsulePassesAcrossConeAxis_thenReturnsCapsule) {
+        // Horizontal capsule whose endpoints are both outside of the cone, but middle crosses cone axis
+        entt::entity capsule = coreContext.registry.create();
+        coreContext.registry.emplace<DynamicColliderComponent>(capsule).collider.SetCapsule(
+            FVectorFP(fp{20}, fp{-15}, fp{0}), FVectorFP(fp{20}, fp{15}, fp{0}), fp{0.5f}
+        );
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryHits hits;
+        bool result = physicsWorld.Conecast(
+            coreContext, FVectorFP::Zero(), FVectorFP::Forward(), fp{10}, fp{40}, {},
+            SceneQuerySortMode::ByAngle, hits
+        );
+
+        ASSERT_TRUE(result);
+        EXPECT_EQ(capsule, hits.Get(0).hitEntity);
+    }
+
+    TEST_F(PhysicsWorldTests, Raycast_whenColliderLayerNotInQueryMask_thenColliderIsSkipped) {
+        constexpr CollisionLayerBits kCharacterLayer = 1u << 1;
+        entt::entity character = CreateStaticSphere(FVectorFP(fp{10}, fp{0}, fp{0}), fp{2});
+        coreContext.registry.get<StaticColliderComponent>(character).layerFilter.layers = kCharacterLayer;
+        entt::entity wall = CreateStaticSphere(FVectorFP(fp{20}, fp{0}, fp{0}), fp{2});
+        physicsWorld.RebuildBroadphase(coreContext);
+
+        SceneQueryFilter filter;
+        filter.layerMask = CollisionLayers::kAll & ~kCharacterLayer;
+        SceneQueryHits hits;
+        Ray ray(FVectorFP::Zero(), FVectorFP::Forward());
+        bool result = physicsWorld.Raycast(coreContext, ray, fp{100}, SceneQueryMode::AllHits, filter, hits);
+
+        ASSERT_TRUE(result);
+        ASSERT_EQ(1, hits.GetSize());
+        EXPECT_EQ(wall, hits.Get(0).hitEntity);
+    }
+}
@@ -0,0 +1,82 @@
+#include "pchNCT.h"
+
+#include "Physics/ColliderHelpers.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Model/RuntimeCollider.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace RuntimeColliderTests {
+    class RuntimeColliderTests : public BaseSimTest {
+      protected:
+        // Matrix form rounds slightly differently than quaternion products
+        const fp kTolerance = fp{0.005f};
+
+        FCollider CreateRotatedBox() {
+            FCollider box;
+            FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP(fp{1}, fp{2}, fp{3}).Normalized(), fp{40});
+            box.SetBox(FVectorFP(fp{10}, fp{-4}, fp{2}), rotation, FVectorFP(fp{1}, fp{2}, fp{3}));
+            return box;
+        }
+    };
+
+    TEST_F(RuntimeColliderTests, ToLocalSpaceFromWorld_whenRotatedBox_thenMatchesSourceCollider) {
+        FCollider box = CreateRotatedBox();
+        RuntimeCollider runtimeBox(box);
+        FVectorFP worldPoint(fp{12}, fp{-1}, fp{5});
+
+        TestHelpers::expectNear(box.ToLocalSpaceFromWorld(worldPoint), runtimeBox.ToLocalSpaceFromWorld(worldPoint),
+                                kTolerance);
+        TestHelpers::expectNear(box.ToWorldSpaceFromLocal(worldPoint), runtimeBox.ToWorldSpaceFromLocal(worldPoint),
+                                kTolerance);
+    }
+
+    TEST_F(RuntimeColliderTests, ToWorldSpaceFromLocal_whenRoundTripped_thenReturnsOriginalPoint) {
+        RuntimeCollider runtimeBox(CreateRotatedBox());
+        FVectorFP worldPoint(fp{3}, fp{7}, fp{-2});
+
+        TestHelpers::expectNear(worldPoint,
+                                runtimeBox.ToWorldSpaceFromLocal(runtimeBox.ToLocalSpaceFromWorld(worldPoint)),
+                                kTolerance);
+    }
+
+    TEST_F(RuntimeColliderTests, GetCoreFurthestPoint_whenRotatedBox_thenMatchesColliderHelpers) {
+        FCollider box = CreateRotatedBox();
+        RuntimeCollider runtimeBox(box);
+
+        for (const FVectorFP& direction : {FVectorFP::Forward(), FVectorFP::Left(), FVectorFP(fp{1}, fp{-1}, fp{1})}) {
+            TestHelpers::expectNear(ColliderHelpers::GetCoreFurthestPoint(box, direction),
+                                    runtimeBox.GetCoreFurthestPoint(direction), kTolerance);
+        }
+    }
+
+    TEST_F(RuntimeColliderTests, SyncFrom_whenCapsule_thenPrecalculatesMedialSegmentAndBounds) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP(fp{1}, fp{2}, fp{3}), FQuatFP::fromDegrees(FVectorFP::Right(), fp{90}), fp{1}, fp{4});
+
+        RuntimeCollider runtimeCapsule(capsule);
+
+        EXPECT_EQ(capsule.GetCapsuleRadius(), runtimeCapsule.coreRadius);
+        EXPECT_EQ(capsule.GetCapsuleMedialLineExtremes().start, runtimeCapsule.capsuleMedialSegment.start);
+        EXPECT_EQ(capsule.GetCapsuleMedialLineExtremes().end, runtimeCapsule.capsuleMedialSegment.end);
+        EXPECT_EQ(capsule.GetWorldBounds(), runtimeCapsule.worldBounds);
+    }
+
+    TEST_F(RuntimeColliderTests, SetCenter_whenMoved_thenMatchesRecreatingFromMovedCollider) {
+        FCollider capsule;
+        capsule.SetCapsule(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Forward(), fp{30}), fp{1}, fp{3});
+        FVectorFP newCenter(fp{-5}, fp{8}, fp{1});
+
+        RuntimeCollider movedRuntimeCapsule(capsule);
+        movedRuntimeCapsule.SetCenter(newCenter);
+        RuntimeCollider expected(capsule.CopyWithNewCenter(newCenter));
+
+        EXPECT_EQ(expected.center, movedRuntimeCapsule.center);
+        EXPECT_EQ(expected.worldBounds, movedRuntimeCapsule.worldBounds);
+        TestHelpers::expectNear(expected.capsuleMedialSegment.start, movedRuntimeCapsule.capsuleMedialSegment.start,
+                                kTolerance);
+        TestHelpers::expectNear(expected.capsuleMedialSegment.end, movedRuntimeCapsule.capsuleMedialSegment.end,
+                                kTolerance);
+    }
+}
@@ -0,0 +1,197 @@
+#include "pchNCT.h"
+
+#include "Context/SimContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/Model/AABB.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Systems_Example/HandleDynamicVsDynamicCollisions.h"
+#include "Physics/Systems_Example/HandleDynamicVsStaticCollisions.h"
+#include "Physics/Systems_Example/StepPhysicsIslandsSystem.h"
+#include "Physics/Systems_Example/UpdatePositionFromVelocitySystem.h"
+#include "Physics/Systems_Example/UpdateSleepStateSystem.h"
+#include "Random/IncrementalRandomizer.h"
+#include "TestHelpers/TestHelpers.h"
+#include "Utilities/WorkerPool.h"
+
+using namespace ProjectNomad;
+
+namespace StepPhysicsIslandsSystemTests {
+    class StepPhysicsIslandsSystemTests : public BaseSimTest {
+      protected:
+        static constexpr uint32_t kFrameCount = 60;
+
+        // Every test compares an island stepped sim against a reference sim, both set up identically
+        SimContext islandSimContext;
+        SimContext referenceSimContext;
+        StepPhysicsIslandsSystem islandSystem;
+        UpdateSleepStateSystem islandSleepSystem;
+        UpdateSleepStateSystem referenceSleepSystem;
+
+        static entt::entity CreateDynamicSphere(SimContext& simContext, const FVectorFP& center, fp radius) {
+            entt::entity entity = simContext.registry.create();
+            simContext.registry.emplace<TransformComponent>(entity).location = center;
+            simContext.registry.emplace<PhysicsComponent>(entity);
+            simContext.registry.emplace<DynamicColliderComponent>(entity).collider.SetSphere(center, radius);
+            return entity;
+        }
+
+        // Crowded arena of mixed shapes, speeds and masses, so that islands merge, split and push into each other
+        static void CreateRandomScene(SimContext& simContext) {
+            IncrementalRandomizer randomizer(0x49534C414E44);
+
+            std::vector<AABB> staticBounds;
+            for (uint32_t i = 0; i < 8; i++) {
+                entt::entity entity = simContext.registry.create();
+                FVectorFP center(randomizer.GetRandomFp(fp{-24}, fp{24}), randomizer.GetRandomFp(fp{-24}, fp{24}), fp{0});
+                FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), randomizer.GetRandomFp(fp{0}, fp{360}));
+                FCollider& collider = simContext.registry.emplace<StaticColliderComponent>(entity).collider;
+                collider.SetBox(center, rotation, FVectorFP(fp{4}, fp{1}, fp{3}));
+                staticBounds.push_back(collider.GetWorldBounds());
+            }
+
+            std::vector<entt::entity> dynamicEntities;
+            for (uint32_t i = 0; i < 48; i++) {
+                // Don't start deep within walls, as that's a level design error rather than something to compare
+                FVectorFP center;
+                bool isWithinWall = true;
+                while (isWithinWall) {
+                    center = FVectorFP(randomizer.GetRandomFp(fp{-12}, fp{12}), randomizer.GetRandomFp(fp{-12}, fp{12}), fp{0});
+                    AABB spawnBounds = AABB::FromCenterAndHalfSize(center, FVectorFP(fp{2}));
+                    isWithinWall = std::any_of(staticBounds.begin(), staticBounds.end(), [&](const AABB& bounds) {
+                        return bounds.Overlaps(spawnBounds);
+                    });
+                }
+                entt::entity entity = CreateDynamicSphere(simContext, center, fp{1});
+
+                FCollider& collider = simContext.registry.get<DynamicColliderComponent>(entity).collider;
+                if (i % 3 == 1) {
+                    FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Right(), randomizer.GetRandomFp(fp{0}, fp{90}));
+                    collider.SetCapsule(center, rotation, fp{1}, fp{2});
+                }
+                else if (i % 3 == 2) {
+                    FQuatFP rotation = FQuatFP::fromDegrees(FVectorFP::Up(), randomizer.GetRandomFp(fp{0}, fp{360}));
+                    collider.SetBox(center, rotation, FVectorFP(fp{1}, fp{1.5f}, fp{1}));
+                }
+
+                PhysicsComponent& physicsComp = simContext.registry.get<PhysicsComponent>(entity);
+                physicsComp.mass = fp{randomizer.GetRandom32(1, 8)};
+                if (i % 4 == 0) {
+                    simContext.registry.emplace<SleepingFlagComponent>(entity);
+                }
+                else {
+                    physicsComp.velocity = FVectorFP(
+                        randomizer.GetRandomFp(fp{-120}, fp{120}), randomizer.GetRandomFp(fp{-120}, fp{120}), fp{0}
+                    );
+                }
+                dynamicEntities.push_back(entity);
+            }
+
+            // Shuffle one of the pools, so that the individual systems' views don't all iterate in the same order
+            for (uint32_t i = 0; i < dynamicEntities.size(); i += 3) {
+                DynamicColliderComponent colliderComp = simContext.registry.get<DynamicColliderComponent>(dynamicEntities[i]);
+                simContext.registry.remove<DynamicColliderComponent>(dynamicEntities[i]);
+                simContext.registry.emplace<DynamicColliderComponent>(dynamicEntities[i], colliderComp);
+            }
+        }
+
+        void StepIslands(WorkerPool& workerPool) {
+            islandSystem.Update(islandSimContext, workerPool);
+            islandSleepSystem.Update(islandSimContext);
+            islandSimContext.simFrame.IncrementFrameCount();
+        }
+
+        void StepIndividualSystems() {
+            UpdatePositionFromVelocitySystem::Update(referenceSimContext);
+            HandleDynamicVsStaticCollisions::Update(referenceSimContext);
+            HandleDynamicVsDynamicCollisions::Update(referenceSimContext);
+            referenceSleepSystem.Update(referenceSimContext);
+            referenceSimContext.simFrame.IncrementFrameCount();
+        }
+
+        // Exact equality of everything the physics systems write, as entities were created in the same order
+        void ExpectIdenticalSims(uint32_t frame) {
+            auto view = referenceSimContext.registry.view<PhysicsComponent, TransformComponent, DynamicColliderComponent>();
+            for (auto&& [entityId, physicsComp, transformComp, colliderComp] : view.each()) {
+                const entt::registry& islandRegistry = islandSimContext.registry;
+                SCOPED_TRACE("Frame " + std::to_string(frame) + ", entity " + std::to_string(entt::to_integral(entityId)));
+
+                TestHelpers::expectEq(transformComp.location, islandRegistry.get<TransformComponent>(entityId).location);
+                TestHelpers::expectEq(colliderComp.collider.center,
+                                      islandRegistry.get<DynamicColliderComponent>(entityId).collider.center);
+                TestHelpers::expectEq(physicsComp.velocity, islandRegistry.get<PhysicsComponent>(entityId).velocity);
+                EXPECT_EQ(physicsComp.framesAtRest, islandRegistry.get<PhysicsComponent>(entityId).framesAtRest);
+                EXPECT_EQ(referenceSimContext.registry.all_of<SleepingFlagComponent>(entityId),
+                          islandRegistry.all_of<SleepingFlagComponent>(entityId));
+                EXPECT_EQ(referenceSimContext.registry.all_of<NarrowphaseCacheComponent>(entityId),
+                          islandRegistry.all_of<NarrowphaseCacheComponent>(entityId));
+            }
+        }
+
+        void ExpectSameAsIndividualSystems(uint32_t workerThreadCount, uint32_t frameCount) {
+            WorkerPool workerPool(workerThreadCount);
+            for (uint32_t frame = 0; frame < frameCount; frame++) {
+                StepIslands(workerPool);
+                StepIndividualSystems();
+                ExpectIdenticalSims(frame);
+                if (HasFailure()) { // One frame of mismatches is plenty to debug with
+                    return;
+                }
+            }
+        }
+    };
+
+    TEST_F(StepPhysicsIslandsSystemTests, Update_whenNoWorkerThreadsVsSeveral_thenIdenticalResults) {
+        CreateRandomScene(islandSimContext);
+        CreateRandomScene(referenceSimContext);
+        StepPhysicsIslandsSystem referenceIslandSystem;
+
+        WorkerPool inlineWorkerPool(0);
+        WorkerPool threadedWorkerPool(3);
+        for (uint32_t frame = 0; frame < kFrameCount; frame++) {
+            StepIslands(threadedWorkerPool);
+
+            referenceIslandSystem.Update(referenceSimContext, inlineWorkerPool);
+            referenceSleepSystem.Update(referenceSimContext);
+            referenceSimContext.simFrame.IncrementFrameCount();
+
+            ExpectIdenticalSims(frame);
+            if (HasFailure()) {
+                return;
+            }
+        }
+    }
+
+    TEST_F(StepPhysicsIslandsSystemTests, Update_whenCrowdedScene_thenIdenticalToIndividualSystems) {
+        CreateRandomScene(islandSimContext);
+        CreateRandomScene(referenceSimContext);
+
+        ExpectSameAsIndividualSystems(3, kFrameCount);
+    }
+
+    TEST_F(StepPhysicsIslandsSystemTests, Update_whenPushedFurtherThanIslandMargin_thenResolvedInSameFrame) {
+        // Heavy sphere pushes light one a full 3.5 units, right into a third sphere well outside of its island
+        for (SimContext* simContext : {&islandSimContext, &referenceSimContext}) {
+            entt::entity heavySphere = CreateDynamicSphere(*simContext, FVectorFP::Zero(), fp{2});
+            simContext->registry.get<PhysicsComponent>(heavySphere).mass = fp{1000};
+            CreateDynamicSphere(*simContext, FVectorFP(fp{0.5f}, fp{0}, fp{0}), fp{2});
+            CreateDynamicSphere(*simContext, FVectorFP(fp{5.6f}, fp{0}, fp{0}), fp{1});
+        }
+        entt::entity farSphere = static_cast<entt::entity>(2);
+
+        ExpectSameAsIndividualSystems(2, 1);
+        EXPECT_GT(islandSimContext.registry.get<TransformComponent>(farSphere).location.x, fp{5.6f});
+    }
+
+    TEST_F(StepPhysicsIslandsSystemTests, Update_whenSleepingChainPushed_thenWokenEntitiesProcessedInSameFrame) {
+        // Awake sphere overlaps first sleeping sphere, which in turn overlaps second sleeping sphere
+        for (SimContext* simContext : {&islandSimContext, &referenceSimContext}) {
+            CreateDynamicSphere(*simContext, FVectorFP::Zero(), fp{1});
+            for (fp x : {fp{1.5f}, fp{3}}) {
+                entt::entity sleepingSphere = CreateDynamicSphere(*simContext, FVectorFP(x, fp{0}, fp{0}), fp{1});
+                simContext->registry.emplace<SleepingFlagComponent>(sleepingSphere);
+            }
+        }
+
+        ExpectSameAsIndividualSystems(2, kFrameCount);
+    }
+}
@@ -0,0 +1,110 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "Physics/ComplexCollisions.h"
+#include "Physics/SweptCollisions.h"
+#include "Physics/Model/FCollider.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace SweptCollisionsTests {
+    class SweptCollisionsTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        const fp kTolerance = fp{0.02f};
+    };
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenSphereMovesIntoBoxFace_thenStopsAtContactOffset) {
+        FCollider sphere, box;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{1});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        // Contact at x = -6, ie after 4 units of movement out of 8
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(
+            coreContext, sphere, FVectorFP(fp{8}, fp{0}, fp{0}), box
+        );
+
+        ASSERT_TRUE(result.isHit);
+        EXPECT_FALSE(result.wasInitiallyOverlapping);
+        TestHelpers::expectNear(FVectorFP::Forward(), result.contactNormal, kTolerance);
+        TestHelpers::expectNear((fp{4} - SweptCollisions::kContactOffset) / fp{8}, result.timeOfImpact, kTolerance);
+    }
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenFastSphereWouldTunnelThroughThinBox_thenHits) {
+        FCollider sphere, wall;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{0.5f});
+        wall.SetBox(FVectorFP::Zero(), FVectorFP(fp{0.1f}, fp{5}, fp{5}));
+
+        // End position is entirely past the wall, so a discrete check at the end would miss it completely
+        FVectorFP displacement(fp{20}, fp{0}, fp{0});
+        FCollider endCollider = sphere.CopyWithNewCenter(sphere.center + displacement);
+        ASSERT_FALSE(ComplexCollisions::IsColliding(coreContext, endCollider, wall).isColliding);
+
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(coreContext, sphere, displacement, wall);
+
+        ASSERT_TRUE(result.isHit);
+        TestHelpers::expectNear(FVectorFP::Forward(), result.contactNormal, kTolerance);
+        FCollider colliderAtImpact = sphere.CopyWithNewCenter(sphere.center + displacement * result.timeOfImpact);
+        EXPECT_FALSE(ComplexCollisions::IsColliding(coreContext, colliderAtImpact, wall).isColliding);
+        TestHelpers::expectNear(fp{-0.6f} - SweptCollisions::kContactOffset, colliderAtImpact.center.x, kTolerance);
+    }
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenMovingAway_thenNoHit) {
+        FCollider sphere, box;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{1});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(
+            coreContext, sphere, FVectorFP(fp{-8}, fp{0}, fp{0}), box
+        );
+
+        EXPECT_FALSE(result.isHit);
+    }
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenStoppingShortOfCollider_thenNoHit) {
+        FCollider sphere, box;
+        sphere.SetSphere(FVectorFP(fp{-10}, fp{0}, fp{0}), fp{1});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(
+            coreContext, sphere, FVectorFP(fp{3}, fp{0}, fp{0}), box
+        );
+
+        EXPECT_FALSE(result.isHit);
+    }
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenInitiallyOverlapping_thenReportsOverlapAtTimeZero) {
+        FCollider sphere, box;
+        sphere.SetSphere(FVectorFP(fp{5}, fp{0}, fp{0}), fp{1});
+        box.SetBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(
+            coreContext, sphere, FVectorFP(fp{-3}, fp{0}, fp{0}), box
+        );
+
+        ASSERT_TRUE(result.isHit);
+        EXPECT_TRUE(result.wasInitiallyOverlapping);
+        EXPECT_EQ(fp{0}, result.timeOfImpact);
+    }
+
+    TEST_F(SweptCollisionsTests, CalculateTimeOfImpact_whenCapsuleSweptIntoRotatedBox_thenStopsJustShortOfContact) {
+        FCollider capsule, box;
+        capsule.SetCapsule(FVectorFP(fp{-15}, fp{2}, fp{0}), fp{1}, fp{3});
+        box.SetBox(FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}), FVectorFP(fp{4}));
+        FVectorFP displacement(fp{15}, fp{-2}, fp{0});
+
+        TimeOfImpactResult result = SweptCollisions::CalculateTimeOfImpact(coreContext, capsule, displacement, box);
+
+        ASSERT_TRUE(result.isHit);
+        EXPECT_FALSE(result.wasInitiallyOverlapping);
+        EXPECT_LE(result.iterations, 6);
+
+        FCollider colliderAtImpact = capsule.CopyWithNewCenter(capsule.center + displacement * result.timeOfImpact);
+        EXPECT_FALSE(ComplexCollisions::IsColliding(coreContext, colliderAtImpact, box).isColliding);
+        FCollider colliderSlightlyLater = colliderAtImpact.CopyWithNewCenter(
+            colliderAtImpact.center + displacement.Normalized() * fp{0.2f}
+        );
+        EXPECT_TRUE(ComplexCollisions::IsColliding(coreContext, colliderSlightlyLater, box).isColliding);
+    }
+}
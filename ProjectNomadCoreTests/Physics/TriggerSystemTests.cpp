@@ -0,0 +1,199 @@
+#include "pchNCT.h"
+
+#include "Context/CoreContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/TriggerSystem.h"
+#include "Physics/Model/FCollider.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace TriggerSystemTests {
+    class TriggerSystemTests : public BaseSimTest {
+      protected:
+        CoreContext coreContext;
+        TriggerSystem triggerSystem;
+
+        entt::entity CreateTriggerBox(const FVectorFP& center, const FVectorFP& halfSize) {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<TriggerColliderComponent>(entity).collider.SetBox(center, halfSize);
+            return entity;
+        }
+
+        entt::entity CreateDynamicSphere(const FVectorFP& center, fp radius) {
+            entt::entity entity = coreContext.registry.create();
+            coreContext.registry.emplace<DynamicColliderComponent>(entity).collider.SetSphere(center, radius);
+            return entity;
+        }
+
+        void MoveDynamic(entt::entity entity, const FVectorFP& newCenter) {
+            coreContext.registry.get<DynamicColliderComponent>(entity).collider.center = newCenter;
+        }
+
+        void ExpectSingleEvent(TriggerEventType type, entt::entity trigger, entt::entity other) {
+            const TriggerEvents& events = triggerSystem.GetFrameEvents();
+            ASSERT_EQ(1, events.GetSize());
+            EXPECT_EQ(type, events.Get(0).type);
+            EXPECT_EQ(trigger, events.Get(0).triggerEntity);
+            EXPECT_EQ(other, events.Get(0).otherEntity);
+        }
+    };
+
+    TEST_F(TriggerSystemTests, Update_whenNoTriggers_thenNoEvents) {
+        CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+
+        triggerSystem.Update(coreContext);
+
+        EXPECT_TRUE(triggerSystem.GetFrameEvents().IsEmpty());
+        EXPECT_TRUE(triggerSystem.GetPairCache().pairs.IsEmpty());
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenDynamicEntersStaysThenExits_thenEmitsEnterStayExit) {
+        entt::entity trigger = CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        entt::entity sphere = CreateDynamicSphere(FVectorFP(fp{20}, fp{0}, fp{0}), fp{1});
+
+        triggerSystem.Update(coreContext);
+        EXPECT_TRUE(triggerSystem.GetFrameEvents().IsEmpty());
+
+        MoveDynamic(sphere, FVectorFP(fp{5}, fp{0}, fp{0}));
+        triggerSystem.Update(coreContext);
+        ExpectSingleEvent(TriggerEventType::Enter, trigger, sphere);
+        EXPECT_TRUE(triggerSystem.IsOverlapping(trigger, sphere));
+
+        MoveDynamic(sphere, FVectorFP(fp{2}, fp{0}, fp{0}));
+        triggerSystem.Update(coreContext);
+        ExpectSingleEvent(TriggerEventType::Stay, trigger, sphere);
+
+        MoveDynamic(sphere, FVectorFP(fp{20}, fp{0}, fp{0}));
+        triggerSystem.Update(coreContext);
+        ExpectSingleEvent(TriggerEventType::Exit, trigger, sphere);
+        EXPECT_FALSE(triggerSystem.IsOverlapping(trigger, sphere));
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenBoundsOverlapButShapesDoNot_thenNoEnter) {
+        // Sphere is within trigger box's corner region of bounds, but not touching the rotated box itself
+        entt::entity trigger = coreContext.registry.create();
+        coreContext.registry.emplace<TriggerColliderComponent>(trigger).collider.SetBox(
+            FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}), FVectorFP(fp{5}, fp{5}, fp{5})
+        );
+        entt::entity sphere = CreateDynamicSphere(FVectorFP(fp{6}, fp{6}, fp{0}), fp{1});
+
+        triggerSystem.Update(coreContext);
+
+        EXPECT_TRUE(triggerSystem.GetFrameEvents().IsEmpty());
+        EXPECT_FALSE(triggerSystem.IsOverlapping(trigger, sphere));
+        EXPECT_EQ(1, triggerSystem.GetPairCache().pairs.GetSize()); // Still cached so negative result can be reused
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenNothingMoved_thenNoNarrowphaseRetests) {
+        CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        CreateDynamicSphere(FVectorFP(fp{1}, fp{0}, fp{0}), fp{1});
+        entt::entity movingSphere = CreateDynamicSphere(FVectorFP(fp{-1}, fp{0}, fp{0}), fp{1});
+
+        triggerSystem.Update(coreContext);
+        EXPECT_EQ(2, triggerSystem.GetNarrowphaseTestCount());
+
+        triggerSystem.Update(coreContext);
+        EXPECT_EQ(0, triggerSystem.GetNarrowphaseTestCount());
+        EXPECT_EQ(2, triggerSystem.GetFrameEvents().GetSize()); // Both still get stay events
+
+        MoveDynamic(movingSphere, FVectorFP(fp{-2}, fp{0}, fp{0}));
+        triggerSystem.Update(coreContext);
+        EXPECT_EQ(1, triggerSystem.GetNarrowphaseTestCount());
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenRotationMirroredWithSameBounds_thenRetestedAndExits) {
+        // Long bar along one diagonal touches trigger, while mirrored bar along other diagonal has identical bounds
+        entt::entity trigger = CreateTriggerBox(FVectorFP(fp{2.5f}, fp{2.5f}, fp{0}), FVectorFP(fp{0.5f}));
+        entt::entity bar = coreContext.registry.create();
+        FCollider& barCollider = coreContext.registry.emplace<DynamicColliderComponent>(bar).collider;
+        barCollider.SetBox(
+            FVectorFP::Zero(), FQuatFP::fromDegrees(FVectorFP::Up(), fp{45}), FVectorFP(fp{4}, fp{0.5f}, fp{0.5f})
+        );
+        AABB initialBounds = barCollider.GetWorldBounds();
+
+        triggerSystem.Update(coreContext);
+        ExpectSingleEvent(TriggerEventType::Enter, trigger, bar);
+
+        barCollider.rotation = FQuatFP::fromDegrees(FVectorFP::Up(), fp{-45});
+        ASSERT_EQ(initialBounds, barCollider.GetWorldBounds());
+        triggerSystem.Update(coreContext);
+        EXPECT_EQ(1, triggerSystem.GetNarrowphaseTestCount());
+        ExpectSingleEvent(TriggerEventType::Exit, trigger, bar);
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenOverlappingEntityDestroyed_thenEmitsExit) {
+        entt::entity trigger = CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        triggerSystem.Update(coreContext);
+
+        coreContext.registry.destroy(sphere);
+        triggerSystem.Update(coreContext);
+
+        ExpectSingleEvent(TriggerEventType::Exit, trigger, sphere);
+        EXPECT_TRUE(triggerSystem.GetPairCache().pairs.IsEmpty());
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenMultiplePairs_thenEventsOrderedByEntityIds) {
+        entt::entity triggerA = CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        entt::entity triggerB = CreateTriggerBox(FVectorFP(fp{3}, fp{0}, fp{0}), FVectorFP(fp{5}));
+        entt::entity sphereA = CreateDynamicSphere(FVectorFP(fp{1}, fp{0}, fp{0}), fp{1});
+        entt::entity sphereB = CreateDynamicSphere(FVectorFP(fp{2}, fp{0}, fp{0}), fp{1});
+
+        triggerSystem.Update(coreContext);
+
+        const TriggerEvents& events = triggerSystem.GetFrameEvents();
+        ASSERT_EQ(4, events.GetSize());
+        EXPECT_EQ(triggerA, events.Get(0).triggerEntity);
+        EXPECT_EQ(sphereA, events.Get(0).otherEntity);
+        EXPECT_EQ(triggerA, events.Get(1).triggerEntity);
+        EXPECT_EQ(sphereB, events.Get(1).otherEntity);
+        EXPECT_EQ(triggerB, events.Get(2).triggerEntity);
+        EXPECT_EQ(sphereA, events.Get(2).otherEntity);
+        EXPECT_EQ(triggerB, events.Get(3).triggerEntity);
+        EXPECT_EQ(sphereB, events.Get(3).otherEntity);
+    }
+
+    TEST_F(TriggerSystemTests, RestorePairCache_whenRestoredToPriorFrame_thenReplaysSameEventsAndChecksum) {
+        entt::entity trigger = CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        entt::entity sphere = CreateDynamicSphere(FVectorFP(fp{20}, fp{0}, fp{0}), fp{1});
+        triggerSystem.Update(coreContext);
+
+        TriggerPairCache snapshot = triggerSystem.GetPairCache();
+        uint32_t snapshotChecksum = 0;
+        snapshot.CalculateCRC32(snapshotChecksum);
+
+        MoveDynamic(sphere, FVectorFP::Zero());
+        triggerSystem.Update(coreContext);
+        ExpectSingleEvent(TriggerEventType::Enter, trigger, sphere);
+        uint32_t enteredChecksum = 0;
+        triggerSystem.GetPairCache().CalculateCRC32(enteredChecksum);
+        EXPECT_NE(snapshotChecksum, enteredChecksum);
+
+        // Roll back and resimulate the same frame
+        triggerSystem.RestorePairCache(snapshot);
+        EXPECT_TRUE(triggerSystem.GetFrameEvents().IsEmpty());
+        triggerSystem.Update(coreContext);
+
+        ExpectSingleEvent(TriggerEventType::Enter, trigger, sphere);
+        uint32_t resimulatedChecksum = 0;
+        triggerSystem.GetPairCache().CalculateCRC32(resimulatedChecksum);
+        EXPECT_EQ(enteredChecksum, resimulatedChecksum);
+    }
+
+    TEST_F(TriggerSystemTests, Update_whenLayersDoNotInteract_thenNoPairOrNarrowphase) {
+        constexpr CollisionLayerBits kPlayerLayer = 1u << 1;
+        constexpr CollisionLayerBits kCameraLayer = 1u << 2;
+        entt::entity trigger = CreateTriggerBox(FVectorFP::Zero(), FVectorFP(fp{5}));
+        coreContext.registry.get<TriggerColliderComponent>(trigger).layerFilter.mask = kPlayerLayer;
+        entt::entity player = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        coreContext.registry.get<DynamicColliderComponent>(player).layerFilter.layers = kPlayerLayer;
+        entt::entity camera = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        coreContext.registry.get<DynamicColliderComponent>(camera).layerFilter.layers = kCameraLayer;
+
+        triggerSystem.Update(coreContext);
+
+        ExpectSingleEvent(TriggerEventType::Enter, trigger, player);
+        EXPECT_EQ(1, triggerSystem.GetNarrowphaseTestCount());
+    }
+}
@@ -0,0 +1,186 @@
+#include "pchNCT.h"
+
+#include "Context/SimContext.h"
+#include "GameCore/CoreComponents.h"
+#include "Physics/Model/FCollider.h"
+#include "Physics/Systems_Example/HandleDynamicVsDynamicCollisions.h"
+#include "Physics/Systems_Example/HandleDynamicVsStaticCollisions.h"
+#include "Physics/Systems_Example/UpdatePositionFromVelocitySystem.h"
+#include "Physics/Systems_Example/UpdateSleepStateSystem.h"
+#include "Physics/Systems_Example/Helpers/PhysicsUpdateHelpers.h"
+#include "TestHelpers/TestHelpers.h"
+
+using namespace ProjectNomad;
+
+namespace UpdateSleepStateSystemTests {
+    class UpdateSleepStateSystemTests : public BaseSimTest {
+      protected:
+        SimContext simContext;
+        UpdateSleepStateSystem sleepSystem;
+
+        entt::entity CreateDynamicSphere(const FVectorFP& center, fp radius) {
+            entt::entity entity = simContext.registry.create();
+            simContext.registry.emplace<TransformComponent>(entity).location = center;
+            simContext.registry.emplace<PhysicsComponent>(entity);
+            simContext.registry.emplace<DynamicColliderComponent>(entity).collider.SetSphere(center, radius);
+            return entity;
+        }
+
+        entt::entity CreateStaticBox(const FVectorFP& center, const FVectorFP& halfSize) {
+            entt::entity entity = simContext.registry.create();
+            simContext.registry.emplace<StaticColliderComponent>(entity).collider.SetBox(center, halfSize);
+            return entity;
+        }
+
+        bool IsSleeping(entt::entity entity) {
+            return simContext.registry.all_of<SleepingFlagComponent>(entity);
+        }
+
+        void RunSleepUpdates(uint32_t frameCount) {
+            for (uint32_t i = 0; i < frameCount; i++) {
+                sleepSystem.Update(simContext);
+            }
+        }
+
+        void PutToSleep(entt::entity entity) {
+            RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep);
+            ASSERT_TRUE(IsSleeping(entity));
+        }
+
+        FVectorFP GetLocation(entt::entity entity) {
+            return simContext.registry.get<TransformComponent>(entity).location;
+        }
+    };
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenAtRestForThreshold_thenFallsAsleep) {
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+
+        RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep - 1);
+        EXPECT_FALSE(IsSleeping(sphere));
+
+        sleepSystem.Update(simContext);
+        EXPECT_TRUE(IsSleeping(sphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenMovingAboveRestSpeed_thenNeverFallsAsleep) {
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        simContext.registry.get<PhysicsComponent>(sphere).velocity = FVectorFP(fp{5}, fp{0}, fp{0});
+
+        RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep * 2);
+
+        EXPECT_FALSE(IsSleeping(sphere));
+        EXPECT_EQ(0, simContext.registry.get<PhysicsComponent>(sphere).framesAtRest);
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenRestingEntityTouchesMovingEntity_thenWholeIslandStaysAwake) {
+        entt::entity restingSphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        entt::entity movingSphere = CreateDynamicSphere(FVectorFP(fp{2}, fp{0}, fp{0}), fp{1});
+        simContext.registry.get<PhysicsComponent>(movingSphere).velocity = FVectorFP(fp{5}, fp{0}, fp{0});
+
+        RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep * 2);
+
+        EXPECT_FALSE(IsSleeping(restingSphere));
+        EXPECT_FALSE(IsSleeping(movingSphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenChainTouchesMovingEntity_thenOnlyThatIslandStaysAwake) {
+        // Moving sphere only touches the end of the chain, so the rest is only kept awake through the island
+        entt::entity chainStart = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        entt::entity chainMiddle = CreateDynamicSphere(FVectorFP(fp{2}, fp{0}, fp{0}), fp{1});
+        entt::entity movingSphere = CreateDynamicSphere(FVectorFP(fp{4}, fp{0}, fp{0}), fp{1});
+        simContext.registry.get<PhysicsComponent>(movingSphere).velocity = FVectorFP(fp{0}, fp{0}, fp{5});
+        entt::entity farSphere = CreateDynamicSphere(FVectorFP(fp{50}, fp{0}, fp{0}), fp{1});
+
+        RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep * 2);
+
+        EXPECT_FALSE(IsSleeping(chainStart));
+        EXPECT_FALSE(IsSleeping(chainMiddle));
+        EXPECT_FALSE(IsSleeping(movingSphere));
+        EXPECT_TRUE(IsSleeping(farSphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenMovingEntityFarFromSleepingEntity_thenStaysAsleep) {
+        entt::entity sleepingSphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sleepingSphere);
+
+        entt::entity movingSphere = CreateDynamicSphere(FVectorFP(fp{20}, fp{0}, fp{0}), fp{1});
+        simContext.registry.get<PhysicsComponent>(movingSphere).velocity = FVectorFP(fp{-5}, fp{0}, fp{0});
+        sleepSystem.Update(simContext);
+
+        EXPECT_TRUE(IsSleeping(sleepingSphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, Update_whenMovingEntityTouchesSleepingEntity_thenWakesUp) {
+        entt::entity sleepingSphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sleepingSphere);
+
+        entt::entity movingSphere = CreateDynamicSphere(FVectorFP(fp{2}, fp{0}, fp{0}), fp{1});
+        simContext.registry.get<PhysicsComponent>(movingSphere).velocity = FVectorFP(fp{-5}, fp{0}, fp{0});
+        sleepSystem.Update(simContext);
+
+        EXPECT_FALSE(IsSleeping(sleepingSphere));
+        EXPECT_EQ(0, simContext.registry.get<PhysicsComponent>(sleepingSphere).framesAtRest);
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, DynamicCollisions_whenAwakeEntityPushesSleepingEntity_thenWakesUp) {
+        entt::entity sleepingSphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sleepingSphere);
+
+        CreateDynamicSphere(FVectorFP(fp{1.5f}, fp{0}, fp{0}), fp{1}); // Overlapping, so has to push sleeping sphere
+        HandleDynamicVsDynamicCollisions::Update(simContext);
+
+        EXPECT_FALSE(IsSleeping(sleepingSphere));
+        EXPECT_LT(GetLocation(sleepingSphere).x, fp{0});
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, UpdatePosition_whenSleepingEntityGivenImpulse_thenWakesUpAndMoves) {
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sphere);
+
+        simContext.registry.get<PhysicsComponent>(sphere).velocity = FVectorFP(fp{60}, fp{0}, fp{0});
+        UpdatePositionFromVelocitySystem::Update(simContext);
+
+        EXPECT_FALSE(IsSleeping(sphere));
+        EXPECT_GT(GetLocation(sphere).x, fp{0});
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, WakeUp_whenSleeping_thenRemovesFlagAndResetsRestCounter) {
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sphere);
+
+        PhysicsUpdateHelpers::WakeUp(simContext.registry, sphere);
+
+        EXPECT_FALSE(IsSleeping(sphere));
+        EXPECT_EQ(0, simContext.registry.get<PhysicsComponent>(sphere).framesAtRest);
+
+        // Full rest period again before falling back asleep
+        RunSleepUpdates(UpdateSleepStateSystem::kFramesAtRestBeforeSleep - 1);
+        EXPECT_FALSE(IsSleeping(sphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, StaticCollisions_whenSleepingEntityOverlapsStatic_thenIsNotMoved) {
+        entt::entity sphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        PutToSleep(sphere);
+        CreateStaticBox(FVectorFP(fp{1.5f}, fp{0}, fp{0}), FVectorFP(fp{1})); // Eg, level geometry moved by gameplay
+
+        HandleDynamicVsStaticCollisions::Update(simContext);
+
+        EXPECT_TRUE(IsSleeping(sphere));
+        TestHelpers::expectEq(FVectorFP::Zero(), GetLocation(sphere));
+    }
+
+    TEST_F(UpdateSleepStateSystemTests, DynamicCollisions_whenOnlySleepingEntitiesOverlap_thenAreNotMoved) {
+        entt::entity firstSphere = CreateDynamicSphere(FVectorFP::Zero(), fp{1});
+        entt::entity secondSphere = CreateDynamicSphere(FVectorFP(fp{1.5f}, fp{0}, fp{0}), fp{1});
+        PutToSleep(firstSphere);
+        ASSERT_TRUE(IsSleeping(secondSphere));
+
+        UpdatePositionFromVelocitySystem::Update(simContext);
+        HandleDynamicVsDynamicCollisions::Update(simContext);
+
+        EXPECT_TRUE(IsSleeping(firstSphere));
+        EXPECT_TRUE(IsSleeping(secondSphere));
+        TestHelpers::expectEq(FVectorFP::Zero(), GetLocation(firstSphere));
+        TestHelpers::expectEq(FVectorFP(fp{1.5f}, fp{0}, fp{0}), GetLocation(secondSphere));
+    }
+}
@@ -0,0 +1,114 @@
+#include "pchNCT.h"
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+    thread_local bool tIsTracking = false;
+    thread_local uint64_t tAllocationCount = 0;
+
+    void* trackedAllocate(std::size_t size) {
+        if (tIsTracking) {
+            tAllocationCount++;
+        }
+
+        // malloc(0) may return null, which operator new is never allowed to do
+        void* result = std::malloc(size == 0 ? 1 : size);
+        if (result == nullptr) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+
+    void* trackedAllocateAligned(std::size_t size, std::align_val_t alignment) {
+        if (tIsTracking) {
+            tAllocationCount++;
+        }
+
+        // Unlike malloc, aligned allocations have to be freed via the matching aligned free
+        std::size_t alignmentValue = static_cast<std::size_t>(alignment);
+#ifdef _MSC_VER
+        void* result = _aligned_malloc(size == 0 ? 1 : size, alignmentValue);
+#else
+        // aligned_alloc requires size to be a multiple of alignment
+        std::size_t roundedSize = (size + alignmentValue - 1) / alignmentValue * alignmentValue;
+        void* result = std::aligned_alloc(alignmentValue, roundedSize == 0 ? alignmentValue : roundedSize);
+#endif
+        if (result == nullptr) {
+            throw std::bad_alloc();
+        }
+        return result;
+    }
+
+    void freeAligned(void* pointer) {
+#ifdef _MSC_VER
+        _aligned_free(pointer);
+#else
+        std::free(pointer);
+#endif
+    }
+}
+
+void AllocationTracker::StartTracking() {
+    tAllocationCount = 0;
+    tIsTracking = true;
+}
+
+void AllocationTracker::StopTracking() {
+    tIsTracking = false;
+}
+
+uint64_t AllocationTracker::GetAllocationCount() {
+    return tAllocationCount;
+}
+
+// Replacing the plain and array forms is enough, as the nothrow forms and the default sized deletes forward to these.
+//      Over-aligned forms are replaced too, as sim types such as RuntimeCollider (alignas(64)) are stored in vectors.
+void* operator new(std::size_t size) {
+    return trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size) {
+    return trackedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    freeAligned(pointer);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+/// <summary>
+/// Counts heap allocations made on the current thread while tracking, via replaced global operator new (see cpp).
+/// Intended for asserting that hot paths (eg, narrowphase) never allocate. Note that gtest assertions themselves
+///     allocate, so stop tracking before checking results.
+/// </summary>
+class AllocationTracker {
+public:
+    static void StartTracking();
+    static void StopTracking();
+    static uint64_t GetAllocationCount();
+};
+
+// Tracks allocations for the lifetime of the scope, for convenience
+class ScopedAllocationTracking {
+public:
+    ScopedAllocationTracking() {
+        AllocationTracker::StartTracking();
+    }
+    ~ScopedAllocationTracking() {
+        AllocationTracker::StopTracking();
+    }
+};
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/// <summary>
+/// Minimal timing helpers for micro-benchmarks, which live alongside regular tests as DISABLED_ tests so that they
+///     never slow down normal test runs. Run them explicitly via:
+///     --gtest_also_run_disabled_tests --gtest_filter=*Benchmarks*
+/// Numbers are only meaningful relative to each other on the same machine and build config (ie, Release).
+/// When comparing against an existing implementation, measure the baseline first in each pair, so that any ordering
+///     effects (eg, warmed up caches) only favor the baseline.
+/// See MathBenchmarks for timings and accuracy of all core math types next to float/double equivalents.
+/// </summary>
+class BenchmarkHelpers {
+public:
+    /**
+    * Calls func with every index in [0, callCount) after a short warm up pass, then prints and returns the average
+    *   time per call.
+    * @param func - takes call index and returns anything convertible to uint64_t derived from the measured result,
+    *               which is accumulated so that the compiler can't optimize the measured work away
+    **/
+    template <typename Func>
+    static double MeasureNanosecondsPerCall(const std::string& name, uint32_t callCount, Func&& func) {
+        uint64_t resultAccumulator = 0;
+        for (uint32_t i = 0; i < callCount / 10; i++) {
+            resultAccumulator += static_cast<uint64_t>(func(i));
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < callCount; i++) {
+            resultAccumulator += static_cast<uint64_t>(func(i));
+        }
+        auto endTime = std::chrono::steady_clock::now();
+
+        sResultSink = sResultSink + resultAccumulator;
+        double nanosecondsPerCall = std::chrono::duration<double, std::nano>(endTime - startTime).count() / callCount;
+        std::cout << "[ BENCH    ] " << name << ": " << nanosecondsPerCall << " ns/call" << std::endl;
+        return nanosecondsPerCall;
+    }
+
+    struct ErrorStats {
+        double max = 0;
+        double mean = 0;
+    };
+
+    /**
+    * Calls func with every index in [0, sampleCount), then prints and returns max and mean absolute error.
+    * Meant for dense input sweeps against a reference (typically double) implementation.
+    * @param func - takes sample index and returns error of that sample, already in the unit to report (eg, fp LSB)
+    **/
+    template <typename Func>
+    static ErrorStats MeasureError(const std::string& name, const std::string& unit, uint32_t sampleCount, Func&& func) {
+        ErrorStats result;
+        double errorSum = 0;
+        for (uint32_t i = 0; i < sampleCount; i++) {
+            double error = func(i);
+            error = error < 0 ? -error : error;
+            result.max = error > result.max ? error : result.max;
+            errorSum += error;
+        }
+        result.mean = sampleCount > 0 ? errorSum / sampleCount : 0;
+
+        std::cout << "[ ACCURACY ] " << name << ": max " << result.max << " " << unit << ", mean " << result.mean
+                  << " " << unit << std::endl;
+        return result;
+    }
+
+private:
+    static inline volatile uint64_t sResultSink = 0;
+};
@@ -17,33 +17,33 @@ void TestHelpers::expectNear(fp expected, fp actual, fp range) {
     EXPECT_NEAR(fExpected, fActual, fRange);
 }
 
-void TestHelpers::assertNear(FPVector expected, FPVector actual, fp range) {
+void TestHelpers::assertNear(FVectorFP expected, FVectorFP actual, fp range) {
     ASSERT_NEAR(static_cast<float>(expected.x), static_cast<float>(actual.x), static_cast<float>(range));
     ASSERT_NEAR(static_cast<float>(expected.y), static_cast<float>(actual.y), static_cast<float>(range));
     ASSERT_NEAR(static_cast<float>(expected.z), static_cast<float>(actual.z), static_cast<float>(range));
 }
 
-void TestHelpers::expectNear(FPVector expected, FPVector actual, fp range) {
+void TestHelpers::expectNear(FVectorFP expected, FVectorFP actual, fp range) {
     EXPECT_NEAR(static_cast<float>(expected.x), static_cast<float>(actual.x), static_cast<float>(range));
     EXPECT_NEAR(static_cast<float>(expected.y), static_cast<float>(actual.y), static_cast<float>(range));
     EXPECT_NEAR(static_cast<float>(expected.z), static_cast<float>(actual.z), static_cast<float>(range));
 }
 
-void TestHelpers::assertNear(FPQuat expected, FPQuat actual, fp range) {
+void TestHelpers::assertNear(FQuatFP expected, FQuatFP actual, fp range) {
     ASSERT_NEAR(static_cast<float>(expected.w), static_cast<float>(actual.w), static_cast<float>(range));
     ASSERT_NEAR(static_cast<float>(expected.v.x), static_cast<float>(actual.v.x), static_cast<float>(range));
     ASSERT_NEAR(static_cast<float>(expected.v.y), static_cast<float>(actual.v.y), static_cast<float>(range));
     ASSERT_NEAR(static_cast<float>(expected.v.z), static_cast<float>(actual.v.z), static_cast<float>(range));
 }
 
-void TestHelpers::expectNear(FPQuat expected, FPQuat actual, fp range) {
+void TestHelpers::expectNear(FQuatFP expected, FQuatFP actual, fp range) {
     EXPECT_NEAR(static_cast<float>(expected.w), static_cast<float>(actual.w), static_cast<float>(range));
     EXPECT_NEAR(static_cast<float>(expected.v.x), static_cast<float>(actual.v.x), static_cast<float>(range));
     EXPECT_NEAR(static_cast<float>(expected.v.y), static_cast<float>(actual.v.y), static_cast<float>(range));
     EXPECT_NEAR(static_cast<float>(expected.v.z), static_cast<float>(actual.v.z), static_cast<float>(range));
 }
 
-void TestHelpers::expectEq(FPVector expected, FPVector actual) {
+void TestHelpers::expectEq(FVectorFP expected, FVectorFP actual) {
     expectNear(expected, actual, fp{0});
 }
 
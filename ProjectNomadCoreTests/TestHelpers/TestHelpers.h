@@ -1,7 +1,8 @@
 #pragma once
 
 #include "TestLogger.h"
-#include "Math/FPVector.h"
+#include "Math/FQuatFP.h"
+#include "Math/FVectorFP.h"
 #include "Utilities/LoggerSingleton.h"
 #include "Utilities/Singleton.h"
 
@@ -18,13 +19,13 @@ public:
     static void assertNear(fp expected, fp actual, fp range);
     static void expectNear(fp expected, fp actual, fp range);
 
-    static void assertNear(FPVector expected, FPVector actual, fp range);
-    static void expectNear(FPVector expected, FPVector actual, fp range);
+    static void assertNear(FVectorFP expected, FVectorFP actual, fp range);
+    static void expectNear(FVectorFP expected, FVectorFP actual, fp range);
 
-    static void assertNear(FPQuat expected, FPQuat actual, fp range);
-    static void expectNear(FPQuat expected, FPQuat actual, fp range);
+    static void assertNear(FQuatFP expected, FQuatFP actual, fp range);
+    static void expectNear(FQuatFP expected, FQuatFP actual, fp range);
     
-    static void expectEq(FPVector expected, FPVector actual);
+    static void expectEq(FVectorFP expected, FVectorFP actual);
 
     static void verifyErrorsLogged(TestLogger& logger);
     static void verifyNoErrorsLogged(TestLogger& logger);
@@ -0,0 +1,56 @@
+#include "pchNCT.h"
+
+#include "TestHelpers/TestHelpers.h"
+#include "Utilities/WorkerPool.h"
+
+using namespace ProjectNomad;
+
+namespace WorkerPoolTests {
+    class WorkerPoolTests : public BaseSimTest {
+      protected:
+        void ExpectEveryTaskRunsExactlyOnce(WorkerPool& workerPool, uint32_t taskCount) {
+            std::vector<std::atomic<uint32_t>> runCounts(taskCount);
+            workerPool.ParallelFor(taskCount, [&runCounts](uint32_t taskIndex) {
+                runCounts[taskIndex]++;
+            });
+
+            for (uint32_t i = 0; i < taskCount; i++) {
+                EXPECT_EQ(1, runCounts[i].load()) << "Task index " << i;
+            }
+        }
+    };
+
+    TEST_F(WorkerPoolTests, ParallelFor_whenNoWorkerThreads_thenRunsAllTasksInline) {
+        WorkerPool workerPool(0);
+
+        std::vector<uint32_t> runOrder;
+        workerPool.ParallelFor(5, [&runOrder](uint32_t taskIndex) {
+            runOrder.push_back(taskIndex);
+        });
+
+        EXPECT_EQ(std::vector<uint32_t>({0, 1, 2, 3, 4}), runOrder);
+    }
+
+    TEST_F(WorkerPoolTests, ParallelFor_whenNoTasks_thenDoesNothing) {
+        WorkerPool workerPool(2);
+
+        bool wasRun = false;
+        workerPool.ParallelFor(0, [&wasRun](uint32_t) { wasRun = true; });
+
+        EXPECT_FALSE(wasRun);
+    }
+
+    TEST_F(WorkerPoolTests, ParallelFor_whenMultipleWorkerThreads_thenRunsEveryTaskExactlyOnce) {
+        WorkerPool workerPool(3);
+
+        ExpectEveryTaskRunsExactlyOnce(workerPool, 1000);
+    }
+
+    TEST_F(WorkerPoolTests, ParallelFor_whenCalledRepeatedly_thenEachBatchCompletesBeforeReturning) {
+        WorkerPool workerPool(4);
+
+        for (uint32_t batch = 0; batch < 200; batch++) {
+            ExpectEveryTaskRunsExactlyOnce(workerPool, batch % 7);
+        }
+    }
+}